@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * @file        display_binding.h
+ * @brief       Motor declarativo de vnculo VP <-> fonte de dados.
+ * @details     Cada tela declara, numa tabela constante, quais VPs exibem
+ * quais dados (medio, RTC, configurao), com formato, fator de escala e
+ * perodo de atualizao. Um nico agendador emite apenas os VPs da tela
+ * visvel que esto vencidos e cujo valor mudou desde a ltima emisso.
+ ******************************************************************************/
+
+#ifndef DISPLAY_BINDING_H
+#define DISPLAY_BINDING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define BINDING_MAX_POR_TELA   8   /**< Mximo de VPs vinculados numa mesma tela. */
+#define BINDING_TEXTO_MAX     24   /**< Tamanho mximo de um VP de texto. */
+
+/** Formato do VP no display. */
+typedef enum
+{
+    BIND_FMT_INT16 = 0,  /**< Valor numrico * escala, enviado como int16. */
+    BIND_FMT_INT32,      /**< Valor numrico * escala, enviado como int32. */
+    BIND_FMT_TEXTO       /**< Texto produzido pela fonte. */
+} BindFormato_t;
+
+/** Fonte numrica: retorna false se o dado no est disponvel. */
+typedef bool (*bind_fonte_num_t)(float* valor);
+
+/** Fonte de texto: escreve no mximo 'tam' bytes (com terminador) em 'buf'. */
+typedef bool (*bind_fonte_txt_t)(char* buf, uint8_t tam);
+
+/** Vnculo de um VP. */
+typedef struct
+{
+    uint16_t         vp;
+    BindFormato_t    formato;
+    bind_fonte_num_t fonte_num;   /**< Usada em BIND_FMT_INT16/INT32. */
+    bind_fonte_txt_t fonte_txt;   /**< Usada em BIND_FMT_TEXTO. */
+    float            escala;      /**< Multiplicador aplicado  fonte numrica. */
+    uint16_t         periodo_ms;  /**< Intervalo mnimo entre amostragens. */
+    uint8_t          max_len;     /**< Comprimento enviado para texto. */
+} DisplayBinding_t;
+
+/** Conjunto de vnculos de uma tela. */
+typedef struct
+{
+    uint16_t                tela;
+    const DisplayBinding_t* bindings;
+    uint8_t                 num_bindings;
+} DisplayScreenBindings_t;
+
+/**
+ * @brief Inicializa o agendador (nenhuma tela ativa).
+ */
+void DisplayBinding_Init(void);
+
+/**
+ * @brief Emite os VPs vencidos da tela visvel. Chamar no superloop.
+ * @param tela_atual ID da tela atualmente exibida.
+ */
+void DisplayBinding_Process(uint16_t tela_atual);
+
+/**
+ * @brief Fora a reemisso de todos os VPs da tela atual no prximo ciclo
+ *        (ex.: aps o display reiniciar).
+ */
+void DisplayBinding_Invalidate(void);
+
+#endif // DISPLAY_BINDING_H
@@ -14,6 +14,7 @@
 #include "controller.h"
 #include "gerenciador_configuracoes.h"
 #include "medicao_handler.h"
+#include "sequencia_handler.h"
 #include "rtc_driver.h"
 #include "relato.h"
 #include "temp_sensor.h"
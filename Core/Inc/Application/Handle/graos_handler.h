@@ -36,4 +36,11 @@ void Graos_Handle_Pesquisa_Texto(const uint8_t* data, uint16_t len);
  */
 void Graos_Handle_Page_Change(void);
 
+/**
+ * @brief Retoma o envio dos nomes da pgina de resultados quando a lane de
+ *        dados no pde aceitar o slot nem o callback de continuao.
+ *        Chamada periodicamente pelo display handler.
+ */
+void Graos_Process(void);
+
 #endif // GRAOS_HANDLER_H
\ No newline at end of file
@@ -16,13 +16,37 @@
 // Estrutura de dados que armazena a ltima medio completa.
 typedef struct {
     float Peso;
+    float Peso_Amostra;         // Peso lquido capturado pela ltima sequncia de medio
     float Frequencia;
     float Escala_A;
     float Temp_Instru;
     float Densidade;
     float Umidade;
+    float Umidade_Desvio;       // Desvio-padro das repeties que geraram a Umidade
 } DadosMedicao_t;
 
+// Grandezas brutas da ltima aquisio (antes de converso), para telemetria.
+typedef struct {
+    int32_t  Contagem_ADC;      // Mediana de 3 do ADS1232, sem tara
+    uint32_t Pulsos_Janela;     // Pulsos contados na ltima janela
+    uint16_t Janela_ms;         // Durao dessa janela
+    uint32_t Janelas_Frequencia; // Nmero de janelas fechadas desde o boot
+} DadosBrutos_t;
+
+#define MEDICAO_JANELA_PESO     8u  // leituras do ADS1232 usadas no teste de estabilidade
+
+// Resultado da ltima srie de repeties (janelas de frequncia sobre a mesma amostra).
+typedef struct {
+    float    Umidade_Media;
+    float    Desvio;            // Desvio-padro amostral
+    float    Semi_IC;           // Semi-intervalo de confiana de 95 % da mdia
+    float    Tolerancia;        // Semi-IC que encerraria a srie antes do alvo
+    uint16_t Amostras;          // Janelas aceitas
+    uint16_t Rejeitadas;        // Janelas descartadas como esprias
+    uint16_t Alvo;              // nr_repetition efetivo
+    bool     Parada_Antecipada; // Terminou por estabilidade antes do alvo
+} ResultadoRepeticao_t;
+
 /**
  * @brief Inicializa o handler de medio.
  */
@@ -40,6 +64,48 @@ void Medicao_Process(void);
  */
 void Medicao_Get_UltimaMedicao(DadosMedicao_t* dados);
 
+/**
+ * @brief Verifica se a balana assentou: as ltimas MEDICAO_JANELA_PESO
+ *        leituras cabem numa faixa de at 'faixa_max_g'.
+ * @param[out] peso_medio Mdia da janela (pode ser NULL).
+ */
+bool Medicao_Peso_Estavel(float faixa_max_g, float* peso_medio);
+
+/**
+ * @brief Descarta a janela de estabilidade (chamar aps mexer na cmara).
+ */
+void Medicao_Peso_Reiniciar_Janela(void);
+
+/**
+ * @brief Inicia uma srie de repeties sobre a amostra na cmara.
+ * @details A janela de frequncia passa a ter 'janela_ms' e  reiniciada
+ * aqui; cada janela vira uma leitura de umidade pela curva do gro ativo.
+ * A srie termina ao atingir nr_repetition leituras ou antes, quando o
+ * IC 95 % fica mais estreito que a tolerncia do gro. A mdia e o desvio
+ * vo para Umidade/Umidade_Desvio da medio; a janela volta a 1 s.
+ */
+void Medicao_Repeticao_Iniciar(uint16_t janela_ms);
+
+/**
+ * @brief Interrompe a srie em andamento sem alterar a umidade.
+ */
+void Medicao_Repeticao_Cancelar(void);
+
+/**
+ * @brief Indica se h uma srie de repeties em andamento.
+ */
+bool Medicao_Repeticao_Em_Andamento(void);
+
+/**
+ * @brief Obtm o resultado (parcial, se em andamento) da srie de repeties.
+ */
+void Medicao_Get_Repeticao(ResultadoRepeticao_t* resultado);
+
+/**
+ * @brief Obtm uma cpia das grandezas brutas da ltima aquisio.
+ */
+void Medicao_Get_Brutos(DadosBrutos_t* brutos);
+
 // --- Funes de atualizao para valores definidos externamente ---
 
 /**
@@ -47,6 +113,11 @@ void Medicao_Get_UltimaMedicao(DadosMedicao_t* dados);
  */
 void Medicao_Set_Temp_Instru(float temp_instru);
 
+/**
+ * @brief Registra o peso lquido da amostra medida (relativo  cmara vazia).
+ */
+void Medicao_Set_Peso_Amostra(float peso);
+
 /**
  * @brief Define a densidade do gro atual (usado para clculos futuros).
  */
@@ -0,0 +1,76 @@
+/*******************************************************************************
+ * @file        sequencia_handler.h
+ * @brief       Sequncia de medio: funil, raspador, balana, frequncia e
+ * temperatura coordenados por condies dos sensores.
+ * @details     Cada passo avana quando sua condio  satisfeita (degrau de
+ * peso, balana assentada, fim do curso do servo, srie de janelas de
+ * frequncia concluda), no por tempo fixo; o tempo s limita o passo
+ * (timeout -> falha). No ltimo passo o retorno do raspador, as janelas de
+ * frequncia, a captura do peso e a da temperatura correm em paralelo.
+ * Limiares, aberturas, varreduras e janela de frequncia vm da receita
+ * do produto ativo (Receita[] em GXXX_Equacoes.c), lida no incio do ciclo.
+ * A durao de cada passo do ltimo ciclo fica registrada.
+ ******************************************************************************/
+
+#ifndef SEQUENCIA_HANDLER_H
+#define SEQUENCIA_HANDLER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef enum {
+    SEQ_PASSO_OCIOSO,
+    SEQ_PASSO_VAZIO,        /**< Referncia da cmara vazia (balana assentada). */
+    SEQ_PASSO_ENCHE,        /**< Funil aberto at o degrau de peso. */
+    SEQ_PASSO_ASSENTA,      /**< Funil aberto at o peso parar de subir. */
+    SEQ_PASSO_RASPA,        /**< Funil fecha e o raspador varre o excesso. */
+    SEQ_PASSO_MEDE,         /**< Raspador retorna; frequncia, peso e temperatura. */
+    SEQ_PASSO_CONCLUIDO,
+    SEQ_PASSO_FALHA,
+    SEQ_NUM_PASSOS
+} SequenciaPasso_t;
+
+/** Tempos do ltimo ciclo (ms). */
+typedef struct {
+    uint32_t passo_ms[SEQ_NUM_PASSOS];
+    uint32_t ciclo_ms;
+    uint32_t ciclo_max_ms;     /**< Maior ciclo concludo desde o boot. */
+    uint32_t ciclos;           /**< Ciclos concludos. */
+    uint32_t falhas;
+} SequenciaTempos_t;
+
+void Sequencia_Init(void);
+
+/**
+ * @brief Avalia a condio do passo atual. Chamar no superloop (tarefa MEDICAO).
+ */
+void Sequencia_Process(void);
+
+/**
+ * @brief Inicia um ciclo. Ignorado se j houver um em andamento.
+ * @return true se o ciclo foi iniciado.
+ */
+bool Sequencia_Iniciar(void);
+
+/**
+ * @brief Interrompe o ciclo: fecha funil e raspador e cancela as repeties.
+ */
+void Sequencia_Abortar(void);
+
+SequenciaPasso_t Sequencia_Get_Passo(void);
+
+/**
+ * @brief true quando o peso da amostra do ciclo atual j foi capturado.
+ */
+bool Sequencia_Peso_Capturado(void);
+
+void Sequencia_Get_Tempos(SequenciaTempos_t* out);
+
+const char* Sequencia_Nome_Passo(SequenciaPasso_t passo);
+
+/**
+ * @brief ndice em Receita[] usado pelo ltimo ciclo iniciado.
+ */
+uint8_t Sequencia_Get_Receita(void);
+
+#endif // SEQUENCIA_HANDLER_H
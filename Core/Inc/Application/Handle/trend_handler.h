@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * @file        trend_handler.h
+ * @brief       Canal de tendncia (curvas) para o widget de grfico do DWIN.
+ * @details     Amostra peso, frequncia e Escala A, reduz por decimao
+ * mn/mx (picos continuam visveis) e envia os pontos em lote para o
+ * buffer de curvas dinmicas do DWIN (VP 0x0310), apenas nas telas de
+ * Monitor e Ajuste de Capacitncia.
+ ******************************************************************************/
+
+#ifndef TREND_HANDLER_H
+#define TREND_HANDLER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** Canais do grfico (ndice = canal de curva no DWIN). */
+typedef enum
+{
+    TREND_CANAL_PESO = 0,     /**< Peso em 0,1 g. */
+    TREND_CANAL_FREQUENCIA,   /**< Pulsos/s * 0,01 (mesma escala do VP FREQUENCIA). */
+    TREND_CANAL_ESCALA_A,     /**< Escala A * 10. */
+    TREND_NUM_CANAIS
+} TrendCanal_t;
+
+/** Parmetros de amostragem e envio. */
+typedef struct
+{
+    uint16_t periodo_amostra_ms;  /**< Intervalo entre amostras brutas. */
+    uint8_t  decimacao;           /**< Amostras por janela (cada janela gera 2 pontos: mn e mx). */
+    uint16_t periodo_envio_ms;    /**< Intervalo entre frames enviados ao display. */
+} TrendConfig_t;
+
+/**
+ * @brief Inicializa o canal de tendncia com a configurao padro.
+ */
+void Trend_Init(void);
+
+/**
+ * @brief Amostra e envia pontos quando a tela visvel exibe o grfico.
+ * @param tela_atual ID da tela atualmente exibida.
+ */
+void Trend_Process(uint16_t tela_atual);
+
+/**
+ * @brief Altera taxa de amostragem, decimao e taxa de envio.
+ * @return false se algum parmetro est fora da faixa aceita.
+ */
+bool Trend_Set_Config(const TrendConfig_t* config);
+
+/**
+ * @brief Copia a configurao atual.
+ */
+void Trend_Get_Config(TrendConfig_t* config);
+
+/**
+ * @brief Habilita/desabilita o envio de curvas.
+ */
+void Trend_Set_Enabled(bool habilitado);
+
+/**
+ * @brief Pontos descartados por falta de espao no buffer local.
+ */
+uint32_t Trend_Get_Pontos_Descartados(void);
+
+#endif // TREND_HANDLER_H
@@ -0,0 +1,79 @@
+#ifndef AGENDADOR_H
+#define AGENDADOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//================================================================================
+// Agendador Cooperativo
+//================================================================================
+// Tarefas so liberadas pela base de 1 ms (perodo) ou por Agendador_Sinalizar()
+// (ISR ou superloop). A prioridade  a posio na tabela: o ndice mais baixo
+// pronto executa primeiro. Sem nada pronto, o ncleo dorme em WFI at a
+// prxima interrupo.
+
+#define AGENDADOR_MAX_TAREFAS  16
+
+typedef void (*Funcao_Tarefa_t)(void);
+
+// Descrio esttica de uma tarefa (tabela em flash)
+typedef struct {
+    const char*     nome;
+    Funcao_Tarefa_t executar;
+    uint16_t        periodo_ms;    // 0: s executa quando sinalizada
+    uint16_t        deadline_ms;   // prazo entre a liberao e o fim da execuo
+} Tarefa_t;
+
+// Estatsticas por tarefa (tempos em microssegundos)
+typedef struct {
+    uint32_t execucoes;
+    uint32_t exec_total_us;
+    uint32_t wcet_us;              // pior tempo de execuo observado
+    uint32_t latencia_max_us;      // liberao -> incio
+    uint32_t deadlines_perdidos;
+    uint32_t liberacoes_perdidas;  // perodo venceu com a tarefa ainda pendente
+} TarefaStats_t;
+
+// Estatsticas globais (janela desde o ltimo reset)
+typedef struct {
+    uint32_t ocioso_ms;            // tempo dentro de WFI
+    uint32_t total_ms;
+    uint32_t dormidas;
+} AgendadorStats_t;
+
+/**
+ * @brief Instala a tabela de tarefas (deve permanecer vlida). Todas comeam
+ *        pendentes para executarem uma vez logo aps a inicializao.
+ */
+bool Agendador_Init(const Tarefa_t* tabela, uint8_t num_tarefas);
+
+/**
+ * @brief Marca a tarefa como pronta. Seguro em ISR; sinais repetidos antes da
+ *        execuo se acumulam em uma nica execuo.
+ */
+void Agendador_Sinalizar(uint8_t id);
+
+/**
+ * @brief Base de tempo de 1 ms (ISR do TIM14): libera as tarefas peridicas.
+ */
+void Agendador_Tick_ms(void);
+
+/**
+ * @brief Executa a tarefa pronta de maior prioridade.
+ * @return false se nenhuma estava pronta.
+ */
+bool Agendador_Executar(void);
+
+/**
+ * @brief Dorme (WFI) se nenhuma tarefa estiver pronta. A verificao e a
+ *        entrada no sono so atmicas: um sinal vindo de ISR no se perde.
+ */
+void Agendador_Ocioso(void);
+
+uint8_t Agendador_Num_Tarefas(void);
+const char* Agendador_Nome(uint8_t id);
+void Agendador_Get_Stats(AgendadorStats_t* out);
+void Agendador_Get_Stats_Tarefa(uint8_t id, TarefaStats_t* out);
+void Agendador_Reset_Stats(void);
+
+#endif // AGENDADOR_H
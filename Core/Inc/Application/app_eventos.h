@@ -2,6 +2,7 @@
 #define APP_EVENTOS_H
 
 #include <stdint.h>
+#include <stdbool.h>
 
 // Enumeração de todos os tipos de eventos possíveis no sistema
 typedef enum {
@@ -17,7 +18,11 @@ typedef enum {
     EV_SETTINGS_APPLIED,
     EV_SERVOS_SEQUENCE_STEP_CHANGED,
     EV_SERVOS_SEQUENCE_FINISHED,
-    EV_SYSTEM_TICK_1S,
+    EV_DWIN_FRAME_RECEIVED,
+    EV_CLI_COMMAND_READY,
+    EV_FREQ_JANELA,          // janela de frequência fechada (dados em Frequency_Get_Janela)
+    EV_SERVO_MOVIMENTO_FIM,  // perfil de movimento concluído (payload: ServoId_t)
+    EV_NUM_TIPOS
 } Tipo_Evento_t;
 
 // --- Estruturas de Dados (Payloads) para os Eventos ---
@@ -32,13 +37,103 @@ typedef enum {
     SERVO_STEP_FINISHED 
 } ServoStep_t;
 
+typedef enum {
+    SERVO_FUNIL,
+    SERVO_SCRAP,
+    NUM_SERVOS
+} ServoId_t;
+
+// Frame recebido do DWIN (copiado do buffer de RX do driver)
+#define EVENTO_FRAME_MAX 64
+typedef struct { uint16_t len; uint8_t data[EVENTO_FRAME_MAX]; } FramePayload_t;
+
+// Bloco do pool estático: comporta qualquer payload acima
+typedef union {
+    StringPayload_t   string;
+    DateTimePayload_t data_hora;
+    FramePayload_t    frame;
+    ServoStep_t       passo_servo;
+    ServoId_t         servo;
+} EventoPayload_t;
+
 // Estrutura principal de um evento
 typedef struct {
     Tipo_Evento_t type;
-    void* payload;
+    void* payload;   // bloco do pool (válido só durante o handler) ou NULL
 } Evento_t;
 
 // Definição do tipo de função para os "handlers" de eventos
 typedef void (*Funcao_Handler_Evento_t)(Evento_t event);
 
+// Aviso de publicação (ex.: acordar a tarefa que despacha a fila)
+typedef void (*Funcao_Aviso_Evento_t)(void);
+
+//================================================================================
+// Fila de Eventos
+//================================================================================
+
+#define EVENTOS_FILA_TAMANHO    16  // eventos pendentes
+#define EVENTOS_POOL_BLOCOS      4  // payloads simultâneos em uso
+#define EVENTOS_MAX_HANDLERS    12  // inscrições (tipo, handler)
+
+// Estatísticas globais da fila (tempos em microssegundos)
+typedef struct {
+    uint32_t publicados;
+    uint32_t despachados;
+    uint32_t descartados_fila;   // fila cheia
+    uint32_t descartados_pool;   // sem bloco de payload livre
+    uint8_t  profundidade;       // eventos pendentes agora
+    uint8_t  profundidade_max;
+    uint32_t latencia_max_us;    // publicação -> início do handler
+} EventosStats_t;
+
+// Estatísticas por tipo de evento
+typedef struct {
+    uint32_t contagem;
+    uint32_t exec_total_us;
+    uint32_t exec_max_us;
+} EventosTipoStats_t;
+
+/**
+ * @brief Inicializa fila, pool e tabela de handlers. Chamar antes dos módulos
+ *        que se inscrevem.
+ */
+void Eventos_Init(void);
+
+/**
+ * @brief Inscreve um handler para um tipo de evento (vários por tipo são permitidos).
+ */
+bool Eventos_Registrar(Tipo_Evento_t tipo, Funcao_Handler_Evento_t handler);
+
+/**
+ * @brief Instala o aviso chamado a cada publicação aceita (pode vir de ISR).
+ */
+void Eventos_Set_Aviso_Publicacao(Funcao_Aviso_Evento_t aviso);
+
+/**
+ * @brief Publica um evento sem payload. Seguro em ISR.
+ */
+bool Eventos_Post(Tipo_Evento_t tipo);
+
+/**
+ * @brief Publica um evento copiando 'tam' bytes para um bloco do pool. Seguro em ISR.
+ */
+bool Eventos_Post_Payload(Tipo_Evento_t tipo, const void* dados, uint16_t tam);
+
+/**
+ * @brief Executa os handlers de UM evento pendente (chamar no superloop).
+ * @return true se um evento foi despachado.
+ */
+bool Eventos_Dispatch(void);
+
+/**
+ * @brief Tempo em microssegundos a partir do SysTick (tick do HAL + contador).
+ */
+uint32_t Eventos_Tempo_us(void);
+
+void Eventos_Get_Stats(EventosStats_t* out);
+void Eventos_Get_Stats_Tipo(Tipo_Evento_t tipo, EventosTipoStats_t* out);
+void Eventos_Reset_Stats(void);
+const char* Eventos_Nome(Tipo_Evento_t tipo);
+
 #endif // APP_EVENTOS_H
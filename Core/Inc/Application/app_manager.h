@@ -23,25 +23,77 @@
 #include "ads1232_driver.h"
 #include "pcb_frequency.h"
 #include "temp_sensor.h"
+#include "rtc_driver.h"
 #include "servo_controle.h"
 #include "controller.h"
 #include "gerenciador_configuracoes.h"
+#include "deriva_termica.h"
 #include "medicao_handler.h"
+#include "sequencia_handler.h"
 #include "display_handler.h"
+#include "app_eventos.h"
+#include "log_diferido.h"
+#include "agendador.h"
+#include "perfil.h"
 #include <stdio.h>
 #include <string.h>
 
 typedef enum {
   STATE_ACTIVE,
   STATE_STOPPED,
-  STATE_CONFIRM_WAKEUP
+  STATE_CONFIRM_WAKEUP,
+  STATE_PREPARING_STOP,   // drenando TX e desligando o display
+  STATE_WAKING            // display religado, aguardando a primeira resposta
 } SystemState_t;
 
+/**
+ * @brief Instrumentao do ltimo ciclo STOP -> ativo (tempos em ms, a partir
+ *        do despertar, exceto entrada_stop_ms).
+ */
+typedef struct {
+  uint32_t despertares;
+  uint32_t entrada_stop_ms;      // pedido de sono -> STOP
+  uint32_t duracao_stop_s;       // pelo RTC (UINT32_MAX se desconhecida)
+  uint32_t display_pronto_ms;    // primeira resposta do display religado
+  uint32_t tela_confirmacao_ms;  // tela de confirmao enviada
+  uint32_t pronto_ms;            // confirmao recebida (inclui o tempo do usurio)
+  bool     display_timeout;      // display no respondeu em DISPLAY_BOOT_TIMEOUT_MS
+  bool     diag_executado;       // false = retomada rpida
+} WakeStats_t;
+
+/**
+ * @brief Tarefas do agendador no estado ativo, em ordem de prioridade
+ *        (ndice da tabela; ISRs sinalizam por estes IDs).
+ */
+typedef enum {
+  TAREFA_CLI_RX,
+  TAREFA_DWIN_RX,
+  TAREFA_EVENTOS,
+  TAREFA_CLI_TX,
+  TAREFA_DWIN_TX,
+  TAREFA_MEDICAO,
+  TAREFA_DISPLAY,
+  TAREFA_CONFIG,
+  TAREFA_DIAGNOSTICO,
+  NUM_TAREFAS_APP
+} TarefaApp_t;
+
+/**
+ * @brief Situao de um teste do autodiagnstico.
+ */
+typedef enum {
+    DIAG_PENDENTE,
+    DIAG_EM_ANDAMENTO,
+    DIAG_OK,
+    DIAG_FALHA
+} DiagStatus_t;
+
 /**
  * @brief Ponteiro de funo para um teste de diagnstico individual.
- * @return true em caso de sucesso, false em caso de falha.
+ *        Chamado repetidamente (sem bloquear) at retornar DIAG_OK ou DIAG_FALHA.
+ * @param inicio true na primeira chamada.
  */
-typedef bool (*DiagnosticTestFunc)(void);
+typedef DiagStatus_t (*DiagnosticTestFunc)(bool inicio);
 
 /**
  * @brief Estrutura que define uma nica etapa do autodiagnstico.
@@ -49,25 +101,64 @@ typedef bool (*DiagnosticTestFunc)(void);
 typedef struct {
     const char* description;         // Descrio para o log do console (printf)
     uint16_t    screen_id;           // ID da tela DWIN a ser exibida
-    uint32_t    display_time_ms;     // Tempo que a tela fica visvel
+    uint32_t    display_time_ms;     // Tempo MNIMO que a tela fica visvel
+    uint32_t    timeout_ms;          // Teste sem concluso neste prazo = falha
+    bool        critico;             // Falha interrompe e mostra a tela de erro
     DiagnosticTestFunc execute_test; // Ponteiro para a funo de teste
 } DiagnosticStep_t;
 
+#define DIAG_MAX_PASSOS 8
+
+/**
+ * @brief Resultado agregado da ltima execuo do autodiagnstico.
+ */
+typedef struct {
+    DiagStatus_t status;
+    uint32_t     duracao_ms;         // incio do autodiagnstico -> concluso do teste
+} DiagResultadoPasso_t;
+
+typedef struct {
+    bool     em_execucao;
+    bool     aprovado;               // nenhum teste crtico falhou
+    uint8_t  num_passos;
+    uint8_t  falhas;                 // crticas e no crticas
+    uint32_t inicio_ms;
+    uint32_t tempo_pronto_ms;        // incio -> liberao da tela de retorno
+    DiagResultadoPasso_t passos[DIAG_MAX_PASSOS];
+} DiagResultado_t;
+
 /**
  * @brief Inicializa todos os mdulos da aplicao em uma sequncia controlada.
  */
 void App_Manager_Init(void);
 
 /**
- * @brief Executa o loop de processamento principal da aplicao (Super-loop V8.2).
+ * @brief Executa uma volta do loop principal: no estado ativo, uma tarefa
+ *        pronta do agendador ou o sono em WFI.
  */
 void App_Manager_Process(void);
 
 // Funes de Callback para serem chamadas pela UI/Controller
 void App_Manager_Handle_Start_Process(void);
 void App_Manager_Handle_New_Password(const char* new_password);
+/**
+ * @brief Inicia o autodiagnstico (no bloqueante). Todos os testes comeam
+ *        juntos; as telas avanam quando o teste do passo concluiu e o tempo
+ *        mnimo de exibio passou. O resultado fica em App_Manager_Get_Diagnostico.
+ * @return false se j havia um autodiagnstico em andamento.
+ */
 bool App_Manager_Run_Self_Diagnostics(uint8_t return_tela);
 
+/**
+ * @brief Copia o resultado da ltima (ou atual) execuo do autodiagnstico.
+ */
+void App_Manager_Get_Diagnostico(DiagResultado_t* out);
+
+/**
+ * @brief Imprime no console o resultado agregado (status e tempo por passo).
+ */
+void App_Manager_Imprimir_Diagnostico(void);
+
 /**
  * @brief Solicita que o sistema entre no modo de baixo consumo (Stop).
  * Chamado pelo controller quando o boto de desligar  pressionado.
@@ -80,4 +171,19 @@ void App_Manager_Request_Sleep(void);
  */
 void App_Manager_Confirm_Wakeup(void);
 
+/**
+ * @brief Copia a instrumentao do ltimo despertar.
+ */
+void App_Manager_Get_Wake_Stats(WakeStats_t* out);
+
+/**
+ * @brief Imprime no console a instrumentao do ltimo despertar.
+ */
+void App_Manager_Imprimir_Wake(void);
+
+/**
+ * @brief Estado atual da mquina de alto nvel (telemetria/diagnstico).
+ */
+SystemState_t App_Manager_Get_State(void);
+
 #endif // APP_MANAGER_H
\ No newline at end of file
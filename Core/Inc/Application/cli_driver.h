@@ -4,34 +4,169 @@
 #define CLI_DRIVER_H
 
 #include "stm32c0xx_hal.h"
+#include "ads1232_driver.h"
 #include <stdbool.h>
 #include <stdint.h>
 
 /**
- * @brief Inicializa o driver CLI com a UART de depurao. (Inicia o RX IT de 1 byte).
+ * @brief Inicializa o driver CLI com a UART de depurao.
+ *        A recepo usa DMA circular com deteco de linha ociosa.
  */
 void CLI_Init(UART_HandleTypeDef* debug_huart);
 
 /**
- * @brief Processa comandos CLI pendentes (deve ser chamado no super-loop).
+ * @brief Consome o anel de RX, monta linhas e publica comandos completos
+ *        (deve ser chamado no super-loop).
  */
 void CLI_Process(void);
 
+/** Modo de interao do console. */
+typedef enum {
+    CLI_MODO_HUMANO = 0,  /**< Eco, edio, histrico (setas) e prompt. */
+    CLI_MODO_MAQUINA      /**< Sem eco nem prompt; cada resposta termina em "OK\r\n". */
+} CliModo_t;
+
+/** Contadores da recepo. */
+typedef struct {
+    uint32_t bytes_recebidos;
+    uint32_t bytes_perdidos;      /**< Anel do DMA sobrescrito antes da leitura. */
+    uint32_t comandos;
+    uint32_t linhas_descartadas;  /**< Linhas longas demais ou corrompidas. */
+    uint32_t erros_uart;
+} CliRxStats_t;
+
+/**
+ * @brief Reinicia a recepo por DMA (ex.: aps reinicializar a USART ao sair do modo Stop).
+ */
+void CLI_Restart_Rx(void);
+
+void CLI_Set_Modo(CliModo_t modo);
+CliModo_t CLI_Get_Modo(void);
+void CLI_Get_Rx_Stats(CliRxStats_t* out);
+
 /**
  * @brief "Bomba" de TX do CLI. Chamada pelo super-loop para enviar dados do FIFO via DMA.
  */
 void CLI_TX_Pump(void);
 
 bool CLI_Driver_IsTxBusy(void);
+
+/** Poltica quando o FIFO de TX no comporta a escrita inteira. */
+typedef enum {
+    CLI_TX_OVERFLOW_DROP_NEWEST = 0, /**< Enfileira o que couber e descarta o resto (padro). */
+    CLI_TX_OVERFLOW_DROP_OLDEST,     /**< Descarta os bytes mais antigos ainda no enviados. */
+    CLI_TX_OVERFLOW_WAIT             /**< Bombeia o DMA por tempo limitado antes de descartar. */
+} CliTxOverflowPolicy_t;
+
+/** Contadores do FIFO de TX do console. */
+typedef struct {
+    uint32_t bytes_enfileirados;
+    uint32_t bytes_descartados;
+    uint32_t escritas_truncadas;
+    uint16_t high_water;
+} CliTxStats_t;
+
 /**
  * @brief Funo de transmisso de baixo nvel para retarget.c (printf).
- * Adiciona um caractere ao FIFO de transmisso (atmico).
+ * Acumula o caractere numa linha; a linha inteira entra no FIFO de uma vez
+ * no '\n', quando o acumulador enche ou no prximo CLI_TX_Pump().
+ * @note  Somente contexto do superloop (no chamar em ISR).
  */
 void CLI_Printf_Transmit(uint8_t ch);
 
+/**
+ * @brief Enfileira um bloco no FIFO de TX com uma nica publicao (sem mascarar IRQs).
+ * @return Quantidade de bytes aceitos (menor que len se houve descarte).
+ * @note  Somente contexto do superloop.
+ */
+uint16_t CLI_Write(const uint8_t* data, uint16_t len);
+
+/** Tipos de frame binrio multiplexados no console (ver CLI_Write_Frame). */
+#define CLI_FRAME_TIPO_LOG          0x01
+#define CLI_FRAME_TIPO_TELEMETRIA   0x02
+#define CLI_FRAME_TIPO_TRANSICAO    0x03
+#define CLI_FRAME_PAYLOAD_MAX       48
+
+/**
+ * @brief Enfileira um frame binrio no mesmo fluxo do texto:
+ *        0x00 + COBS(tipo + payload + CRC16-CCITT LE) + 0x00.
+ *        O frame entra inteiro ou no entra (nunca  truncado).
+ * @return false se o payload excede CLI_FRAME_PAYLOAD_MAX ou no h espao no FIFO.
+ * @note  Somente contexto do superloop.
+ */
+bool CLI_Write_Frame(uint8_t tipo, const uint8_t* payload, uint16_t len);
+
+/**
+ * @brief Reserva o DMA de TX do console para um fluxo exclusivo (ticket da
+ *        impressora). Enquanto aberto, o FIFO no  bombeado: printf, logs e
+ *        frames ficam retidos e saem depois do fluxo, sem intercalar.
+ * @return false se j existe um fluxo aberto.
+ */
+bool CLI_Stream_Abrir(void);
+
+/**
+ * @brief Transmite um bloco do fluxo direto do buffer do chamador (sem cpia).
+ *        O buffer deve permanecer vlido at CLI_Stream_Livre().
+ * @return false se o DMA ainda est ocupado (controle de fluxo: tentar de novo
+ *         na prxima execuo da tarefa de TX).
+ */
+bool CLI_Stream_Enviar(const uint8_t* data, uint16_t len);
+
+bool CLI_Stream_Livre(void);
+void CLI_Stream_Fechar(void);
+
+void CLI_Set_Tx_Overflow_Policy(CliTxOverflowPolicy_t policy);
+CliTxOverflowPolicy_t CLI_Get_Tx_Overflow_Policy(void);
+void CLI_Get_Tx_Stats(CliTxStats_t* out);
+void CLI_Reset_Tx_Stats(void);
+
+/** Canais de telemetria (bit da mscara = ndice do canal, 4 bytes LE cada). */
+typedef enum {
+    TLM_CANAL_ADC_BRUTO = 0,  /**< int32: contagem do ADS1232 (sem tara). */
+    TLM_CANAL_PESO_G,         /**< float: peso em gramas. */
+    TLM_CANAL_PULSOS,         /**< uint32: pulsos na ltima janela de 1 s. */
+    TLM_CANAL_JANELA,         /**< uint32: nmero da janela de frequncia. */
+    TLM_CANAL_ESCALA_A,       /**< float: Escala A. */
+    TLM_CANAL_TEMP_INSTRU,    /**< float: temperatura do instrumento (C). */
+    TLM_CANAL_ESTADOS,        /**< uint32: estado da aplicao (bits 0..7) | tela (bits 16..31). */
+#if ADS1232_TEMP_INTERLEAVE
+    TLM_CANAL_TEMP_CELULA,    /**< float: temperatura da clula de carga, ADS1232 (C; -273 sem leitura). */
+#endif
+    TLM_NUM_CANAIS
+} TlmCanal_t;
+
+#define TLM_MASCARA_TODOS   ((uint16_t)((1u << TLM_NUM_CANAIS) - 1u))
+
+/** Mquinas cujas transies geram frames CLI_FRAME_TIPO_TRANSICAO. */
+typedef enum {
+    TLM_MAQUINA_APP = 0,      /**< SystemState_t do app_manager. */
+    TLM_MAQUINA_TELA          /**< Tela visvel do DWIN. */
+} TlmMaquina_t;
+
+typedef struct {
+    bool     ativo;
+    uint16_t periodo_ms;      /**< Intervalo entre amostras (>= 10 ms). */
+    uint16_t mascara;         /**< Canais includos em cada amostra. */
+} CliTelemetriaConfig_t;
+
+typedef struct {
+    uint32_t amostras_enviadas;
+    uint32_t amostras_descartadas;  /**< FIFO de TX sem espao para o frame. */
+    uint32_t transicoes_enviadas;
+} CliTelemetriaStats_t;
+
+/**
+ * @brief Configura o modo de telemetria. Amostras e transies saem como
+ *        frames binrios (CLI_Write_Frame) intercalados com o texto do CLI.
+ * @return false se o perodo ou a mscara so invlidos.
+ */
+bool CLI_Telemetria_Set_Config(const CliTelemetriaConfig_t* config);
+void CLI_Telemetria_Get_Config(CliTelemetriaConfig_t* config);
+void CLI_Telemetria_Get_Stats(CliTelemetriaStats_t* out);
+
 // --- Handlers de ISR (Chamados pelos Callbacks do HAL em stm32c0xx_it.c) ---
 void CLI_HandleTxCplt(UART_HandleTypeDef *huart);
-void CLI_HandleRxCplt(UART_HandleTypeDef *huart);
+void CLI_HandleRxEvent(UART_HandleTypeDef *huart, uint16_t size);
 void CLI_HandleError(UART_HandleTypeDef *huart);
 
 #endif // CLI_DRIVER_H
\ No newline at end of file
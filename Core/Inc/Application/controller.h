@@ -12,8 +12,10 @@
 #include "graos_handler.h"
 #include "app_manager.h"
 #include "relato.h"
+#include "app_eventos.h"
 #include <string.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <stdint.h> // Adicionar para usar uint8_t e uint16_t
 #include <stdbool.h>
@@ -33,7 +35,12 @@
 void Controller_DwinCallback(const uint8_t* data, uint16_t len);
 
 /**
- * @brief Retorna a tela que o controlador acredita estar ativa.
+ * @brief Handler do evento EV_DWIN_FRAME_RECEIVED: despacha o frame por endereo VP.
+ */
+void Controller_Handle_Frame_Event(Evento_t evento);
+
+/**
+ * @brief Retorna a tela visvel (pgina lida do DWIN; valor local como reserva).
  */
 uint16_t Controller_GetCurrentScreen(void);
 
@@ -42,4 +49,9 @@ uint16_t Controller_GetCurrentScreen(void);
  * Esta funo  usada por handlers externos (ex: autenticacao) para mudar de tela.
  */
 void Controller_SetScreen(uint16_t screen_id);
+
+/**
+ * @brief Callback registrado no DWIN Driver para eventos de troca de pgina.
+ */
+void Controller_PageChangeCallback(uint16_t pagina);
 #endif /* CONTROLLER_H */
\ No newline at end of file
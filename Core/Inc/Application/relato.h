@@ -12,10 +12,18 @@
 
 extern void Who_am_i(void);
 
-extern void Assinatura(void);
-extern void Cabecalho(void);
+/**
+ * @brief Inicia a impresso do ticket da ltima medio (no bloqueante).
+ * @return false se j h um ticket em andamento ou o canal est reservado.
+ */
+extern bool Relatorio_Printer(void);
 
-extern void Relatorio_Printer (void);
+/**
+ * @brief Avana a transmisso do ticket. Chamada pela tarefa de TX do console.
+ */
+extern void Relatorio_Process(void);
+
+extern bool Relatorio_Ocupado(void);
 
 
 
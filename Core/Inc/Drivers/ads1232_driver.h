@@ -3,6 +3,15 @@
 
 #include "main.h"
 #include <stdint.h>
+#include <stdbool.h>
+
+// Canal de temperatura (diodo do ADS1232) intercalado com o peso e a
+// compensao trmica da clula. Desligado: com o ganho do PGA desta placa o
+// diodo satura. Ligado, acrescenta o BTEMP, o canal TEMP_CELULA da telemetria
+// e a compensao no bloco de sensores da EEPROM.
+#ifndef ADS1232_TEMP_INTERLEAVE
+#define ADS1232_TEMP_INTERLEAVE 0   /**< 1 habilita (ex.: -DADS1232_TEMP_INTERLEAVE=1). */
+#endif
 
 // --- DEFINIES PARTILHADAS PARA CALIBRAO ---
 #define NUM_CAL_POINTS 4
@@ -15,12 +24,51 @@ typedef struct {
 // Declarao 'extern' para tornar a tabela visvel para outros ficheiros
 extern CalPoint_t cal_points[NUM_CAL_POINTS];
 
+// Estado da tara no bloqueante (alimentada pelo consumidor das converses)
+typedef enum {
+    ADS1232_TARA_OCIOSA,
+    ADS1232_TARA_EM_ANDAMENTO,
+    ADS1232_TARA_OK,
+    ADS1232_TARA_FALHOU      // no estabilizou: o offset anterior  mantido
+} ADS1232_TaraEstado_t;
+
+// Tipo da converso entregue por ADS1232_Ler_Intercalado
+typedef enum {
+    ADS1232_AMOSTRA_PESO,
+    ADS1232_AMOSTRA_TEMP,        // consumida pelo driver (filtro de temperatura)
+    ADS1232_AMOSTRA_DESCARTADA   // assentamento aps troca do pino TEMP
+} ADS1232_Amostra_t;
+
+#if ADS1232_TEMP_INTERLEAVE
+// Contadores da intercalao peso/temperatura desde o boot
+typedef struct {
+    uint32_t peso;
+    uint32_t temperatura;        // leituras de temperatura aceitas
+    uint32_t invalidas;          // fora da faixa plausvel (ex.: ganho != 1)
+    uint32_t descartadas;
+    uint16_t razao;              // leituras de peso por leitura de temperatura (0 = desligada, padro)
+    uint8_t  descarte;           // converses descartadas aps cada troca
+    uint16_t perda_peso_pm;      // converses no entregues como peso, em por mil
+} ADS1232_Intercalacao_t;
+
+// Modelo linear de deriva trmica da clula de carga
+typedef struct {
+    float t_ref_c;               // temperatura em que o span foi calibrado
+    float zero_cont_por_c;       // deriva do zero (contagens/C), relativa  temperatura da tara
+    float span_ppm_por_c;        // deriva do ganho (ppm/C), relativa a t_ref_c
+    bool  ativo;
+} ADS1232_CompTemp_t;
+#endif
+
 
 // --- Funes Pblicas ---
 void ADS1232_Init(void);
 int32_t ADS1232_Read(void);
 int32_t ADS1232_Read_Median_of_3(void);
 int32_t ADS1232_Tare(void);
+void ADS1232_Tare_Start(void);
+ADS1232_TaraEstado_t ADS1232_Tare_Feed(int32_t amostra);
+ADS1232_TaraEstado_t ADS1232_Tare_GetState(void);
 void ADS1232_SetCalibrationFactor(float factor);
 float ADS1232_ConvertToGrams(int32_t raw_value);
 int32_t ADS1232_GetOffset(void);
@@ -28,5 +76,16 @@ void ADS1232_SetOffset(int32_t new_offset);
 float ADS1232_GetCalibrationFactor(void);
 void Drv_ADS1232_DRDY_Callback(void);
 
+// --- Canal de temperatura intercalado ---
+ADS1232_Amostra_t ADS1232_Ler_Intercalado(int32_t* contagem);
+#if ADS1232_TEMP_INTERLEAVE
+void ADS1232_Set_Intercalacao(uint16_t razao, uint8_t descarte);
+void ADS1232_Get_Intercalacao(ADS1232_Intercalacao_t* out);
+bool ADS1232_Get_Temperatura(float* temp_c);
+// Aplica e grava no bloco de sensores; false se a gravao ficou para depois
+bool ADS1232_Set_Comp_Temp(const ADS1232_CompTemp_t* comp);
+void ADS1232_Get_Comp_Temp(ADS1232_CompTemp_t* out);
+#endif
+
 
 #endif // __ADS1232_DRIVER_H
\ No newline at end of file
@@ -11,16 +11,60 @@
  *
  * Utiliza DMA UART com IDLE line detect para RX, debounce de software para
  * montagem de pacotes, fila circular para TX com bombeamento via DMA.
+ *
+ * O TX  dividido em duas faixas (lanes): CONTROLE (troca de tela, comandos
+ * de sistema) tem prioridade sobre DADOS (escrita de VPs em massa). Cada
+ * comando aceito recebe um token; a concluso pode ser consultada por
+ * DWIN_Driver_IsTokenDone() ou notificada por callback, sempre executado no
+ * superloop dentro de DWIN_TX_Pump() (nunca no ISR).
+ *
+ * A pgina visvel  rastreada pelo prprio driver: trocas emitidas por
+ * DWIN_Driver_SetScreen() so publicadas ao concluir o TX e confirmadas pela
+ * leitura do registrador PIC_NOW (0x0014), feita periodicamente e logo aps
+ * cada evento de toque (navegao local do painel).
  *  
- * As funes so seguras para uso tanto no contexto de interrupo (no bloqueantes)
- * quanto no contexto principal (superloop).
+ * As funes so no bloqueantes, mas s podem ser chamadas do superloop:
+ * os ndices das filas de TX no so protegidos contra interrupo. No ISR
+ * ficam apenas os callbacks de fim de DMA/RX do HAL.
  *
  * @note Ajuste os tamanhos conforme capacidade e frequncia esperadas.
  */
 
 #define DWIN_RX_BUFFER_SIZE         64  /**< Tamanho do buffer DMA RX. */
-#define DWIN_TX_FIFO_SIZE          256  /**< Tamanho do buffer circular software para TX. */
+#define DWIN_TX_FIFO_SIZE          256  /**< Tamanho do buffer circular software para TX (lane DADOS). */
 #define DWIN_TX_DMA_BUFFER_SIZE     64  /**< Tamanho do buffer linear DMA TX. */
+#define DWIN_TX_CTRL_FIFO_SIZE      64  /**< Tamanho do buffer circular da lane CONTROLE. */
+#define DWIN_TX_CTRL_MAX_MSGS        8  /**< Comandos pendentes na lane CONTROLE. */
+#define DWIN_TX_DADOS_MAX_MSGS      16  /**< Comandos pendentes na lane DADOS. */
+
+/** Faixas de prioridade do TX (CONTROLE sempre esvazia antes de DADOS). */
+typedef enum
+{
+    DWIN_TX_LANE_CONTROLE = 0,
+    DWIN_TX_LANE_DADOS,
+    DWIN_TX_NUM_LANES
+} DWIN_TxLane_t;
+
+/** Token de concluso: lane nos 16 bits altos, sequncia nos 16 baixos. 0 = invlido. */
+typedef uint32_t dwin_tx_token_t;
+#define DWIN_TX_TOKEN_INVALIDO  ((dwin_tx_token_t)0u)
+
+/**
+ * Callback de concluso de TX (contexto do superloop). 'enviado'  false quando
+ * o comando foi descartado sem transmitir (reinicializao do driver): nesse
+ * caso a fila est sendo esvaziada e o callback no deve enfileirar comandos.
+ */
+typedef void (*dwin_tx_done_cb_t)(dwin_tx_token_t token, bool enviado, void* ctx);
+
+/** Estatsticas de uma lane de TX. */
+typedef struct
+{
+    uint32_t enfileirados;        /**< Comandos aceitos. */
+    uint32_t descartados;         /**< Comandos rejeitados por fila cheia. */
+    uint32_t bytes_descartados;   /**< Bytes dos comandos rejeitados. */
+    uint16_t high_water;          /**< Maior ocupao do FIFO (bytes). */
+    uint16_t capacidade;          /**< Tamanho do FIFO (bytes). */
+} DWIN_TxLaneStats_t;
 
 static const uint8_t CMD_AJUSTAR_BACKLIGHT_10[] = {0x5A, 0xA5, 0x05, 0x82, 0x00, 0x82, 0x0A, 0x00};
 static const uint8_t CMD_AJUSTAR_BACKLIGHT_100[] = {0x5A, 0xA5, 0x05, 0x82, 0x00, 0x82, 0x64, 0x00};
@@ -193,6 +237,11 @@ enum
 /** Callback para tratamento dos pacotes recebidos */
 typedef void (*dwin_rx_callback_t)(const uint8_t* buffer, uint16_t len);
 
+/** Callback de troca de pgina (contexto do superloop). */
+typedef void (*dwin_page_cb_t)(uint16_t pagina);
+
+#define DWIN_PAGINA_DESCONHECIDA  0xFFFFu
+
 /**
  * @brief Inicializa o driver DWIN.
  * @param huart Apontador para o handler da UART configurada para DWIN.
@@ -216,12 +265,85 @@ void DWIN_TX_Pump(void);
 bool DWIN_Driver_IsTxBusy(void);
 
 /**
- * @brief Envia um comando para alterar a tela no display.
+ * @brief Enfileira um comando cru numa lane especfica.
+ * @param lane Faixa de prioridade.
+ * @param data Frame completo (5A A5 ...).
+ * @param size Tamanho do frame; deve caber em DWIN_TX_DMA_BUFFER_SIZE.
+ * @param cb Callback de concluso (opcional, NULL se no usado).
+ * @param ctx Contexto repassado ao callback.
+ * @return true se enfileirado; false se a lane est cheia (contabilizado nas estatsticas).
+ */
+bool DWIN_Driver_Send(DWIN_TxLane_t lane, const uint8_t* data, uint16_t size,
+                      dwin_tx_done_cb_t cb, void* ctx);
+
+/**
+ * @brief Token do ltimo comando aceito na lane (DWIN_TX_TOKEN_INVALIDO se nenhum).
+ */
+dwin_tx_token_t DWIN_Driver_GetLastToken(DWIN_TxLane_t lane);
+
+/**
+ * @brief Indica se o comando identificado pelo token j foi transmitido.
+ */
+bool DWIN_Driver_IsTokenDone(dwin_tx_token_t token);
+
+/**
+ * @brief Associa um callback de concluso a um comando j enfileirado.
+ *        O callback  chamado uma nica vez: na transmisso ou, com
+ *        enviado = false, se o driver for reinicializado antes dela.
+ * @return true se registrado; false se o token j concluiu ou j possui callback.
+ */
+bool DWIN_Driver_NotifyWhenDone(dwin_tx_token_t token, dwin_tx_done_cb_t cb, void* ctx);
+
+/**
+ * @brief Espao livre (bytes) no FIFO da lane.
+ */
+uint16_t DWIN_Driver_GetTxFree(DWIN_TxLane_t lane);
+
+/**
+ * @brief Copia as estatsticas de TX da lane.
+ */
+void DWIN_Driver_GetTxStats(DWIN_TxLane_t lane, DWIN_TxLaneStats_t* out);
+
+/**
+ * @brief Zera contadores de TX (enfileirados, descartados, high-water).
+ */
+void DWIN_Driver_ResetTxStats(void);
+
+/**
+ * @brief Envia um comando para alterar a tela no display (lane CONTROLE).
  * @param screen_id ID da tela a ser selecionada.
  * @return true se o comando foi enfileirado; false se fila TX est cheia.
  */
 bool DWIN_Driver_SetScreen(uint16_t screen_id);
 
+/**
+ * @brief Retomada aps STOP sem reinicializar o driver: preserva as filas,
+ *        rearma a recepo s se necessrio e fora a releitura da pgina.
+ */
+void DWIN_Driver_Resume(void);
+
+/**
+ * @brief Total de frames vlidos recebidos do display. Um aumento aps
+ *        lig-lo indica que ele terminou o boot e responde.
+ */
+uint32_t DWIN_Driver_GetRxFrameCount(void);
+
+/**
+ * @brief Pgina atualmente exibida (DWIN_PAGINA_DESCONHECIDA at a primeira leitura).
+ */
+uint16_t DWIN_Driver_GetCurrentPage(void);
+
+/**
+ * @brief Registra a funo notificada quando a pgina visvel muda.
+ * @note  O registro  mantido entre reinicializaes do driver.
+ */
+void DWIN_Driver_SetPageChangeCallback(dwin_page_cb_t callback);
+
+/**
+ * @brief Antecipa a prxima leitura de PIC_NOW.
+ */
+void DWIN_Driver_RequestPageReadback(void);
+
 /**
  * @brief Envia um valor inteiro 16 bits para o display.
  * @param vp_address Endereo VP a ser escrito.
@@ -3,8 +3,32 @@
 
 #include "main.h"
 
+#define FREQ_JANELA_PADRAO_MS   1000u
+
+// Aviso de janela fechada (chamado no ISR do TIM14)
+typedef void (*Frequency_Aviso_t)(void);
+
 void Frequency_Init(void);
-void Frequency_Reset(void);
 uint32_t Frequency_Get_Pulse_Count(void);
 
-#endif /* INC_PCB_FREQUENCY_H_ */
\ No newline at end of file
+/**
+ * @brief Define a durao da janela de contagem e reinicia a janela atual
+ *        a partir de agora (a prxima janela fechada  completa).
+ */
+void Frequency_Set_Janela_ms(uint16_t janela_ms);
+
+void Frequency_Set_Aviso_Janela(Frequency_Aviso_t aviso);
+
+/**
+ * @brief Base de 1 ms (ISR do TIM14): fecha a janela e captura o contador no
+ *        prprio ISR, sem depender da latncia do superloop.
+ */
+void Frequency_Tick_ms(void);
+
+/**
+ * @brief ltima janela fechada.
+ * @return Nmero de sequncia da janela (incrementa a cada fechamento).
+ */
+uint32_t Frequency_Get_Janela(uint32_t* pulsos, uint16_t* janela_ms);
+
+#endif /* INC_PCB_FREQUENCY_H_ */
@@ -9,6 +9,7 @@ typedef struct {
     uint32_t           channel;      // Canal do timer
     uint16_t           min_pulse_us; // Pulso mnimo em microssegundos (valor calibrado para 0)
     uint16_t           max_pulse_us; // Pulso mximo em microssegundos (valor calibrado para 180)
+    uint16_t           pulso_atual_us; // ltimo valor escrito no CCR (0 = nenhum ainda)
 } Servo_t;
 
 /**
@@ -25,6 +26,22 @@ HAL_StatusTypeDef PWM_Servo_Init(Servo_t *servo);
  */
 void PWM_Servo_SetAngle(Servo_t *servo, float angle);
 
+/**
+ * @brief Converte um ngulo inteiro (0 a 180 graus) na largura de pulso calibrada.
+ * @param servo Ponteiro para a estrutura do servo.
+ * @param graus ngulo desejado; acima de 180  limitado.
+ * @return Largura do pulso em microssegundos.
+ */
+uint16_t PWM_Servo_Graus_Para_Pulso(const Servo_t *servo, uint8_t graus);
+
+/**
+ * @brief Define a largura do pulso diretamente, sem ponto flutuante.
+ * O CCR s  escrito quando o valor muda. Pode ser chamada de ISR.
+ * @param servo Ponteiro para a estrutura do servo.
+ * @param pulso_us Largura em microssegundos (limitada a [min_pulse_us, max_pulse_us]).
+ */
+void PWM_Servo_Set_Pulso_us(Servo_t *servo, uint16_t pulso_us);
+
 /**
  * @brief Para a gerao de PWM para um servo especfico.
  * @param servo Ponteiro para a estrutura do servo.
@@ -1,13 +1,56 @@
+/*******************************************************************************
+ * @file        temp_sensor.h
+ * @brief       Sensor de temperatura interno do MCU e tenso VDDA.
+ * @details     O ADC converte continuamente o sensor de temperatura e o
+ * VREFINT com sobreamostragem em hardware; o DMA (circular) mantm as
+ * ltimas varreduras em RAM. As leituras s fazem a mdia desse buffer e a
+ * conta inteira: no h espera de converso.
+ ******************************************************************************/
+
 #ifndef TEMP_SENSOR_H
 #define TEMP_SENSOR_H
 
 #include "main.h"
+#include <stdbool.h>
+
+#define TEMP_SENSOR_INVALIDO   (-27300)  /**< Centsimos de C devolvidos sem leitura vlida. */
+
+/**
+ * @brief Calibra o ADC e inicia a varredura contnua por DMA.
+ */
+void TempSensor_Init(void);
+
+/**
+ * @brief Para a varredura (antes do STOP).
+ */
+void TempSensor_Suspender(void);
+
+/**
+ * @brief Retoma a varredura aps o STOP. O buffer mantm as ltimas leituras.
+ */
+void TempSensor_Retomar(void);
+
+/**
+ * @brief true depois que o DMA preencheu o buffer ao menos uma vez.
+ */
+bool TempSensor_Pronto(void);
+
+/**
+ * @brief Temperatura interna em centsimos de C (s aritmtica inteira).
+ * @return TEMP_SENSOR_INVALIDO se ainda no h leitura.
+ */
+int32_t TempSensor_Get_Centi(void);
+
+/**
+ * @brief VDDA medida pelo VREFINT, em mV (0 se ainda no h leitura).
+ */
+uint16_t TempSensor_Get_VDDA_mV(void);
 
 /**
  * @brief L a temperatura do sensor interno do STM32.
  *
- * @return float O valor da temperatura em graus Celsius.
+ * @return float O valor da temperatura em graus Celsius (-273 sem leitura).
  */
 float TempSensor_GetTemperature(void);
 
-#endif // TEMP_SENSOR_H
\ No newline at end of file
+#endif // TEMP_SENSOR_H
@@ -1,6 +1,32 @@
 #ifndef GXXX_EQUACOES_H
 #define GXXX_EQUACOES_H
 
+/******************************************************************************
+  Receitas de Medio na ROM
+  Tempos e atuao por tipo de escoamento do produto. A PADRAO  a do pior
+  caso (farelos, ps e sementes midas); gros inteiros que escoam rpido
+  usam receitas mais curtas.
+******************************************************************************/
+enum {
+    RECEITA_PADRAO = 0,
+    RECEITA_MEDIO,      // trigo, sorgo
+    RECEITA_GRAUDO,     // soja, milho, feijes
+    NR_RECEITAS
+};
+
+struct Receita_ROM{
+    unsigned short Enche_Max_ms;      // limite para encher e para assentar a cmara
+    unsigned char  Degrau_g;          // ganho de peso que indica gro caindo
+    unsigned char  Faixa_Estavel_dg;  // balana assentada: faixa da janela, em 0,1 g
+    unsigned char  Ang_Funil;         // abertura do funil (graus)
+    unsigned char  Ang_Scrap;         // curso do raspador (graus)
+    unsigned char  Raspa_Passadas;    // varreduras do raspador
+    unsigned char  Reservado;
+    unsigned short Janela_ms;         // janela de frequncia
+};
+
+extern const struct Receita_ROM Receita[NR_RECEITAS];
+
 /******************************************************************************
   Curva de Calibrao na ROM
 ******************************************************************************/
@@ -16,6 +42,8 @@ struct Produtos_ROM{
     signed int 	   Peso_Pad;
     float 	       CT_Ganho;
     float 	       CT_Zero;
+    float          Tol_Rep;   // semi-IC 95% (% umidade) para encerrar as repeties; 0 = meia unidade da ltima casa exibida
+    unsigned char  Id_Receita; // ndice em Receita[]
 }; 
 
 #define NR_CEREAIS 7 // Ajustado para o nmero real de itens na sua tabela
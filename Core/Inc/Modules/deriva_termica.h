@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * @file        deriva_termica.h
+ * @brief       Compensao online da deriva trmica da frequncia (Escala A).
+ * @details     Aprende, por mnimos quadrados recursivos, a reta da
+ * frequncia com a cmara vazia em funo da temperatura do instrumento:
+ *
+ *     f_vazio = a + b * (T - T_ref)
+ *
+ * Cada janela de frequncia fechada com a cmara vazia e a balana assentada
+ *  uma amostra. A inclinao b corrige as leituras seguintes para T_ref,
+ * a temperatura em que a calibrao da Escala A vale sem correo. O modelo
+ * fica no bloco de sensores da EEPROM: a correo vale logo aps o STOP ou
+ * o boot, sem esperar o instrumento aquecer.
+ ******************************************************************************/
+
+#ifndef DERIVA_TERMICA_H
+#define DERIVA_TERMICA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct {
+    float    a_hz;          // frequncia com a cmara vazia em T_ref
+    float    b_hz_por_c;
+    float    t_ref_c;
+    float    desvio_b;      // incerteza de b (Hz/C), da covarincia e do rudo
+    float    ruido_hz;      // RMS do resduo das janelas aceitas nesta sesso
+    uint32_t amostras;
+    uint32_t rejeitadas;    // janelas descartadas pelo resduo nesta sesso
+    bool     ativa;
+    bool     confiavel;     // j viu variao de temperatura suficiente para b
+} DerivaInfo_t;
+
+/**
+ * @brief Carrega o modelo da configurao. Chamar aps a restaurao da EEPROM.
+ */
+void Deriva_Init(void);
+
+/**
+ * @brief Acrescenta uma janela medida com a cmara vazia.
+ * @param frequencia_hz Frequncia sem correo.
+ * @param temp_c        Temperatura do instrumento na janela.
+ */
+void Deriva_Aprender(float frequencia_hz, float temp_c);
+
+/**
+ * @brief Frequncia referida a T_ref. Sem modelo confivel (ou desativado)
+ *        devolve a prpria frequncia.
+ */
+float Deriva_Corrigir(float frequencia_hz, float temp_c);
+
+/**
+ * @brief Grava o modelo na configurao se houver amostras novas.
+ * @return false se o gerenciador estava ocupado (tentar depois).
+ */
+bool Deriva_Salvar(void);
+
+/**
+ * @brief Descarta o aprendizado (mantm T_ref e o estado ativo).
+ */
+void Deriva_Reset(void);
+
+void Deriva_Set_Ativa(bool ativa);
+
+/**
+ * @brief Muda a temperatura de referncia. O termo a  reescrito para a
+ *        nova referncia; a inclinao aprendida  mantida.
+ */
+void Deriva_Set_Referencia(float t_ref_c);
+
+void Deriva_Get_Info(DerivaInfo_t* info);
+
+#endif // DERIVA_TERMICA_H
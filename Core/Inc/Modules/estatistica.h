@@ -0,0 +1,48 @@
+/*******************************************************************************
+ * @file        estatistica.h
+ * @brief       Mdia e varincia incrementais (Welford) com rejeio online.
+ * @details     Nenhuma leitura individual  guardada: o acumulador mantm s
+ * a contagem, a mdia e a soma dos quadrados dos desvios (M2). Uma leitura
+ * que se afasta da mdia mais que ESTATISTICA_K_REJEICAO desvios 
+ * descartada antes de entrar no acumulador.
+ ******************************************************************************/
+
+#ifndef ESTATISTICA_H
+#define ESTATISTICA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ESTATISTICA_K_REJEICAO      3.0f  /**< Limite de rejeio, em desvios-padro. */
+#define ESTATISTICA_MIN_REJEICAO    3u    /**< Amostras aceitas antes de comear a rejeitar. */
+#define ESTATISTICA_MAX_AMOSTRAS    20u   /**< Maior n com t de Student tabelado; acima usa o ltimo (conservador). */
+
+typedef struct {
+    uint16_t n;           // amostras aceitas
+    uint16_t rejeitadas;
+    float    media;
+    float    m2;          // soma dos quadrados dos desvios em relao  mdia
+} Estatistica_t;
+
+void Estatistica_Reset(Estatistica_t* est);
+
+/**
+ * @brief Acumula uma leitura, salvo se for considerada espria.
+ * @param piso Desvio mnimo usado no teste de rejeio (evita descartar
+ *             tudo quando as primeiras leituras saem idnticas).
+ * @return false se a leitura foi rejeitada.
+ */
+bool Estatistica_Adicionar(Estatistica_t* est, float x, float piso);
+
+/**
+ * @brief Desvio-padro amostral (n-1). Zero com menos de 2 amostras.
+ */
+float Estatistica_Desvio(const Estatistica_t* est);
+
+/**
+ * @brief Semi-largura do intervalo de confiana de 95 % da mdia
+ *        (t de Student * s / raiz(n)). Infinito com menos de 2 amostras.
+ */
+float Estatistica_Semi_IC95(const Estatistica_t* est);
+
+#endif // ESTATISTICA_H
@@ -14,6 +14,7 @@
 
 #include "main.h"
 #include "eeprom_driver.h"
+#include "ads1232_driver.h"
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -49,6 +50,33 @@ typedef struct {
 	char Empresa[20];
 } Config_Usuario_t;
 
+/**
+ * @brief Modelo de deriva trmica da frequncia com a cmara vazia
+ *        (f = coef[0] + coef[1]*(T - t_ref_c)), mantido por deriva_termica.c.
+ */
+typedef struct {
+    float    coef[2];       // Hz e Hz/C
+    float    p[3];          // covarincia do RLS: P11, P12, P22
+    float    t_ref_c;       // temperatura do instrumento em que Cal A vale sem correo
+    uint32_t amostras;      // janelas aprendidas desde o ltimo reset
+    uint8_t  ativa;
+    uint8_t  preenchimento[3];
+} Config_Deriva_t;
+
+#if ADS1232_TEMP_INTERLEAVE
+/**
+ * @brief Compensao de temperatura da clula de carga (BTEMP COMP), aplicada
+ *        por ads1232_driver.c s leituras de peso.
+ */
+typedef struct {
+    float    t_ref_c;           // temperatura em que o span foi ajustado
+    float    zero_cont_por_c;   // deriva do zero (contagens/C)
+    float    span_ppm_por_c;    // deriva do span (ppm/C)
+    uint8_t  ativo;
+    uint8_t  preenchimento[3];
+} Config_CompCelula_t;
+#endif
+
 typedef struct {
     uint32_t versao_struct;
     uint8_t indice_idioma_selecionado;
@@ -66,6 +94,28 @@ typedef struct {
     uint32_t crc; // IMPORTANTE: O campo CRC deve ser o ltimo membro da struct
 } Config_Aplicacao_t;
 
+/**
+ * @brief Dados que o firmware aprende ou ajusta em campo. Ficam num bloco
+ *        prprio, depois das 3 cpias de Config_Aplicacao_t: gravaes
+ *        frequentes e pequenas no reescrevem a configurao principal, que
+ *        mantm tamanho e endereos. Cada cpia ocupa uma fatia fixa
+ *        (SENSORES_BLOCK_SIZE) para o bloco poder crescer no mesmo lugar.
+ */
+typedef struct {
+    uint32_t versao;
+    Config_Deriva_t deriva;
+#if ADS1232_TEMP_INTERLEAVE
+    Config_CompCelula_t comp_celula;
+#endif
+    uint32_t crc; // ltimo membro, como em Config_Aplicacao_t
+} Config_Sensores_t;
+
+#if ADS1232_TEMP_INTERLEAVE
+#define CONFIG_SENSORES_VERSAO  2u   // 2: compensao da clula
+#else
+#define CONFIG_SENSORES_VERSAO  1u
+#endif
+
 //==============================================================================
 // Mapeamento de Memria
 //==============================================================================
@@ -79,6 +129,13 @@ typedef struct {
 
 #define END_OF_CONFIG_DATA    (ADDR_CONFIG_BACKUP2 + CONFIG_BLOCK_SIZE)
 
+// Bloco de sensores (2 cpias) logo aps a configurao principal
+#define SENSORES_BLOCK_SIZE     128u   // >= sizeof(Config_Sensores_t)
+#define ADDR_SENSORES_PRIMARY   END_OF_CONFIG_DATA
+#define ADDR_SENSORES_BACKUP    (ADDR_SENSORES_PRIMARY + SENSORES_BLOCK_SIZE)
+
+#define END_OF_SENSORES_DATA    (ADDR_SENSORES_BACKUP + SENSORES_BLOCK_SIZE)
+
 
 //==============================================================================
 // API Pblica do Mdulo
@@ -92,6 +149,8 @@ void Gerenciador_Config_Init(CRC_HandleTypeDef* hcrc);
 
 /**
  * @brief Valida as cpias na EEPROM e carrega a configurao vlida para o cache.
+ * @details Tambm carrega o bloco de sensores (padres se nenhuma cpia  vlida,
+ *          sem afetar o retorno).
  * @note  Esta  uma funo bloqueante, ideal para a inicializao do sistema.
  * @return true se uma cpia vlida foi encontrada, false se os padres de fbrica foram carregados.
  */
@@ -109,9 +168,34 @@ void Carregar_Configuracao_Padrao(void);
  */
 void Gerenciador_Config_Run_FSM(void);
 
+/**
+ * @brief true enquanto h alterao do cache (configurao ou sensores) ainda
+ *        no gravada na EEPROM.
+ */
+bool Gerenciador_Config_Salvamento_Pendente(void);
+
 // --- Funes "Get" e "Set" (a interface para o resto da aplicao) ---
 
-void Gerenciador_Config_Get_Config_Snapshot(Config_Aplicacao_t* config_out);
+/**
+ * @brief Viso somente-leitura do cache (sem cpia).
+ * @note  O contedo s muda pelas funes Set, no mesmo contexto do superloop;
+ *        no guarde dados derivados entre tarefas sem comparar a verso.
+ */
+const Config_Aplicacao_t* Gerenciador_Config_Get_View(void);
+
+/**
+ * @brief Viso somente-leitura de um gro do cache (sem cpia).
+ * @return NULL se o ndice  invlido.
+ */
+const Config_Grao_t* Gerenciador_Config_Get_Grao_View(uint8_t indice);
+
+/**
+ * @brief Verso da tabela de gros (nomes, curvas, faixas): muda s quando a
+ *        tabela inteira  substituda (restaurao da EEPROM ou padres de
+ *        fbrica). Os demais Set no mexem nela. Quem guarda dados derivados
+ *        dos gros (ndice de pesquisa) refaz s quando muda.
+ */
+uint32_t Gerenciador_Config_Get_Versao_Graos(void);
 
 bool Gerenciador_Config_Set_Indice_Idioma(uint8_t novo_indice);
 bool Gerenciador_Config_Get_Indice_Idioma(uint8_t* indice);
@@ -125,9 +209,31 @@ bool Gerenciador_Config_Get_Grao_Ativo(uint8_t* indice_ativo);
 bool Gerenciador_Config_Get_Dados_Grao(uint8_t indice, Config_Grao_t* dados_grao);
 uint8_t Gerenciador_Config_Get_Num_Graos(void);
 
+/**
+ * @brief Acesso somente-leitura ao nome do gro no cache (sem cpia).
+ * @return NULL se o ndice  invlido.
+ */
+const char* Gerenciador_Config_Get_Nome_Grao(uint8_t indice);
+
 bool Gerenciador_Config_Set_Cal_A(float gain, float zero);
 bool Gerenciador_Config_Get_Cal_A(float* gain, float* zero);
 
+/**
+ * @brief Modelo de deriva no bloco de sensores. O Set s  recusado enquanto
+ *        o prprio bloco de sensores est sendo gravado.
+ */
+bool Gerenciador_Config_Set_Deriva(const Config_Deriva_t* deriva);
+bool Gerenciador_Config_Get_Deriva(Config_Deriva_t* deriva);
+
+#if ADS1232_TEMP_INTERLEAVE
+/**
+ * @brief Compensao de temperatura da clula, no bloco de sensores
+ *        (mesma regra do Set_Deriva).
+ */
+bool Gerenciador_Config_Set_Comp_Celula(const Config_CompCelula_t* comp);
+bool Gerenciador_Config_Get_Comp_Celula(Config_CompCelula_t* comp);
+#endif
+
 bool Gerenciador_Config_Set_NR_Repetitions(uint16_t nr_repetitions);
 uint16_t Gerenciador_Config_Get_NR_Repetition(void);
 
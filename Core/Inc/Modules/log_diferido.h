@@ -0,0 +1,123 @@
+/*******************************************************************************
+ * @file        log_diferido.h
+ * @brief       Log binrio diferido com formatao no host.
+ * @details     O ponto de chamada grava apenas um registro compacto (ID da
+ * mensagem, timestamp e at 4 argumentos de 32 bits) numa fila em RAM, sem
+ * vfprintf nem formatao de float. O superloop drena a fila pelo console
+ * (USART1) em frames binrios; o texto  montado no PC pelo decodificador a
+ * partir do dicionrio log_mensagens.def.
+ *
+ * Uso:
+ *   LOG0(CFG_SALVAMENTO_COMPLETO);
+ *   LOG1(BAL_TARA_OK, offset);
+ *   LOG1(SIS_TEMP_INICIAL, LOG_F(temperatura));
+ ******************************************************************************/
+
+#ifndef LOG_DIFERIDO_H
+#define LOG_DIFERIDO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+/** Nveis de severidade (ordem crescente). */
+typedef enum {
+    LOG_NIVEL_DEBUG = 0,
+    LOG_NIVEL_INFO,
+    LOG_NIVEL_AVISO,
+    LOG_NIVEL_ERRO,
+    LOG_NIVEL_OFF          /**< Apenas como filtro: desliga o mdulo. */
+} LogNivel_t;
+
+/** Mdulos com filtro de nvel independente em tempo de execuo. */
+typedef enum {
+    LOG_MOD_SISTEMA = 0,
+    LOG_MOD_CONFIG,
+    LOG_MOD_EEPROM,
+    LOG_MOD_BALANCA,
+    LOG_MOD_MEDICAO,
+    LOG_NUM_MODULOS
+} LogModulo_t;
+
+/**
+ * Nvel mnimo compilado. Chamadas abaixo dele viram cdigo morto e so
+ * removidas pelo compilador (defina no projeto para sobrescrever).
+ */
+#ifndef LOG_NIVEL_COMPILACAO
+#define LOG_NIVEL_COMPILACAO LOG_NIVEL_DEBUG
+#endif
+
+#define LOG_MAX_ARGS      4
+#define LOG_FILA_TAMANHO 16   /**< Registros em RAM (potncia de 2). */
+
+/** IDs das mensagens, na ordem do dicionrio. */
+typedef enum {
+#define LOG_MSG(nome, modulo, nivel, formato) LOG_ID_##nome,
+#include "log_mensagens.def"
+#undef LOG_MSG
+    LOG_NUM_MENSAGENS
+} LogId_t;
+
+/** Mdulo e nvel de cada mensagem, resolvidos em tempo de compilao. */
+enum {
+#define LOG_MSG(nome, modulo, nivel, formato) LOG_MD_##nome = (modulo), LOG_NV_##nome = (nivel),
+#include "log_mensagens.def"
+#undef LOG_MSG
+    LOG_MD_NV_FIM_
+};
+
+/** Reinterpreta um float como palavra de 32 bits (o host converte de volta). */
+static inline uint32_t LOG_F(float valor)
+{
+    uint32_t bits;
+    memcpy(&bits, &valor, sizeof(bits));
+    return bits;
+}
+
+#define LOG_EMITIR_(nome, n, a, b, c, d)                                              \
+    do {                                                                              \
+        if ((int)LOG_NV_##nome >= (int)LOG_NIVEL_COMPILACAO) {                        \
+            Log_Registrar(LOG_ID_##nome, (LogModulo_t)LOG_MD_##nome,                  \
+                          (LogNivel_t)LOG_NV_##nome, (n), (uint32_t)(a),              \
+                          (uint32_t)(b), (uint32_t)(c), (uint32_t)(d));               \
+        }                                                                             \
+    } while (0)
+
+#define LOG0(nome)                LOG_EMITIR_(nome, 0u, 0u, 0u, 0u, 0u)
+#define LOG1(nome, a)             LOG_EMITIR_(nome, 1u, (a), 0u, 0u, 0u)
+#define LOG2(nome, a, b)          LOG_EMITIR_(nome, 2u, (a), (b), 0u, 0u)
+#define LOG3(nome, a, b, c)       LOG_EMITIR_(nome, 3u, (a), (b), (c), 0u)
+#define LOG4(nome, a, b, c, d)    LOG_EMITIR_(nome, 4u, (a), (b), (c), (d))
+
+/** Contadores da fila de log. */
+typedef struct {
+    uint32_t registrados;
+    uint32_t filtrados;     /**< Rejeitados pelo nvel do mdulo. */
+    uint32_t perdidos;      /**< Fila cheia. */
+    uint32_t enviados;
+} LogStats_t;
+
+/**
+ * @brief Zera a fila e aplica o nvel padro (INFO) a todos os mdulos.
+ */
+void Log_Init(void);
+
+/**
+ * @brief Grava um registro na fila (use as macros LOGn). Seguro em ISR.
+ */
+void Log_Registrar(LogId_t id, LogModulo_t modulo, LogNivel_t nivel, uint8_t nargs,
+                   uint32_t a, uint32_t b, uint32_t c, uint32_t d);
+
+/**
+ * @brief Drena registros pendentes para o console. Chamar no superloop.
+ */
+void Log_Process(void);
+
+void Log_Set_Nivel(LogModulo_t modulo, LogNivel_t nivel);
+LogNivel_t Log_Get_Nivel(LogModulo_t modulo);
+void Log_Get_Stats(LogStats_t* out);
+void Log_Reset_Stats(void);
+const char* Log_Nome_Modulo(LogModulo_t modulo);
+const char* Log_Nome_Nivel(LogNivel_t nivel);
+
+#endif // LOG_DIFERIDO_H
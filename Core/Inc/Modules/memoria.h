@@ -0,0 +1,42 @@
+/*******************************************************************************
+ * @file        memoria.h
+ * @brief       Contabilidade de RAM: oramento esttico e pico da pilha.
+ * @details     A pilha (Stack_Size no startup)  pintada com um padro no
+ * incio do main; a marca d'gua  a primeira palavra alterada a partir da
+ * base. A ocupao esttica vem dos smbolos do linker (RW_IRAM1).
+ * O relatrio por mdulo e a verificao do oramento no build ficam em
+ * Tools/mem_report.py, que l o .map e o MEMORIA_ORCAMENTO_RAM_BYTES
+ * deste arquivo.
+ ******************************************************************************/
+
+#ifndef MEMORIA_H
+#define MEMORIA_H
+
+#include <stdint.h>
+
+#define MEMORIA_RAM_TOTAL_BYTES      (24u * 1024u)   /**< SRAM do STM32C071. */
+#define MEMORIA_ORCAMENTO_RAM_BYTES  (23u * 1024u)   /**< RW + ZI + pilha; acima disso o build falha. */
+#define MEMORIA_STACK_BYTES          0x400u          /**< Deve ser igual ao Stack_Size do startup_stm32c071xx.s. */
+#define MEMORIA_PADRAO_STACK         0xC5C5C5C5u
+
+typedef struct {
+    uint32_t ram_total;
+    uint32_t ram_usada;          // RW + ZI, inclui a pilha
+    uint32_t stack_total;
+    uint32_t stack_usada_max;    // marca d'gua desde o boot
+} MemoriaInfo_t;
+
+/**
+ * @brief Preenche a rea livre da pilha com o padro. Chamar uma nica vez,
+ *        o mais cedo possvel no main (antes dos inits).
+ */
+void Memoria_Pintar_Stack(void);
+
+/**
+ * @brief Menor folga da pilha j observada (bytes nunca escritos).
+ */
+uint32_t Memoria_Stack_Livre_Min(void);
+
+void Memoria_Get_Info(MemoriaInfo_t* out);
+
+#endif // MEMORIA_H
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * @file        perfil.h
+ * @brief       Profiler de tempo de execuo baseado no TIM3 (1 us, livre).
+ * @details     O Cortex-M0+ no tem contador de ciclos (DWT); o TIM3 roda
+ * livre a 1 MHz e  estendido pelo tick do HAL para intervalos longos.
+ * Mede:
+ *  - pontos de instrumentao (handlers): chamadas, tempo total e mximo;
+ *  - perodo do loop principal: histograma em faixas de potncia de 2;
+ *  - ISRs: latncia de entrada (TIM14: contador do prprio timer desde o
+ *    evento de update; EXTI: variao do intervalo entre entradas, vlida
+ *    para fontes peridicas como o DRDY do ADS1232) e durao do handler.
+ * Com PERFIL_HABILITADO = 0 as macros somem e o custo  zero.
+ ******************************************************************************/
+
+#ifndef PERFIL_H
+#define PERFIL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef PERFIL_HABILITADO
+#define PERFIL_HABILITADO 1   /**< 0 remove toda a instrumentao (ex.: -DPERFIL_HABILITADO=0). */
+#endif
+
+/** Pontos de instrumentao (handlers do loop principal). */
+typedef enum {
+    PERFIL_PONTO_CLI_RX,
+    PERFIL_PONTO_DWIN_RX,
+    PERFIL_PONTO_EVENTOS,
+    PERFIL_PONTO_CLI_TX,
+    PERFIL_PONTO_DWIN_TX,
+    PERFIL_PONTO_MEDICAO,
+    PERFIL_PONTO_DISPLAY,
+    PERFIL_PONTO_CONFIG,
+    PERFIL_NUM_PONTOS
+} PerfilPonto_t;
+
+/** Fontes de interrupo monitoradas. */
+typedef enum {
+    PERFIL_ISR_TIM14,
+    PERFIL_ISR_USART1,
+    PERFIL_ISR_USART2,
+    PERFIL_ISR_EXTI,
+    PERFIL_NUM_ISR
+} PerfilIsr_t;
+
+#define PERFIL_HIST_FAIXAS  12   /**< Faixa i: perodo < 2^(i+4) us; a ltima acumula o resto. */
+
+/** Marca de tempo: tick do HAL + contador de 16 bits do TIM3. */
+typedef struct {
+    uint32_t ms;
+    uint16_t us;
+} PerfilMarca_t;
+
+typedef struct {
+    uint32_t chamadas;
+    uint32_t total_us;
+    uint32_t max_us;
+} PerfilPontoStats_t;
+
+typedef struct {
+    uint32_t amostras;
+    uint32_t latencia_total_us;
+    uint32_t latencia_max_us;
+    uint32_t exec_max_us;
+} PerfilIsrStats_t;
+
+typedef struct {
+    uint32_t voltas;
+    uint32_t periodo_max_us;
+    uint32_t histograma[PERFIL_HIST_FAIXAS];
+} PerfilLoopStats_t;
+
+#if PERFIL_HABILITADO
+
+#define PERFIL_INICIO(ponto)   PerfilMarca_t perfil_marca_##ponto = Perfil_Marcar()
+#define PERFIL_FIM(ponto)      Perfil_Registrar((ponto), perfil_marca_##ponto)
+#define PERFIL_LOOP()          Perfil_Loop()
+#define PERFIL_ISR_ENTRADA(f)  Perfil_Isr_Entrada(f)
+#define PERFIL_ISR_SAIDA(f)    Perfil_Isr_Saida(f)
+
+/**
+ * @brief Configura o TIM3 livre a 1 MHz (chamar antes de qualquer marca).
+ */
+void Perfil_Init(void);
+
+PerfilMarca_t Perfil_Marcar(void);
+
+/**
+ * @brief Microssegundos desde a marca (resoluo de 1 us at ~60 ms, depois 1 ms).
+ */
+uint32_t Perfil_Decorrido_us(PerfilMarca_t marca);
+
+void Perfil_Registrar(PerfilPonto_t ponto, PerfilMarca_t inicio);
+void Perfil_Loop(void);
+void Perfil_Isr_Entrada(PerfilIsr_t fonte);
+void Perfil_Isr_Saida(PerfilIsr_t fonte);
+
+void Perfil_Get_Ponto(PerfilPonto_t ponto, PerfilPontoStats_t* out);
+void Perfil_Get_Isr(PerfilIsr_t fonte, PerfilIsrStats_t* out);
+void Perfil_Get_Loop(PerfilLoopStats_t* out);
+void Perfil_Reset(void);
+const char* Perfil_Nome_Ponto(PerfilPonto_t ponto);
+const char* Perfil_Nome_Isr(PerfilIsr_t fonte);
+
+#else
+
+#define PERFIL_INICIO(ponto)   ((void)0)
+#define PERFIL_FIM(ponto)      ((void)0)
+#define PERFIL_LOOP()          ((void)0)
+#define PERFIL_ISR_ENTRADA(f)  ((void)0)
+#define PERFIL_ISR_SAIDA(f)    ((void)0)
+#define Perfil_Init()          ((void)0)
+
+#endif // PERFIL_HABILITADO
+
+#endif // PERFIL_H
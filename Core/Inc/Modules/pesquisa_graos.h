@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * @file        pesquisa_graos.h
+ * @brief       ndice de pesquisa por nome de gro.
+ * @details     Construdo uma vez a partir dos nomes do cache de configurao:
+ * chaves normalizadas (sem caixa e sem acento) e um mapa de bits por bigrama
+ * (hash em PESQUISA_BUCKETS baldes) que reduz cada consulta a alguns ANDs de
+ * bitsets antes da verificao por substring. Digitar mais um caractere
+ * refina o resultado anterior em vez de varrer todos os gros. Os
+ * resultados ficam num bitset, sem limite fixo, e as pginas so extradas
+ * sob demanda.
+ * A busca aproximada (tolerante a erros de digitao) usa o algoritmo
+ * bit-paralelo de Myers sobre os nomes nos seis idiomas da tabela Produto[]
+ * e ordena os gros pela menor distncia de edio encontrada.
+ ******************************************************************************/
+
+#ifndef PESQUISA_GRAOS_H
+#define PESQUISA_GRAOS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define PESQUISA_BUCKETS 64   /**< Baldes de bigrama (potncia de 2). */
+#define PESQUISA_IDIOMAS   6   /**< Idiomas de Produto[].Nome[] usados na busca aproximada. */
+#define PESQUISA_MAX_ERROS 2   /**< Distncia mxima aceita na busca aproximada. */
+
+/** Tipo da ltima consulta (define a ordem dos resultados). */
+typedef enum
+{
+    PESQUISA_EXATA = 0,    /**< Substring no nome do cache, em ordem de ndice. */
+    PESQUISA_APROXIMADA    /**< Menor distncia primeiro; empate por ndice. */
+} PesquisaModo_t;
+
+/**
+ * @brief (Re)constri o ndice a partir dos nomes atuais e zera a consulta.
+ */
+void PesquisaGraos_Construir(void);
+
+/**
+ * @brief Executa a consulta (substring, sem caixa/acento). Termo vazio
+ *        seleciona todos os gros.
+ * @return Nmero de resultados.
+ */
+uint16_t PesquisaGraos_Buscar(const char* termo);
+
+/**
+ * @brief Consulta tolerante a erros (insero, remoo, troca de caractere).
+ *        Erros aceitos: 0 at 3 caracteres, 1 at 6, PESQUISA_MAX_ERROS acima.
+ *        Custo fixo: MAX_GRAOS x PESQUISA_IDIOMAS nomes, O(1) palavra por caractere.
+ * @return Nmero de resultados.
+ */
+uint16_t PesquisaGraos_Buscar_Aproximada(const char* termo);
+
+/**
+ * @brief Tipo da ltima consulta executada.
+ */
+PesquisaModo_t PesquisaGraos_Get_Modo(void);
+
+/**
+ * @brief Nmero de resultados da ltima consulta.
+ */
+uint16_t PesquisaGraos_Num_Resultados(void);
+
+/**
+ * @brief Obtm o ndice do gro na posio 'posicao' do resultado.
+ * @return false se a posio est fora do resultado.
+ */
+bool PesquisaGraos_Obter(uint16_t posicao, uint8_t* indice_grao);
+
+/**
+ * @brief Normaliza um caractere (Latin-1) para comparao:
+ *        minscula, sem acento; no alfanumricos viram espao.
+ */
+char PesquisaGraos_Normalizar(char c);
+
+#endif // PESQUISA_GRAOS_H
@@ -2,6 +2,8 @@
 #define SERVO_CONTROLE_H
 
 #include "main.h"
+#include "app_eventos.h" // ServoId_t
+#include <stdbool.h>
 
 /**
  * @brief Inicializa o mdulo de controle dos servos.
@@ -9,19 +11,37 @@
 void Servos_Init(void);
 
 /**
- * @brief Processa a mquina de estados e atualiza a posio dos servos.
- * Deve ser chamada repetidamente no loop principal.
+ * @brief Comanda o funil (aberto = deixa o gro cair na cmara).
  */
-void Servos_Process(void);
+void Servos_Set_Funil(bool aberto);
 
 /**
- * @brief Inicia a sequncia de movimento dos servos.
+ * @brief Comanda o raspador da cmara (aberto = varre o excesso).
  */
-void Servos_Start_Sequence(void);
+void Servos_Set_Scrap(bool aberto);
 
 /**
- * @brief Decrementa os temporizadores internos de controle dos servos.
- * Esta funo DEVE ser chamada a cada 1ms por uma interrupo de timer (ex: SysTick).
+ * @brief Aberturas (graus) usadas pelos prximos comandos de abrir. Um servo
+ * j aberto mantm a abertura atual at fechar.
+ */
+void Servos_Set_Aberturas(uint8_t graus_funil, uint8_t graus_scrap);
+
+/**
+ * @brief true enquanto algum perfil de movimento (ou o assentamento que o
+ * segue) no terminou. Os servos no tm realimentao de posio.
+ */
+bool Servos_Em_Movimento(void);
+
+/**
+ * @brief Durao de um curso completo (abrir ou fechar) com a abertura
+ * atual, incluindo o assentamento. til para dimensionar timeouts.
+ */
+uint32_t Servos_Tempo_Curso_ms(ServoId_t id);
+
+/**
+ * @brief Avana os perfis de movimento e publica EV_SERVO_MOVIMENTO_FIM ao
+ * fim de cada um. Esta funo DEVE ser chamada a cada 1ms por uma
+ * interrupo de timer (TIM14).
  */
 void Servos_Tick_ms(void);
 
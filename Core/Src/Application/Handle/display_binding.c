@@ -0,0 +1,247 @@
+/*******************************************************************************
+ * @file        display_binding.c
+ * @brief       Implementao do motor de vnculo VP <-> fonte de dados.
+ * @details     Substitui as rotinas de atualizao peridica escritas  mo
+ * (monitor, relgio). Para adicionar uma tela basta declarar a tabela de
+ * vnculos e inclu-la em s_telas[].
+ ******************************************************************************/
+
+#include "display_binding.h"
+#include "dwin_driver.h"
+#include "medicao_handler.h"
+#include "rtc_driver.h"
+#include "temp_sensor.h"
+#include "main.h" // Para HAL_GetTick
+#include <stdio.h>
+#include <string.h>
+
+//================================================================================
+// Fontes de Dados
+//================================================================================
+
+static bool Fonte_Frequencia(float* valor)
+{
+    DadosMedicao_t dados;
+    Medicao_Get_UltimaMedicao(&dados);
+    *valor = dados.Frequencia;
+    return true;
+}
+
+static bool Fonte_Escala_A(float* valor)
+{
+    DadosMedicao_t dados;
+    Medicao_Get_UltimaMedicao(&dados);
+    *valor = dados.Escala_A;
+    return true;
+}
+
+static bool Fonte_Temp_Instru(float* valor)
+{
+    // A leitura do sensor do MCU  feita sob demanda, no ritmo do vnculo
+    float temp_mcu = TempSensor_GetTemperature();
+    Medicao_Set_Temp_Instru(temp_mcu);
+    *valor = temp_mcu;
+    return true;
+}
+
+static bool Fonte_Hora(char* buf, uint8_t tam)
+{
+    uint8_t h, m, s;
+    if (!RTC_Driver_GetTime(&h, &m, &s)) return false;
+    snprintf(buf, tam, "%02u:%02u:%02u", h, m, s);
+    return true;
+}
+
+static bool Fonte_Data(char* buf, uint8_t tam)
+{
+    uint8_t d, mo, a;
+    if (!RTC_Driver_GetDate(&d, &mo, &a)) return false;
+    snprintf(buf, tam, "%02u/%02u/%02u", d, mo, a);
+    return true;
+}
+
+//================================================================================
+// Tabelas de Vnculo por Tela
+//================================================================================
+
+static const DisplayBinding_t s_bind_monitor[] = {
+    // VP           Formato         Fonte numrica     Fonte texto  Escala  Perodo  Len
+    { FREQUENCIA,   BIND_FMT_INT32, Fonte_Frequencia,  NULL,        0.01f,  1000,    0 },
+    { ESCALA_A,     BIND_FMT_INT32, Fonte_Escala_A,    NULL,        10.0f,  1000,    0 },
+    { TEMP_INSTRU,  BIND_FMT_INT16, Fonte_Temp_Instru, NULL,        10.0f,  5000,    0 },
+};
+
+static const DisplayBinding_t s_bind_principal[] = {
+    { HORA_SISTEMA, BIND_FMT_TEXTO, NULL,              Fonte_Hora,  1.0f,   1000,    8 },
+    { DATA_SISTEMA, BIND_FMT_TEXTO, NULL,              Fonte_Data,  1.0f,   1000,    8 },
+};
+
+#define BIND_TELA(id, tabela) { (id), (tabela), (uint8_t)(sizeof(tabela) / sizeof((tabela)[0])) }
+
+static const DisplayScreenBindings_t s_telas[] = {
+    BIND_TELA(TELA_MONITOR_SYSTEM, s_bind_monitor),
+    BIND_TELA(TELA_ADJUST_CAPA,    s_bind_monitor),
+    BIND_TELA(PRINCIPAL,           s_bind_principal),
+};
+static const size_t NUM_TELAS = sizeof(s_telas) / sizeof(s_telas[0]);
+
+//================================================================================
+// Estado do Agendador
+//================================================================================
+
+#define TELA_NENHUMA 0xFFFFu
+
+static const DisplayScreenBindings_t* s_tela = NULL;
+static uint16_t s_tela_id = TELA_NENHUMA;
+static uint8_t  s_num_bindings = 0;
+static uint32_t s_ultima_amostra[BINDING_MAX_POR_TELA];
+static uint32_t s_ultimo_valor[BINDING_MAX_POR_TELA];  // valor emitido (ou hash do texto)
+static uint8_t  s_forcar_emissao = 0;                  // bit i: emitir mesmo sem mudana
+
+//================================================================================
+// Funes Privadas
+//================================================================================
+
+static uint32_t Hash_Texto(const char* txt)
+{
+    uint32_t h = 2166136261u; // FNV-1a
+    while (*txt != '\0')
+    {
+        h ^= (uint8_t)*txt++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static uint16_t Tamanho_Frame(const DisplayBinding_t* b)
+{
+    switch (b->formato)
+    {
+        case BIND_FMT_INT16: return 8u;
+        case BIND_FMT_INT32: return 10u;
+        default:             return (uint16_t)(6u + b->max_len + 2u);
+    }
+}
+
+static void Selecionar_Tela(uint16_t tela_atual)
+{
+    s_tela_id = tela_atual;
+    s_tela = NULL;
+    s_num_bindings = 0;
+
+    for (size_t i = 0; i < NUM_TELAS; i++)
+    {
+        if (s_telas[i].tela == tela_atual)
+        {
+            s_tela = &s_telas[i];
+            s_num_bindings = s_telas[i].num_bindings;
+            if (s_num_bindings > BINDING_MAX_POR_TELA)
+            {
+                s_num_bindings = BINDING_MAX_POR_TELA;
+            }
+            break;
+        }
+    }
+
+    s_forcar_emissao = (uint8_t)((1u << s_num_bindings) - 1u);
+}
+
+/**
+ * @brief Amostra a fonte e envia o VP se o valor mudou (ou se forado).
+ * @return false se o driver recusou o frame (fila cheia).
+ */
+static bool Emitir_Binding(uint8_t i, const DisplayBinding_t* b)
+{
+    bool forcar = (s_forcar_emissao & (1u << i)) != 0u;
+    uint32_t valor;
+    float num = 0.0f;
+    char texto[BINDING_TEXTO_MAX + 1];
+
+    if (b->formato == BIND_FMT_TEXTO)
+    {
+        if ((b->fonte_txt == NULL) || !b->fonte_txt(texto, sizeof(texto))) return true;
+        valor = Hash_Texto(texto);
+    }
+    else
+    {
+        if ((b->fonte_num == NULL) || !b->fonte_num(&num)) return true;
+        valor = (uint32_t)(int32_t)(num * b->escala);
+    }
+
+    if (!forcar && (valor == s_ultimo_valor[i]))
+    {
+        return true; // sem mudana: nada a transmitir
+    }
+
+    bool ok;
+    switch (b->formato)
+    {
+        case BIND_FMT_INT16: ok = DWIN_Driver_WriteInt(b->vp, (int16_t)(int32_t)valor); break;
+        case BIND_FMT_INT32: ok = DWIN_Driver_WriteInt32(b->vp, (int32_t)valor);        break;
+        default:             ok = DWIN_Driver_WriteString(b->vp, texto, b->max_len);    break;
+    }
+
+    if (ok)
+    {
+        s_ultimo_valor[i] = valor;
+        s_forcar_emissao &= (uint8_t)~(1u << i);
+    }
+    return ok;
+}
+
+//================================================================================
+// Funes Pblicas
+//================================================================================
+
+void DisplayBinding_Init(void)
+{
+    s_tela = NULL;
+    s_tela_id = TELA_NENHUMA;
+    s_num_bindings = 0;
+    s_forcar_emissao = 0;
+    memset(s_ultima_amostra, 0, sizeof(s_ultima_amostra));
+    memset(s_ultimo_valor, 0, sizeof(s_ultimo_valor));
+}
+
+void DisplayBinding_Process(uint16_t tela_atual)
+{
+    if (tela_atual != s_tela_id)
+    {
+        Selecionar_Tela(tela_atual);
+    }
+
+    if (s_tela == NULL)
+    {
+        return;
+    }
+
+    const uint32_t agora = HAL_GetTick();
+
+    for (uint8_t i = 0; i < s_num_bindings; i++)
+    {
+        const DisplayBinding_t* b = &s_tela->bindings[i];
+        bool forcar = (s_forcar_emissao & (1u << i)) != 0u;
+
+        if (!forcar && ((agora - s_ultima_amostra[i]) < b->periodo_ms))
+        {
+            continue;
+        }
+
+        // Sem espao na lane de dados: tenta de novo no prximo ciclo
+        if (DWIN_Driver_GetTxFree(DWIN_TX_LANE_DADOS) < Tamanho_Frame(b))
+        {
+            break;
+        }
+
+        if (!Emitir_Binding(i, b))
+        {
+            break;
+        }
+        s_ultima_amostra[i] = agora;
+    }
+}
+
+void DisplayBinding_Invalidate(void)
+{
+    s_tela_id = TELA_NENHUMA;
+}
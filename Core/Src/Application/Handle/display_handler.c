@@ -9,6 +9,8 @@
  ******************************************************************************/
 
 #include "display_handler.h"
+#include "display_binding.h"
+#include "trend_handler.h"
 
 
 //================================================================================
@@ -18,31 +20,18 @@
 #define DWIN_VP_ENTRADA_TELA 0x0050 // Valor padro enviado pelo DWIN ao entrar em uma tela de edio
 #define DWIN_VP_ENTRADA_SERVICO 0x0000
 
-// --- Mquina de Estados para a Sequncia de Medio ---
+// --- Acompanhamento da Sequncia de Medio (sequencia_handler.c) ---
 typedef enum {
-    MEDE_STATE_IDLE,
-    MEDE_STATE_ENCHE_CAMARA,
-    MEDE_STATE_AJUSTANDO,
-    MEDE_STATE_RASPA_CAMARA,
-    MEDE_STATE_PESO_AMOSTRA,
-    MEDE_STATE_TEMP_SAMPLE,
-    MEDE_STATE_UMIDADE,
-    MEDE_STATE_MOSTRA_RESULTADO
-} MedeState_t;
-
-static MedeState_t s_mede_state = MEDE_STATE_IDLE;
-static uint32_t s_mede_last_tick = 0;
-static const uint32_t MEDE_INTERVAL_MS = 1000;
-
-// --- FSM de Atualizao do Monitor ---
-static uint32_t s_monitor_last_tick = 0;
-static const uint32_t MONITOR_UPDATE_INTERVAL_MS = 1000;
-static uint8_t s_temp_update_counter = 0;
-static const uint8_t TEMP_UPDATE_PERIOD_SECONDS = 5;
-
-// --- Atualizao do Relgio ---
-static uint32_t s_clock_last_tick = 0;
-static const uint32_t CLOCK_UPDATE_INTERVAL_MS = 1000;
+    MEDE_TELA_NENHUMA,
+    MEDE_TELA_ENCHE,
+    MEDE_TELA_AJUSTANDO,
+    MEDE_TELA_RASPA,
+    MEDE_TELA_PESO,
+    MEDE_TELA_UMIDADE,
+} MedeTela_t;
+
+static bool s_mede_ativo = false;
+static MedeTela_t s_mede_tela = MEDE_TELA_NENHUMA;
 
 // --- Estado do Mdulo ---
 static bool s_printing_enabled = true;
@@ -50,31 +39,34 @@ static bool s_printing_enabled = true;
 //================================================================================
 // Prottipos de Funes Privadas
 //================================================================================
-static void UpdateMonitorScreen(void);
-static void UpdateClockOnMainScreen(void);
 static void ProcessMeasurementSequenceFSM(void);
+static MedeTela_t Tela_Do_Passo(SequenciaPasso_t passo);
 
 //================================================================================
 // Implementao das Funes Pblicas
 //================================================================================
 
 void DisplayHandler_Init(void) {
-    s_mede_state = MEDE_STATE_IDLE;
+    s_mede_ativo = false;
     s_printing_enabled = true;
+    DisplayBinding_Init();
+    Trend_Init();
 }
 
 void DisplayHandler_Process(void) {
     ProcessMeasurementSequenceFSM();
-    UpdateMonitorScreen();
-    UpdateClockOnMainScreen();
+    // Atualizaes peridicas (monitor, relgio) so declaradas em display_binding.c
+    uint16_t tela_atual = Controller_GetCurrentScreen();
+    DisplayBinding_Process(tela_atual);
+    Trend_Process(tela_atual);
+    Graos_Process();
 }
 
 void Display_StartMeasurementSequence(void) {
-    if (s_mede_state == MEDE_STATE_IDLE) {
+    if (!s_mede_ativo && Sequencia_Iniciar()) {
         printf("DISPLAY: Iniciando sequencia de medicao...\r\n");
-        s_mede_state = MEDE_STATE_ENCHE_CAMARA;
-        s_mede_last_tick = HAL_GetTick();
-        DWIN_Driver_SetScreen(MEDE_ENCHE_CAMARA);
+        s_mede_ativo = true;
+        s_mede_tela = MEDE_TELA_NENHUMA;
     }
 }
 
@@ -84,20 +76,19 @@ void Display_ProcessPrintEvent(uint16_t received_value)
 
     if (received_value == 0x0000) // Valor para "mostrar resultado na tela"
     {
-        Config_Grao_t dados_grao;
         uint8_t indice_grao;
         Gerenciador_Config_Get_Grao_Ativo(&indice_grao);
-        Gerenciador_Config_Get_Dados_Grao(indice_grao, &dados_grao);
+        const Config_Grao_t* dados_grao = Gerenciador_Config_Get_Grao_View(indice_grao);
 
         DadosMedicao_t dados_medicao;
         Medicao_Get_UltimaMedicao(&dados_medicao);
         
         uint16_t casas_decimais = Gerenciador_Config_Get_NR_Decimals();
 
-        DWIN_Driver_WriteString(GRAO_A_MEDIR, dados_grao.nome, MAX_NOME_GRAO_LEN);
-        DWIN_Driver_WriteInt(CURVA, dados_grao.id_curva);
-        DWIN_Driver_WriteInt(UMI_MIN, (int16_t)(dados_grao.umidade_min * 10));
-        DWIN_Driver_WriteInt(UMI_MAX, (int16_t)(dados_grao.umidade_max * 10));
+        DWIN_Driver_WriteString(GRAO_A_MEDIR, dados_grao->nome, MAX_NOME_GRAO_LEN);
+        DWIN_Driver_WriteInt(CURVA, dados_grao->id_curva);
+        DWIN_Driver_WriteInt(UMI_MIN, (int16_t)(dados_grao->umidade_min * 10));
+        DWIN_Driver_WriteInt(UMI_MAX, (int16_t)(dados_grao->umidade_max * 10));
 
         if (casas_decimais == 1) {
             DWIN_Driver_WriteInt(UMIDADE_1_CASA, (int16_t)(dados_medicao.Umidade * 10.0f));
@@ -109,7 +100,10 @@ void Display_ProcessPrintEvent(uint16_t received_value)
     }
     else // Valor para "imprimir relatrio fsico"
     {
-        Relatorio_Printer();
+        // Ticket anterior ainda saindo: avisa em vez de descartar o pedido em silncio
+        if (!Relatorio_Printer()) {
+            DWIN_Driver_WriteString(VP_MESSAGES, "Impressora ocupada!", strlen("Impressora ocupada!"));
+        }
     }
 }
 
@@ -262,114 +256,56 @@ bool Display_IsPrintingEnabled(void) {
 //================================================================================
 
 /**
- * @brief Mquina de estados NO-BLOQUEANTE para a sequncia de medio.
- * Substitui a funo bloqueante Telas_Mede().
+ * @brief Acompanha a sequncia de medio e troca a tela conforme o passo.
+ * Os passos avanam por sensores em sequencia_handler.c; aqui s se
+ * exibe o progresso e, ao final, o resultado.
  */
 static void ProcessMeasurementSequenceFSM(void) {
-    if (s_mede_state == MEDE_STATE_IDLE) {
+    if (!s_mede_ativo) {
         return;
     }
 
-    if (HAL_GetTick() - s_mede_last_tick < MEDE_INTERVAL_MS) {
-        return;
-    }
-    s_mede_last_tick = HAL_GetTick();
-
-    switch (s_mede_state) {
-        case MEDE_STATE_ENCHE_CAMARA:
-            s_mede_state = MEDE_STATE_AJUSTANDO;
-            DWIN_Driver_SetScreen(MEDE_AJUSTANDO);
-            break;
-        case MEDE_STATE_AJUSTANDO:
-            s_mede_state = MEDE_STATE_RASPA_CAMARA;
-            DWIN_Driver_SetScreen(MEDE_RASPA_CAMARA);
-            break;
-        case MEDE_STATE_RASPA_CAMARA:
-            s_mede_state = MEDE_STATE_PESO_AMOSTRA;
-            DWIN_Driver_SetScreen(MEDE_PESO_AMOSTRA);
-            break;
-        case MEDE_STATE_PESO_AMOSTRA:
-            s_mede_state = MEDE_STATE_TEMP_SAMPLE;
-            DWIN_Driver_SetScreen(MEDE_TEMP_SAMPLE);
-            break;
-        case MEDE_STATE_TEMP_SAMPLE:
-            s_mede_state = MEDE_STATE_UMIDADE;
-            DWIN_Driver_SetScreen(MEDE_UMIDADE);
-            break;
-        case MEDE_STATE_UMIDADE:
-            s_mede_state = MEDE_STATE_MOSTRA_RESULTADO;
-            Display_ProcessPrintEvent(0x0000); // 0x0000 para "mostrar resultado na tela"
-            break;
-        case MEDE_STATE_MOSTRA_RESULTADO:
-            s_mede_state = MEDE_STATE_IDLE;
-            printf("DISPLAY: Sequencia de medicao finalizada.\r\n");
-            break;
-        default:
-            s_mede_state = MEDE_STATE_IDLE;
-            break;
-    }
-}
+    SequenciaPasso_t passo = Sequencia_Get_Passo();
 
-/**
- * @brief Lgica movida de app_manager.c (Task_Update_Display_FSM).
- * Atualiza os VPs da tela de Monitor/Ajuste a cada 1 segundo.
- */
-static void UpdateMonitorScreen(void) {
-    if (HAL_GetTick() - s_monitor_last_tick < MONITOR_UPDATE_INTERVAL_MS) {
+    if (passo == SEQ_PASSO_CONCLUIDO) {
+        s_mede_ativo = false;
+        Display_ProcessPrintEvent(0x0000); // 0x0000 para "mostrar resultado na tela"
+        printf("DISPLAY: Sequencia de medicao finalizada.\r\n");
         return;
     }
-    s_monitor_last_tick = HAL_GetTick();
-
-    uint16_t tela_atual = Controller_GetCurrentScreen();
-    if (tela_atual != TELA_MONITOR_SYSTEM && tela_atual != TELA_ADJUST_CAPA) {
-        s_temp_update_counter = 0;
+    if ((passo == SEQ_PASSO_FALHA) || (passo == SEQ_PASSO_OCIOSO)) {
+        s_mede_ativo = false;
+        DWIN_Driver_SetScreen(MSG_ERROR);
         return;
     }
-    
-    if (DWIN_Driver_IsTxBusy()) {
+
+    MedeTela_t tela = Tela_Do_Passo(passo);
+    if (tela == s_mede_tela) {
         return;
     }
-
-    DadosMedicao_t dados_atuais;
-    Medicao_Get_UltimaMedicao(&dados_atuais);
-
-    int32_t frequencia_para_dwin = (int32_t)(dados_atuais.Frequencia * 0.01f);
-    DWIN_Driver_WriteInt32(FREQUENCIA, frequencia_para_dwin);
-
-    int32_t escala_a_para_dwin = (int32_t)(dados_atuais.Escala_A * 10.0f);
-    DWIN_Driver_WriteInt32(ESCALA_A, escala_a_para_dwin);
-
-    s_temp_update_counter++;
-    if (s_temp_update_counter >= TEMP_UPDATE_PERIOD_SECONDS) {
-        s_temp_update_counter = 0;
-        float temp_mcu = TempSensor_GetTemperature();
-        Medicao_Set_Temp_Instru(temp_mcu);
-        
-        int16_t temperatura_para_dwin = (int16_t)(temp_mcu * 10.0f);
-        DWIN_Driver_WriteInt(TEMP_INSTRU, temperatura_para_dwin);
+    s_mede_tela = tela;
+
+    switch (tela) {
+        case MEDE_TELA_ENCHE:     DWIN_Driver_SetScreen(MEDE_ENCHE_CAMARA); break;
+        case MEDE_TELA_AJUSTANDO: DWIN_Driver_SetScreen(MEDE_AJUSTANDO);    break;
+        case MEDE_TELA_RASPA:     DWIN_Driver_SetScreen(MEDE_RASPA_CAMARA); break;
+        case MEDE_TELA_PESO:      DWIN_Driver_SetScreen(MEDE_PESO_AMOSTRA); break;
+        case MEDE_TELA_UMIDADE:   DWIN_Driver_SetScreen(MEDE_UMIDADE);      break;
+        default: break;
     }
 }
 
 /**
- * @brief Lgica movida de app_manager.c (Task_Update_Clock).
- * Atualiza o relgio na tela principal a cada segundo.
+ * @brief No passo MEDE a tela mostra o peso at ele ser capturado e depois
+ * a umidade (as janelas de frequncia j esto correndo desde o incio).
  */
-static void UpdateClockOnMainScreen(void) {
-    if (HAL_GetTick() - s_clock_last_tick < CLOCK_UPDATE_INTERVAL_MS) {
-        return;
+static MedeTela_t Tela_Do_Passo(SequenciaPasso_t passo) {
+    switch (passo) {
+        case SEQ_PASSO_VAZIO:
+        case SEQ_PASSO_ENCHE:   return MEDE_TELA_ENCHE;
+        case SEQ_PASSO_ASSENTA: return MEDE_TELA_AJUSTANDO;
+        case SEQ_PASSO_RASPA:   return MEDE_TELA_RASPA;
+        case SEQ_PASSO_MEDE:    return Sequencia_Peso_Capturado() ? MEDE_TELA_UMIDADE : MEDE_TELA_PESO;
+        default:                return MEDE_TELA_NENHUMA;
     }
-    s_clock_last_tick = HAL_GetTick();
-
-    if (Controller_GetCurrentScreen() == PRINCIPAL) {
-        char time_buf[9];
-        char date_buf[9];
-        uint8_t h, m, s, d, mo, y;
-
-        if (RTC_Driver_GetTime(&h, &m, &s) && RTC_Driver_GetDate(&d, &mo, &y)) {
-            sprintf(time_buf, "%02d:%02d:%02d", h, m, s);
-            sprintf(date_buf, "%02d/%02d/%02d", d, mo, y);
-            DWIN_Driver_WriteString(HORA_SISTEMA, time_buf, 8);
-            DWIN_Driver_WriteString(DATA_SISTEMA, date_buf, 8);
-        }
-    }
-}
\ No newline at end of file
+}
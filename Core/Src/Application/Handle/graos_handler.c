@@ -2,23 +2,22 @@
 #include "controller.h"
 #include "dwin_driver.h"
 #include "gerenciador_configuracoes.h"
+#include "pesquisa_graos.h"
 #include <stdio.h>
 #include <string.h>
-#include <ctype.h>
 #include <stdbool.h>
 
 //================================================================================
 // Definies e Variveis Internas
 //================================================================================
 
-#define MAX_RESULTADOS_PESQUISA 30
 #define MAX_RESULTADOS_POR_PAGINA 10
 
 // --- Variveis para Pesquisa e Paginao ---
-static int16_t s_indices_resultados_pesquisa[MAX_RESULTADOS_PESQUISA];
-static uint8_t s_num_resultados_encontrados = 0;
-static uint8_t s_current_page = 1;
-static uint8_t s_total_pages = 1;
+// Os resultados ficam no ndice (pesquisa_graos); aqui s a paginao.
+static uint16_t s_num_resultados_encontrados = 0;
+static uint16_t s_current_page = 1;
+static uint16_t s_total_pages = 1;
 static bool s_search_active = false; // Flag para saber se a pesquisa est ativa
 
 // Mapeamento de VPs para os slots de resultado
@@ -27,6 +26,11 @@ static const uint16_t s_vps_resultados_nomes[] = {
     VP_RESULT_NAME_6, VP_RESULT_NAME_7, VP_RESULT_NAME_8, VP_RESULT_NAME_9, VP_RESULT_NAME_10
 };
 
+// --- Envio progressivo dos slots de resultado (sem busy-wait no TX) ---
+#define GRAOS_SLOT_FRAME_MAX  (6u + MAX_NOME_GRAO_LEN + 2u) // cabealho + nome + FF FF
+static uint8_t s_proximo_slot = MAX_RESULTADOS_POR_PAGINA;
+static bool s_envio_agendado = false; // callback de concluso de TX pendente
+
 // --- Variveis para Navegao por Setas ---
 static int16_t s_indice_grao_selecionado = 0;
 static bool s_em_tela_de_selecao = false;
@@ -45,8 +49,9 @@ typedef enum {
 
 static void atualizar_display_grao_selecionado(int16_t indice);
 static void Graos_Update_Page_Indicator(void);
+static void Graos_Enviar_Slots_Pendentes(dwin_tx_token_t token, bool enviado, void* ctx);
+static bool Graos_Escrever_Slot(uint8_t slot);
 static GraosNavResult_t graos_handle_navegacao_logic(int16_t tecla);
-static char* stristr(const char* str1, const char* str2);
 
 //================================================================================
 // Funes Pblicas (Handlers de Evento)
@@ -60,6 +65,8 @@ void Graos_Handle_Entrada_Tela(void)
     Gerenciador_Config_Get_Grao_Ativo(&indice_salvo);
     s_indice_grao_selecionado = indice_salvo;
 
+    // Limpa a consulta; o ndice s  refeito se a verso da configurao mudou
+    PesquisaGraos_Buscar("");
     
     // Atualiza tambm os campos de navegao por setas
     atualizar_display_grao_selecionado(s_indice_grao_selecionado);
@@ -130,10 +137,10 @@ void Graos_Handle_Page_Change(void)
 void Graos_Confirmar_Selecao_Pesquisa(uint8_t slot_selecionado)
 {
     uint16_t real_result_index = ((s_current_page - 1) * MAX_RESULTADOS_POR_PAGINA) + slot_selecionado;
+    uint8_t indice_final;
 
-    if (real_result_index < s_num_resultados_encontrados)
+    if (PesquisaGraos_Obter(real_result_index, &indice_final))
     {
-        int16_t indice_final = s_indices_resultados_pesquisa[real_result_index];
         printf("Selecao via pesquisa confirmada. Indice do Grao: %d. Salvando...\r\n", indice_final);
         
         s_em_tela_de_selecao = false;
@@ -159,26 +166,15 @@ void Graos_Limpar_Resultados_Pesquisa(void)
 
 void Graos_Executar_Pesquisa(const char* termo_pesquisa)
 {
-    s_num_resultados_encontrados = 0;
-    uint8_t total_de_graos = Gerenciador_Config_Get_Num_Graos();
+    // Pesquisa vazia desativa o modo de pesquisa e lista todos os gros
+    s_search_active = (termo_pesquisa != NULL) && (termo_pesquisa[0] != '\0');
+    s_num_resultados_encontrados = PesquisaGraos_Buscar(termo_pesquisa);
 
-    if (termo_pesquisa == NULL || strlen(termo_pesquisa) == 0) {
-        s_search_active = false; // Pesquisa vazia desativa o modo de pesquisa
-        for (int i = 0; i < total_de_graos && s_num_resultados_encontrados < MAX_RESULTADOS_PESQUISA; i++) {
-             s_indices_resultados_pesquisa[s_num_resultados_encontrados++] = i;
-        }
-    } else {
-        s_search_active = true; // Pesquisa com texto ativa o modo de pesquisa
-        for (int i = 0; i < total_de_graos; i++) {
-            Config_Grao_t dados_grao;
-            if (Gerenciador_Config_Get_Dados_Grao(i, &dados_grao)) {
-                if (stristr(dados_grao.nome, termo_pesquisa) != NULL) {
-                    if (s_num_resultados_encontrados < MAX_RESULTADOS_PESQUISA) {
-                        s_indices_resultados_pesquisa[s_num_resultados_encontrados++] = i;
-                    }
-                }
-            }
-        }
+    // Sem correspondncia exata: tenta tolerando erros de digitao
+    if (s_search_active && (s_num_resultados_encontrados == 0))
+    {
+        s_num_resultados_encontrados = PesquisaGraos_Buscar_Aproximada(termo_pesquisa);
+        printf("Pesquisa aproximada por '%s': %u resultado(s).\r\n", termo_pesquisa, s_num_resultados_encontrados);
     }
 
     if (s_num_resultados_encontrados == 0)
@@ -188,10 +184,6 @@ void Graos_Executar_Pesquisa(const char* termo_pesquisa)
         // ...manda o display para a tela de erro.
         DWIN_Driver_SetScreen(MSG_ALERTA); 
 				DWIN_Driver_WriteString(VP_MESSAGES, "Nenhum grao encontrado!", sizeof("Nenhum grao encontrado!"));
-        // Garante que o comando seja enviado
-        while (DWIN_Driver_IsTxBusy()) {
-            DWIN_TX_Pump();
-        }
     }
     else // Caso contrrio, se encontramos resultados...
     {
@@ -206,32 +198,70 @@ void Graos_Executar_Pesquisa(const char* termo_pesquisa)
 
 void Graos_Exibir_Resultados_Pesquisa(void)
 {
-    uint16_t start_index = (s_current_page - 1) * MAX_RESULTADOS_POR_PAGINA;
-    for (int i = 0; i < MAX_RESULTADOS_POR_PAGINA; i++) {
-        uint16_t current_result_index = start_index + i;
-        if (current_result_index < s_num_resultados_encontrados) {
-            Config_Grao_t dados_grao;
-            if (Gerenciador_Config_Get_Dados_Grao(s_indices_resultados_pesquisa[current_result_index], &dados_grao)) {
-                DWIN_Driver_WriteString(s_vps_resultados_nomes[i], dados_grao.nome, MAX_NOME_GRAO_LEN);
-            }
-        } else {
-            DWIN_Driver_WriteString(s_vps_resultados_nomes[i], " ", 1);
+    // A troca de tela vai pela lane de controle e sai antes dos nomes;
+    // os slots so enviados  medida que a fila de dados libera espao.
+    DWIN_Driver_SetScreen(TELA_PESQUISA);
+    s_proximo_slot = 0;
+    Graos_Enviar_Slots_Pendentes(DWIN_TX_TOKEN_INVALIDO, true, NULL);
+}
+
+static bool Graos_Escrever_Slot(uint8_t slot)
+{
+    uint16_t current_result_index = ((s_current_page - 1) * MAX_RESULTADOS_POR_PAGINA) + slot;
+    uint8_t indice_grao;
+    if (PesquisaGraos_Obter(current_result_index, &indice_grao)) {
+        return DWIN_Driver_WriteString(s_vps_resultados_nomes[slot], Gerenciador_Config_Get_Nome_Grao(indice_grao), MAX_NOME_GRAO_LEN);
+    }
+    return DWIN_Driver_WriteString(s_vps_resultados_nomes[slot], " ", 1);
+}
+
+/**
+ * @brief Escreve os slots restantes da pgina atual enquanto houver espao na
+ *        lane de dados; se faltar, agenda a continuao na concluso do ltimo
+ *        comando enfileirado. Um slot s avana depois de aceito pelo driver;
+ *        se nem o callback for aceito, Graos_Process retoma no prximo ciclo.
+ *        Executa sempre no superloop.
+ */
+static void Graos_Enviar_Slots_Pendentes(dwin_tx_token_t token, bool enviado, void* ctx)
+{
+    (void)ctx;
+
+    if (token != DWIN_TX_TOKEN_INVALIDO) {
+        s_envio_agendado = false; // chamado como callback de concluso
+        if (!enviado) {
+            return; // fila descartada pelo driver: Graos_Process reenvia
         }
+    } else if (s_envio_agendado) {
+        return; // a continuao j agendada reinicia a partir de s_proximo_slot
     }
-		DWIN_Driver_SetScreen(TELA_PESQUISA);
-		while (DWIN_Driver_IsTxBusy()) {
-        DWIN_TX_Pump();
+
+    while (s_proximo_slot < MAX_RESULTADOS_POR_PAGINA)
+    {
+        if (DWIN_Driver_GetTxFree(DWIN_TX_LANE_DADOS) < GRAOS_SLOT_FRAME_MAX)
+        {
+            s_envio_agendado = DWIN_Driver_NotifyWhenDone(DWIN_Driver_GetLastToken(DWIN_TX_LANE_DADOS),
+                                                          Graos_Enviar_Slots_Pendentes, NULL);
+            return;
+        }
+        if (!Graos_Escrever_Slot(s_proximo_slot)) {
+            return; // recusado pelo driver: tenta de novo no prximo ciclo
+        }
+        s_proximo_slot++;
+    }
+}
+
+void Graos_Process(void)
+{
+    if (s_proximo_slot < MAX_RESULTADOS_POR_PAGINA) {
+        Graos_Enviar_Slots_Pendentes(DWIN_TX_TOKEN_INVALIDO, true, NULL);
     }
 }
 
 static void Graos_Update_Page_Indicator(void)
 {
     char buffer_display[8];
-    sprintf(buffer_display, "%d/%d", s_current_page, s_total_pages);
+    snprintf(buffer_display, sizeof(buffer_display), "%u/%u", s_current_page, s_total_pages);
     DWIN_Driver_WriteString(VP_PAGE_INDICATOR, buffer_display, strlen(buffer_display));
-		while (DWIN_Driver_IsTxBusy()) {
-        DWIN_TX_Pump();
-    }
 }
 
 // --- Funes Restauradas para Navegao por Setas ---
@@ -274,37 +304,17 @@ static GraosNavResult_t graos_handle_navegacao_logic(int16_t tecla)
 
 static void atualizar_display_grao_selecionado(int16_t indice)
 {
-    Config_Grao_t dados_grao;
     char buffer_display[25]; 
-    if (Gerenciador_Config_Get_Dados_Grao(indice, &dados_grao)) 
+    const Config_Grao_t* dados_grao = Gerenciador_Config_Get_Grao_View((uint8_t)indice);
+    if (dados_grao != NULL) 
     {
-        DWIN_Driver_WriteString(GRAO_A_MEDIR, dados_grao.nome, MAX_NOME_GRAO_LEN);
-        snprintf(buffer_display, sizeof(buffer_display), "%.1f%%", (float)dados_grao.umidade_min);
+        DWIN_Driver_WriteString(GRAO_A_MEDIR, dados_grao->nome, MAX_NOME_GRAO_LEN);
+        snprintf(buffer_display, sizeof(buffer_display), "%.1f%%", (float)dados_grao->umidade_min);
         DWIN_Driver_WriteString(UMI_MIN, buffer_display, strlen(buffer_display));
-        snprintf(buffer_display, sizeof(buffer_display), "%.1f%%", (float)dados_grao.umidade_max);
+        snprintf(buffer_display, sizeof(buffer_display), "%.1f%%", (float)dados_grao->umidade_max);
         DWIN_Driver_WriteString(UMI_MAX, buffer_display, strlen(buffer_display));
-        snprintf(buffer_display, sizeof(buffer_display), "%u", dados_grao.id_curva);
+        snprintf(buffer_display, sizeof(buffer_display), "%u", dados_grao->id_curva);
         DWIN_Driver_WriteString(CURVA, buffer_display, strlen(buffer_display));
-        DWIN_Driver_WriteString(DATA_VAL, dados_grao.validade, MAX_VALIDADE_LEN);
+        DWIN_Driver_WriteString(DATA_VAL, dados_grao->validade, MAX_VALIDADE_LEN);
     }
 }
-
-static char* stristr(const char* str1, const char* str2) {
-    const char *p1 = str1, *p2 = str2, *r = *p2 == 0 ? str1 : 0;
-    while (*p1 != 0 && *p2 != 0) {
-        if (tolower((unsigned char)*p1) == tolower((unsigned char)*p2)) {
-            if (r == 0) r = p1;
-            p2++;
-        } else {
-            p2 = str2;
-            if (r != 0) p1 = r + 1;
-            if (tolower((unsigned char)*p1) == tolower((unsigned char)*p2)) {
-                r = p1; p2++;
-            } else {
-                r = 0;
-            }
-        }
-        p1++;
-    }
-    return *p2 == 0 ? (char*)r : 0;
-}
\ No newline at end of file
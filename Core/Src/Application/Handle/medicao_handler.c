@@ -9,7 +9,15 @@
 #include "ads1232_driver.h"
 #include "pcb_frequency.h"
 #include "gerenciador_configuracoes.h"
+#include "app_eventos.h"
+#include "estatistica.h"
+#include "deriva_termica.h"
+#include "temp_sensor.h"
+#include "servo_controle.h"
+#include "GXXX_Equacoes.h"
+#include "log_diferido.h"
 #include "main.h" 
+#include <stdio.h>
 #include <string.h>
 #include <math.h>
 
@@ -19,19 +27,50 @@
 
 // Armazena o estado interno das medies. nica fonte da verdade.
 static DadosMedicao_t s_dados_medicao_atuais;
+static DadosBrutos_t s_dados_brutos;
 extern volatile bool g_ads_data_ready;
 
-// Controle de tempo para atualizao de frequncia.
-static uint32_t s_freq_last_tick = 0;
-static const uint32_t FREQ_UPDATE_INTERVAL_MS = 1000;
+// Janela de estabilidade da balana (gramas, circular)
+static struct {
+    float   amostras[MEDICAO_JANELA_PESO];
+    uint8_t idx;
+    uint8_t cheias;
+} s_janela_peso;
+
+// Cmara vazia para o aprendizado da deriva: balana assentada perto da tara
+#define DERIVA_VAZIO_FAIXA_G   0.5f
+#define DERIVA_VAZIO_MAX_G     2.0f
+
+// --- Motor de repeties ---
+#define REP_MIN_PARADA      3u   // leituras aceitas antes de admitir parada antecipada
+#define REP_MAX_REJEICOES   3u   // acima disso a amostra  instvel: encerra com o que tem
+
+// Produto sem curva na ROM (Fat_A..Fat_D zerados): valor fixo exibido antes das curvas
+#define UMIDADE_SEM_CURVA   25.73f
+
+static struct {
+    Estatistica_t est;
+    float    tolerancia;
+    uint16_t alvo;
+    uint8_t  indice_grao;
+    bool     ativo;
+    uint32_t seq_inicio;         // janelas com nmero at este so anteriores  srie
+    bool     parada_antecipada;
+} s_rep;
+
 
 //================================================================================
 // Prottipos de Funes Privadas (Lgica Interna)
 //================================================================================
 
 static void HandleScaleData(void);
-static void UpdateFrequencyData(void);
-static float CalculateEscalaA(uint32_t frequencia_hz);
+static void UpdateFrequencyData(Evento_t evento);
+static void Aviso_Janela_Frequencia(void);
+static bool Camara_Vazia(void);
+static float CalculateEscalaA(float frequencia_hz, float temp_c);
+static float CalculateUmidade(float escala_a, uint8_t indice_grao);
+static void Repeticao_Janela(float escala_a);
+static void Repeticao_Concluir(void);
 
 //================================================================================
 // Implementao das Funes Pblicas
@@ -39,11 +78,16 @@ static float CalculateEscalaA(uint32_t frequencia_hz);
 
 void Medicao_Init(void) {
     memset(&s_dados_medicao_atuais, 0, sizeof(DadosMedicao_t));
+    memset(&s_dados_brutos, 0, sizeof(DadosBrutos_t));
+    memset(&s_rep, 0, sizeof(s_rep));
+    Medicao_Peso_Reiniciar_Janela();
+    // A janela de frequncia  fechada e capturada no ISR do TIM14
+    Eventos_Registrar(EV_FREQ_JANELA, UpdateFrequencyData);
+    Frequency_Set_Aviso_Janela(Aviso_Janela_Frequencia);
 }
 
 void Medicao_Process(void) {
     HandleScaleData();
-    UpdateFrequencyData();
 }
 
 void Medicao_Get_UltimaMedicao(DadosMedicao_t* dados_out) {
@@ -52,7 +96,95 @@ void Medicao_Get_UltimaMedicao(DadosMedicao_t* dados_out) {
     }
 }
 
+void Medicao_Get_Brutos(DadosBrutos_t* brutos) {
+    if (brutos != NULL) {
+        memcpy(brutos, &s_dados_brutos, sizeof(DadosBrutos_t));
+    }
+}
+
+bool Medicao_Peso_Estavel(float faixa_max_g, float* peso_medio) {
+    if (s_janela_peso.cheias < MEDICAO_JANELA_PESO) {
+        return false;
+    }
+
+    float min = s_janela_peso.amostras[0];
+    float max = min;
+    float soma = 0.0f;
+    for (uint8_t i = 0; i < MEDICAO_JANELA_PESO; i++) {
+        float p = s_janela_peso.amostras[i];
+        if (p < min) min = p;
+        if (p > max) max = p;
+        soma += p;
+    }
+    if (peso_medio != NULL) {
+        *peso_medio = soma / (float)MEDICAO_JANELA_PESO;
+    }
+    return (max - min) <= faixa_max_g;
+}
+
+void Medicao_Peso_Reiniciar_Janela(void) {
+    s_janela_peso.idx = 0;
+    s_janela_peso.cheias = 0;
+}
+
+void Medicao_Repeticao_Iniciar(uint16_t janela_ms) {
+    uint8_t indice_grao = 0;
+    Gerenciador_Config_Get_Grao_Ativo(&indice_grao);
+    if (indice_grao >= MAX_GRAOS) {
+        indice_grao = 0;
+    }
+
+    uint16_t alvo = Gerenciador_Config_Get_NR_Repetition();
+    if (alvo < 1u) {
+        alvo = 1u;
+    } else if (alvo > ESTATISTICA_MAX_AMOSTRAS) {
+        alvo = ESTATISTICA_MAX_AMOSTRAS;
+    }
+
+    // Sem tolerncia prpria do gro: meia unidade da ltima casa exibida
+    float tolerancia = Produto[indice_grao].Tol_Rep;
+    if (tolerancia <= 0.0f) {
+        tolerancia = (Gerenciador_Config_Get_NR_Decimals() == 1u) ? 0.05f : 0.005f;
+    }
+
+    Estatistica_Reset(&s_rep.est);
+    s_rep.tolerancia = tolerancia;
+    s_rep.alvo = alvo;
+    s_rep.indice_grao = indice_grao;
+    s_rep.parada_antecipada = false;
+    s_rep.ativo = true;
+
+    // Reinicia a contagem agora: a primeira janela da srie j  completa
+    Frequency_Set_Janela_ms(janela_ms);
+    s_rep.seq_inicio = Frequency_Get_Janela(NULL, NULL);
+}
+
+void Medicao_Repeticao_Cancelar(void) {
+    if (s_rep.ativo) {
+        s_rep.ativo = false;
+        Frequency_Set_Janela_ms(FREQ_JANELA_PADRAO_MS);
+    }
+}
+
+bool Medicao_Repeticao_Em_Andamento(void) {
+    return s_rep.ativo;
+}
+
+void Medicao_Get_Repeticao(ResultadoRepeticao_t* resultado) {
+    if (resultado == NULL) return;
+
+    resultado->Umidade_Media = s_rep.est.media;
+    resultado->Desvio = Estatistica_Desvio(&s_rep.est);
+    resultado->Semi_IC = Estatistica_Semi_IC95(&s_rep.est);
+    resultado->Tolerancia = s_rep.tolerancia;
+    resultado->Amostras = s_rep.est.n;
+    resultado->Rejeitadas = s_rep.est.rejeitadas;
+    resultado->Alvo = s_rep.alvo;
+    resultado->Parada_Antecipada = s_rep.parada_antecipada;
+}
+
 void Medicao_Set_Temp_Instru(float temp_instru) { s_dados_medicao_atuais.Temp_Instru = temp_instru; }
+void Medicao_Set_Peso_Amostra(float peso)     { s_dados_medicao_atuais.Peso_Amostra = peso; }
 void Medicao_Set_Densidade(float densidade)   { s_dados_medicao_atuais.Densidade = densidade; }
 void Medicao_Set_Umidade(float umidade)       { s_dados_medicao_atuais.Umidade = umidade; }
 
@@ -67,34 +199,83 @@ void Medicao_Set_Umidade(float umidade)       { s_dados_medicao_atuais.Umidade =
 static void HandleScaleData(void) {
     if (g_ads_data_ready) {
         g_ads_data_ready = false;
-        int32_t leitura_adc_mediana = ADS1232_Read_Median_of_3();
+        int32_t leitura_adc_mediana;
+        // Converses de temperatura e de assentamento do mux ficam no driver
+        if (ADS1232_Ler_Intercalado(&leitura_adc_mediana) != ADS1232_AMOSTRA_PESO) {
+            return;
+        }
         float gramas = ADS1232_ConvertToGrams(leitura_adc_mediana);
+        s_dados_brutos.Contagem_ADC = leitura_adc_mediana;
         s_dados_medicao_atuais.Peso = gramas;
+
+        s_janela_peso.amostras[s_janela_peso.idx] = gramas;
+        s_janela_peso.idx = (uint8_t)((s_janela_peso.idx + 1u) % MEDICAO_JANELA_PESO);
+        if (s_janela_peso.cheias < MEDICAO_JANELA_PESO) {
+            s_janela_peso.cheias++;
+        }
+        ADS1232_Tare_Feed(leitura_adc_mediana); // s consome durante uma tara em andamento
     }
 }
 
 /**
- * @brief Lgica movida de app_manager.c (Task_Update_Frequency).
- * Atualiza a leitura de frequncia e o clculo da Escala A a cada 1 segundo.
+ * @brief Chamado no ISR do TIM14 quando uma janela fecha.
+ */
+static void Aviso_Janela_Frequencia(void) {
+    Eventos_Post(EV_FREQ_JANELA);
+}
+
+/**
+ * @brief Handler de EV_FREQ_JANELA.
+ * Atualiza a leitura de frequncia e o clculo da Escala A a cada janela
+ * (1 s fora das medies; a da receita do produto durante as repeties).
  */
-static void UpdateFrequencyData(void) {
-    if (HAL_GetTick() - s_freq_last_tick >= FREQ_UPDATE_INTERVAL_MS) {
-        s_freq_last_tick = HAL_GetTick();
+static void UpdateFrequencyData(Evento_t evento) {
+    (void)evento;
+
+    uint32_t pulsos = 0;
+    uint16_t janela_ms = FREQ_JANELA_PADRAO_MS;
+    uint32_t seq = Frequency_Get_Janela(&pulsos, &janela_ms);
+    s_dados_brutos.Pulsos_Janela = pulsos;
+    s_dados_brutos.Janela_ms = janela_ms;
+    s_dados_brutos.Janelas_Frequencia++;
 
-        uint32_t pulsos = Frequency_Get_Pulse_Count();
-        Frequency_Reset();
+    float frequencia_hz = ((float)pulsos * 1000.0f) / (float)janela_ms;
+    float temp_c = TempSensor_GetTemperature();
+    s_dados_medicao_atuais.Frequencia = frequencia_hz;
+    if (Camara_Vazia()) {
+        Deriva_Aprender(frequencia_hz, temp_c);
+    }
+    s_dados_medicao_atuais.Escala_A = CalculateEscalaA(frequencia_hz, temp_c);
+
+    if (s_rep.ativo && ((int32_t)(seq - s_rep.seq_inicio) > 0)) {
+        Repeticao_Janela(s_dados_medicao_atuais.Escala_A);
+    }
+}
 
-        s_dados_medicao_atuais.Frequencia = (float)pulsos;
-        s_dados_medicao_atuais.Escala_A = CalculateEscalaA(pulsos);
+/**
+ * @brief Janela de frequncia utilizvel pela deriva trmica: fora de uma
+ * srie de repeties, servos parados e balana assentada sem amostra.
+ */
+static bool Camara_Vazia(void) {
+    float peso;
+    if (s_rep.ativo || Servos_Em_Movimento()) {
+        return false;
     }
+    if (!Medicao_Peso_Estavel(DERIVA_VAZIO_FAIXA_G, &peso)) {
+        return false;
+    }
+    return fabsf(peso) <= DERIVA_VAZIO_MAX_G;
 }
 
 /**
  * @brief Lgica movida de app_manager.c (Calcular_Escala_A).
  * Calcula o valor da Escala A com base na frequncia e nos fatores de calibrao.
+ * A frequncia  antes referida  temperatura de calibrao pelo modelo de
+ * deriva trmica, o que dispensa esperar o instrumento aquecer.
  */
-static float CalculateEscalaA(uint32_t frequencia_hz) {
-    float escala_a = (-0.00014955f * (float)frequencia_hz) + 396.85f;
+static float CalculateEscalaA(float frequencia_hz, float temp_c) {
+    frequencia_hz = Deriva_Corrigir(frequencia_hz, temp_c);
+    float escala_a = (-0.00014955f * frequencia_hz) + 396.85f;
 
     float gain = 1.0f;
     float zero = 0.0f;
@@ -102,4 +283,49 @@ static float CalculateEscalaA(uint32_t frequencia_hz) {
     escala_a = (escala_a * gain) + zero;
 
     return escala_a;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Curva de umidade do produto: polinmio de 3 grau na Escala A.
+ *        Sem coeficientes, o polinmio daria 0 %: usa UMIDADE_SEM_CURVA.
+ */
+static float CalculateUmidade(float escala_a, uint8_t indice_grao) {
+    const struct Produtos_ROM* p = &Produto[indice_grao];
+    if ((p->Fat_A == 0.0f) && (p->Fat_B == 0.0f) && (p->Fat_C == 0.0f) && (p->Fat_D == 0.0f)) {
+        return UMIDADE_SEM_CURVA;
+    }
+    return ((((p->Fat_A * escala_a) + p->Fat_B) * escala_a + p->Fat_C) * escala_a) + p->Fat_D;
+}
+
+/**
+ * @brief Acumula uma janela de frequncia na srie de repeties e decide
+ * se a srie terminou (alvo atingido, IC dentro da tolerncia ou amostra
+ * instvel demais).
+ */
+static void Repeticao_Janela(float escala_a) {
+    float umidade = CalculateUmidade(escala_a, s_rep.indice_grao);
+    Estatistica_Adicionar(&s_rep.est, umidade, s_rep.tolerancia);
+
+    bool estavel = (s_rep.est.n >= REP_MIN_PARADA) &&
+                   (Estatistica_Semi_IC95(&s_rep.est) <= s_rep.tolerancia);
+
+    if (s_rep.est.n >= s_rep.alvo) {
+        Repeticao_Concluir();
+    } else if (estavel) {
+        s_rep.parada_antecipada = true;
+        Repeticao_Concluir();
+    } else if (s_rep.est.rejeitadas > REP_MAX_REJEICOES) {
+        Repeticao_Concluir();
+    }
+}
+
+static void Repeticao_Concluir(void) {
+    s_rep.ativo = false;
+    Frequency_Set_Janela_ms(FREQ_JANELA_PADRAO_MS);
+    s_dados_medicao_atuais.Umidade = s_rep.est.media;
+    s_dados_medicao_atuais.Umidade_Desvio = Estatistica_Desvio(&s_rep.est);
+
+    // Formatao (inclusive dos floats) fica no host: Tools/log_decoder.py
+    LOG4(MED_REPETICOES, s_rep.est.n, s_rep.alvo, s_rep.est.rejeitadas, s_rep.parada_antecipada ? 1u : 0u);
+    LOG2(MED_UMIDADE, LOG_F(s_dados_medicao_atuais.Umidade), LOG_F(s_dados_medicao_atuais.Umidade_Desvio));
+}
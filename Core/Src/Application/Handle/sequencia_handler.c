@@ -0,0 +1,322 @@
+/*******************************************************************************
+ * @file        sequencia_handler.c
+ * @brief       Implementao da sequncia de medio dirigida por sensores.
+ * @details     Tabela de passos no mesmo molde da antiga sequncia de
+ * servo_controle.c, mas cada passo tem uma condio de concluso em vez de
+ * uma durao: a durao s entra como timeout.
+ ******************************************************************************/
+
+#include "sequencia_handler.h"
+#include "medicao_handler.h"
+#include "servo_controle.h"
+#include "temp_sensor.h"
+#include "app_eventos.h"
+#include "estatistica.h"
+#include "gerenciador_configuracoes.h"
+#include "GXXX_Equacoes.h"
+#include "log_diferido.h"
+#include "main.h" // Para HAL_GetTick
+#include <stddef.h>
+#include <string.h>
+
+//================================================================================
+// Definies e Variveis Internas
+//================================================================================
+
+// Limiares e tempos vm da receita do produto ativo (Receita[] em
+// GXXX_Equacoes.c), carregada no incio de cada ciclo.
+#define SEQ_TIMEOUT_VAZIO_MS     5000u
+#define SEQ_FOLGA_RASPA_MS       250u   // por curso, alm do perfil do servo
+#define SEQ_JANELAS_EXTRA        4u     // rejeies toleradas alm do alvo
+
+typedef struct {
+    void (*entrada)(void);
+    bool (*concluido)(void);
+} PassoSequencia_t;
+
+static void Entrada_Vazio(void);
+static void Entrada_Enche(void);
+static void Entrada_Raspa(void);
+static void Entrada_Mede(void);
+static bool Concluido_Vazio(void);
+static bool Concluido_Enche(void);
+static bool Concluido_Assenta(void);
+static bool Concluido_Raspa(void);
+static bool Concluido_Mede(void);
+
+// Indexada por SequenciaPasso_t; os passos avanam em ordem at MEDE
+static const PassoSequencia_t s_passos[SEQ_NUM_PASSOS] = {
+    [SEQ_PASSO_VAZIO]   = { Entrada_Vazio, Concluido_Vazio   },
+    [SEQ_PASSO_ENCHE]   = { Entrada_Enche, Concluido_Enche   },
+    [SEQ_PASSO_ASSENTA] = { NULL,          Concluido_Assenta },
+    [SEQ_PASSO_RASPA]   = { Entrada_Raspa, Concluido_Raspa   },
+    [SEQ_PASSO_MEDE]    = { Entrada_Mede,  Concluido_Mede    },
+};
+
+static const char* const s_nomes_passo[SEQ_NUM_PASSOS] = {
+    "OCIOSO", "VAZIO", "ENCHE", "ASSENTA", "RASPA", "MEDE", "CONCLUIDO", "FALHA",
+};
+
+static SequenciaPasso_t  s_passo = SEQ_PASSO_OCIOSO;
+static uint32_t          s_inicio_passo_ms = 0;
+static uint32_t          s_inicio_ciclo_ms = 0;
+static float             s_peso_vazio = 0.0f;
+static bool              s_peso_capturado = false;
+static SequenciaTempos_t s_tempos;
+static struct Receita_ROM s_receita;
+static uint8_t           s_indice_receita = RECEITA_PADRAO;
+static float             s_faixa_estavel_g = 0.5f;
+static uint8_t           s_raspadas = 0;
+static bool              s_raspa_voltando = false;
+
+static void Carregar_Receita(void);
+static uint32_t Timeout_Passo(SequenciaPasso_t passo);
+static void Entrar_No_Passo(SequenciaPasso_t passo);
+static void Finalizar(bool sucesso);
+static void Imprimir_Tempos(void);
+
+//================================================================================
+// Implementao das Funes Pblicas
+//================================================================================
+
+void Sequencia_Init(void)
+{
+    s_passo = SEQ_PASSO_OCIOSO;
+    memset(&s_tempos, 0, sizeof(s_tempos));
+}
+
+void Sequencia_Process(void)
+{
+    if ((s_passo < SEQ_PASSO_VAZIO) || (s_passo > SEQ_PASSO_MEDE)) {
+        return;
+    }
+
+    const PassoSequencia_t* p = &s_passos[s_passo];
+    if (p->concluido()) {
+        s_tempos.passo_ms[s_passo] = HAL_GetTick() - s_inicio_passo_ms;
+        if (s_passo == SEQ_PASSO_MEDE) {
+            Finalizar(true);
+        } else {
+            Entrar_No_Passo((SequenciaPasso_t)(s_passo + 1));
+        }
+    } else if ((HAL_GetTick() - s_inicio_passo_ms) >= Timeout_Passo(s_passo)) {
+        s_tempos.passo_ms[s_passo] = HAL_GetTick() - s_inicio_passo_ms;
+        LOG1(SEQ_TIMEOUT, s_passo);
+        Finalizar(false);
+    }
+}
+
+bool Sequencia_Iniciar(void)
+{
+    if ((s_passo >= SEQ_PASSO_VAZIO) && (s_passo <= SEQ_PASSO_MEDE)) {
+        return false;
+    }
+
+    memset(s_tempos.passo_ms, 0, sizeof(s_tempos.passo_ms));
+    s_tempos.ciclo_ms = 0;
+    s_peso_capturado = false;
+    Carregar_Receita();
+    s_inicio_ciclo_ms = HAL_GetTick();
+    Entrar_No_Passo(SEQ_PASSO_VAZIO);
+    return true;
+}
+
+void Sequencia_Abortar(void)
+{
+    if ((s_passo >= SEQ_PASSO_VAZIO) && (s_passo <= SEQ_PASSO_MEDE)) {
+        LOG1(SEQ_ABORTADA, s_passo);
+        Finalizar(false);
+    }
+}
+
+SequenciaPasso_t Sequencia_Get_Passo(void) { return s_passo; }
+
+bool Sequencia_Peso_Capturado(void) { return s_peso_capturado; }
+
+void Sequencia_Get_Tempos(SequenciaTempos_t* out)
+{
+    if (out != NULL) {
+        *out = s_tempos;
+    }
+}
+
+const char* Sequencia_Nome_Passo(SequenciaPasso_t passo)
+{
+    return (passo < SEQ_NUM_PASSOS) ? s_nomes_passo[passo] : "?";
+}
+
+uint8_t Sequencia_Get_Receita(void) { return s_indice_receita; }
+
+//================================================================================
+// Implementao das Funes Privadas
+//================================================================================
+
+/**
+ * @brief Copia a receita do gro ativo (ndice fora da tabela = PADRAO) e
+ * ajusta as aberturas dos servos para o ciclo.
+ */
+static void Carregar_Receita(void)
+{
+    uint8_t indice_grao = 0;
+    Gerenciador_Config_Get_Grao_Ativo(&indice_grao);
+
+    s_indice_receita = RECEITA_PADRAO;
+    if ((indice_grao < MAX_GRAOS) && (Produto[indice_grao].Id_Receita < NR_RECEITAS)) {
+        s_indice_receita = Produto[indice_grao].Id_Receita;
+    }
+    s_receita = Receita[s_indice_receita];
+    s_faixa_estavel_g = (float)s_receita.Faixa_Estavel_dg * 0.1f;
+    Servos_Set_Aberturas(s_receita.Ang_Funil, s_receita.Ang_Scrap);
+}
+
+static uint32_t Timeout_Passo(SequenciaPasso_t passo)
+{
+    switch (passo) {
+        case SEQ_PASSO_ENCHE:
+        case SEQ_PASSO_ASSENTA:
+            return s_receita.Enche_Max_ms;
+        case SEQ_PASSO_RASPA:
+            // Cada curso do raspador tem durao conhecida (perfil de movimento)
+            return (Servos_Tempo_Curso_ms(SERVO_SCRAP) + SEQ_FOLGA_RASPA_MS) *
+                   (2u * s_receita.Raspa_Passadas + 1u);
+        case SEQ_PASSO_MEDE:
+            return (uint32_t)s_receita.Janela_ms * (ESTATISTICA_MAX_AMOSTRAS + SEQ_JANELAS_EXTRA);
+        default:
+            return SEQ_TIMEOUT_VAZIO_MS;
+    }
+}
+
+static void Entrar_No_Passo(SequenciaPasso_t passo)
+{
+    s_passo = passo;
+    s_inicio_passo_ms = HAL_GetTick();
+    if (s_passos[passo].entrada != NULL) {
+        s_passos[passo].entrada();
+    }
+}
+
+static void Finalizar(bool sucesso)
+{
+    Servos_Set_Funil(false);
+    Servos_Set_Scrap(false);
+    Medicao_Repeticao_Cancelar();
+
+    s_tempos.ciclo_ms = HAL_GetTick() - s_inicio_ciclo_ms;
+    if (sucesso) {
+        s_tempos.ciclos++;
+        if (s_tempos.ciclo_ms > s_tempos.ciclo_max_ms) {
+            s_tempos.ciclo_max_ms = s_tempos.ciclo_ms;
+        }
+        s_passo = SEQ_PASSO_CONCLUIDO;
+    } else {
+        s_tempos.falhas++;
+        s_passo = SEQ_PASSO_FALHA;
+    }
+    Imprimir_Tempos();
+    Eventos_Post(EV_SERVOS_SEQUENCE_FINISHED);
+}
+
+/**
+ * @brief Tempos do ciclo pelo log diferido (o texto  montado no host).
+ */
+static void Imprimir_Tempos(void)
+{
+    if (s_passo == SEQ_PASSO_CONCLUIDO) {
+        LOG1(SEQ_CICLO_CONCLUIDO, s_tempos.ciclo_ms);
+    } else {
+        LOG1(SEQ_CICLO_FALHA, s_tempos.ciclo_ms);
+    }
+    LOG3(SEQ_TEMPOS_ENCHIMENTO, s_tempos.passo_ms[SEQ_PASSO_VAZIO],
+         s_tempos.passo_ms[SEQ_PASSO_ENCHE], s_tempos.passo_ms[SEQ_PASSO_ASSENTA]);
+    LOG2(SEQ_TEMPOS_MEDICAO, s_tempos.passo_ms[SEQ_PASSO_RASPA], s_tempos.passo_ms[SEQ_PASSO_MEDE]);
+}
+
+// --- Passos ---
+
+static void Entrada_Vazio(void)
+{
+    Servos_Set_Funil(false);
+    Servos_Set_Scrap(false);
+}
+
+static bool Concluido_Vazio(void)
+{
+    if (Servos_Em_Movimento()) return false;
+    return Medicao_Peso_Estavel(s_faixa_estavel_g, &s_peso_vazio);
+}
+
+static void Entrada_Enche(void)
+{
+    ServoStep_t passo = SERVO_STEP_FUNNEL;
+    Eventos_Post_Payload(EV_SERVOS_SEQUENCE_STEP_CHANGED, &passo, sizeof(passo));
+    Servos_Set_Funil(true);
+}
+
+static bool Concluido_Enche(void)
+{
+    DadosMedicao_t dados;
+    Medicao_Get_UltimaMedicao(&dados);
+    if ((dados.Peso - s_peso_vazio) < (float)s_receita.Degrau_g) {
+        return false;
+    }
+    Medicao_Peso_Reiniciar_Janela(); // estabilidade conta s a partir do degrau
+    return true;
+}
+
+static bool Concluido_Assenta(void)
+{
+    return Medicao_Peso_Estavel(s_faixa_estavel_g, NULL);
+}
+
+static void Entrada_Raspa(void)
+{
+    ServoStep_t passo = SERVO_STEP_SCRAPER;
+    Eventos_Post_Payload(EV_SERVOS_SEQUENCE_STEP_CHANGED, &passo, sizeof(passo));
+    // Funil e raspador so independentes: fecham/varrem ao mesmo tempo
+    Servos_Set_Funil(false);
+    Servos_Set_Scrap(true);
+    s_raspadas = 1;
+    s_raspa_voltando = false;
+}
+
+/**
+ * @brief Vai e volta at completar as varreduras da receita; termina com o
+ * raspador no fim do curso (o retorno final corre junto com a medio).
+ */
+static bool Concluido_Raspa(void)
+{
+    if (Servos_Em_Movimento()) return false;
+    if (s_raspa_voltando) {
+        Servos_Set_Scrap(true);
+        s_raspa_voltando = false;
+        s_raspadas++;
+        return false;
+    }
+    if (s_raspadas < s_receita.Raspa_Passadas) {
+        Servos_Set_Scrap(false);
+        s_raspa_voltando = true;
+        return false;
+    }
+    return true;
+}
+
+static void Entrada_Mede(void)
+{
+    // O volume da cmara j est definido: as janelas de frequncia comeam
+    // enquanto o raspador volta e a balana assenta.
+    Servos_Set_Scrap(false);
+    Medicao_Repeticao_Iniciar(s_receita.Janela_ms);
+    Medicao_Set_Temp_Instru(TempSensor_GetTemperature());
+    Medicao_Peso_Reiniciar_Janela();
+}
+
+static bool Concluido_Mede(void)
+{
+    float peso;
+    if (!s_peso_capturado && !Servos_Em_Movimento() &&
+        Medicao_Peso_Estavel(s_faixa_estavel_g, &peso)) {
+        Medicao_Set_Peso_Amostra(peso - s_peso_vazio);
+        s_peso_capturado = true;
+    }
+    return s_peso_capturado && !Medicao_Repeticao_Em_Andamento();
+}
@@ -0,0 +1,271 @@
+/*******************************************************************************
+ * @file        trend_handler.c
+ * @brief       Implementao do canal de tendncia para o grfico do DWIN.
+ * @details     Cada canal acumula uma janela de 'decimacao' amostras e, ao
+ * fech-la, gera dois pontos (mnimo e mximo, na ordem em que ocorreram).
+ * Os pontos ficam num buffer circular por canal e so enviados num nico
+ * frame multi-canal:
+ *   5A A5 LEN 82 03 10 5A A5 NBLK 00 [CH N D1H D1L ... DNH DNL] ...
+ ******************************************************************************/
+
+#include "trend_handler.h"
+#include "dwin_driver.h"
+#include "medicao_handler.h"
+#include "main.h" // Para HAL_GetTick
+#include <string.h>
+
+//================================================================================
+// Definies e Variveis Internas
+//================================================================================
+
+#define TREND_VP_CURVA           0x0310
+#define TREND_PONTOS_BUFFER          16  // por canal (potncia de 2)
+#define TREND_CABECALHO_FRAME        10  // 5A A5 LEN 82 03 10 5A A5 NBLK 00
+#define TREND_CABECALHO_BLOCO         2  // CH N
+
+// Pontos por canal que cabem num frame (limitado pelo buffer DMA do driver)
+#define TREND_PONTOS_POR_FRAME \
+    ((DWIN_TX_DMA_BUFFER_SIZE - TREND_CABECALHO_FRAME - (TREND_NUM_CANAIS * TREND_CABECALHO_BLOCO)) / (2 * TREND_NUM_CANAIS))
+
+typedef struct
+{
+    // Janela de decimao
+    uint8_t  amostras;
+    int16_t  minimo;
+    int16_t  maximo;
+    bool     minimo_primeiro;
+    // Pontos prontos para envio
+    int16_t  pontos[TREND_PONTOS_BUFFER];
+    uint8_t  head;
+    uint8_t  tail;
+} TrendCanalCtx_t;
+
+static const TrendConfig_t TREND_CONFIG_PADRAO = {
+    .periodo_amostra_ms = 100,
+    .decimacao          = 5,
+    .periodo_envio_ms   = 500,
+};
+
+static TrendConfig_t s_config;
+static TrendCanalCtx_t s_canais[TREND_NUM_CANAIS];
+static bool s_habilitado = true;
+static bool s_ativo = false;          // tela com grfico visvel
+static uint32_t s_amostra_tick = 0;
+static uint32_t s_envio_tick = 0;
+static uint32_t s_pontos_descartados = 0;
+
+//================================================================================
+// Funes Privadas
+//================================================================================
+
+static int16_t Saturar_Int16(float valor)
+{
+    if (valor > 32767.0f)  return 32767;
+    if (valor < -32768.0f) return -32768;
+    return (int16_t)valor;
+}
+
+static void Resetar_Canais(void)
+{
+    memset(s_canais, 0, sizeof(s_canais));
+}
+
+static uint8_t Pontos_Pendentes(const TrendCanalCtx_t* c)
+{
+    return (uint8_t)((c->head - c->tail) & (TREND_PONTOS_BUFFER - 1u));
+}
+
+static void Empilhar_Ponto(TrendCanalCtx_t* c, int16_t valor)
+{
+    if (Pontos_Pendentes(c) == (TREND_PONTOS_BUFFER - 1u))
+    {
+        // Buffer cheio: descarta o ponto mais antigo para manter a curva atual
+        c->tail = (uint8_t)((c->tail + 1u) & (TREND_PONTOS_BUFFER - 1u));
+        s_pontos_descartados++;
+    }
+    c->pontos[c->head] = valor;
+    c->head = (uint8_t)((c->head + 1u) & (TREND_PONTOS_BUFFER - 1u));
+}
+
+static void Acumular_Amostra(TrendCanalCtx_t* c, int16_t valor)
+{
+    if (c->amostras == 0u)
+    {
+        c->minimo = valor;
+        c->maximo = valor;
+        c->minimo_primeiro = true;
+    }
+    else if (valor < c->minimo)
+    {
+        c->minimo = valor;
+        c->minimo_primeiro = false; // o mnimo veio depois do mximo atual
+    }
+    else if (valor > c->maximo)
+    {
+        c->maximo = valor;
+        c->minimo_primeiro = true;
+    }
+
+    if (++c->amostras >= s_config.decimacao)
+    {
+        if (c->minimo_primeiro)
+        {
+            Empilhar_Ponto(c, c->minimo);
+            Empilhar_Ponto(c, c->maximo);
+        }
+        else
+        {
+            Empilhar_Ponto(c, c->maximo);
+            Empilhar_Ponto(c, c->minimo);
+        }
+        c->amostras = 0u;
+    }
+}
+
+static void Amostrar(void)
+{
+    DadosMedicao_t dados;
+    Medicao_Get_UltimaMedicao(&dados);
+
+    Acumular_Amostra(&s_canais[TREND_CANAL_PESO],       Saturar_Int16(dados.Peso * 10.0f));
+    Acumular_Amostra(&s_canais[TREND_CANAL_FREQUENCIA], Saturar_Int16(dados.Frequencia * 0.01f));
+    Acumular_Amostra(&s_canais[TREND_CANAL_ESCALA_A],   Saturar_Int16(dados.Escala_A * 10.0f));
+}
+
+/**
+ * @brief Monta e enfileira um frame com os pontos pendentes de todos os canais.
+ *        Os pontos s saem do buffer se o driver aceitar o frame.
+ */
+static void Enviar_Frame(void)
+{
+    uint8_t frame[DWIN_TX_DMA_BUFFER_SIZE];
+    uint8_t n_por_canal[TREND_NUM_CANAIS];
+    uint8_t blocos = 0;
+    uint16_t pos = TREND_CABECALHO_FRAME;
+
+    for (uint8_t ch = 0; ch < TREND_NUM_CANAIS; ch++)
+    {
+        TrendCanalCtx_t* c = &s_canais[ch];
+        uint8_t n = Pontos_Pendentes(c);
+        if (n > TREND_PONTOS_POR_FRAME) n = TREND_PONTOS_POR_FRAME;
+        n_por_canal[ch] = n;
+        if (n == 0u) continue;
+
+        frame[pos++] = ch;
+        frame[pos++] = n;
+        uint8_t idx = c->tail;
+        for (uint8_t i = 0; i < n; i++)
+        {
+            frame[pos++] = (uint8_t)((uint16_t)c->pontos[idx] >> 8);
+            frame[pos++] = (uint8_t)((uint16_t)c->pontos[idx] & 0xFF);
+            idx = (uint8_t)((idx + 1u) & (TREND_PONTOS_BUFFER - 1u));
+        }
+        blocos++;
+    }
+
+    if (blocos == 0u)
+    {
+        return;
+    }
+
+    frame[0] = 0x5A;
+    frame[1] = 0xA5;
+    frame[2] = (uint8_t)(pos - 3u);
+    frame[3] = 0x82;
+    frame[4] = (uint8_t)(TREND_VP_CURVA >> 8);
+    frame[5] = (uint8_t)(TREND_VP_CURVA & 0xFF);
+    frame[6] = 0x5A;
+    frame[7] = 0xA5;
+    frame[8] = blocos;
+    frame[9] = 0x00;
+
+    if (!DWIN_Driver_Send(DWIN_TX_LANE_DADOS, frame, pos, NULL, NULL))
+    {
+        return; // fila cheia: os pontos ficam para o prximo envio
+    }
+
+    for (uint8_t ch = 0; ch < TREND_NUM_CANAIS; ch++)
+    {
+        s_canais[ch].tail = (uint8_t)((s_canais[ch].tail + n_por_canal[ch]) & (TREND_PONTOS_BUFFER - 1u));
+    }
+}
+
+//================================================================================
+// Funes Pblicas
+//================================================================================
+
+void Trend_Init(void)
+{
+    s_config = TREND_CONFIG_PADRAO;
+    s_habilitado = true;
+    s_ativo = false;
+    s_pontos_descartados = 0;
+    Resetar_Canais();
+}
+
+void Trend_Process(uint16_t tela_atual)
+{
+    bool tela_com_grafico = (tela_atual == TELA_MONITOR_SYSTEM) || (tela_atual == TELA_ADJUST_CAPA);
+
+    if (!s_habilitado || !tela_com_grafico)
+    {
+        s_ativo = false;
+        return;
+    }
+
+    const uint32_t agora = HAL_GetTick();
+
+    if (!s_ativo)
+    {
+        // Entrada na tela: descarta histrico antigo
+        s_ativo = true;
+        Resetar_Canais();
+        s_amostra_tick = agora;
+        s_envio_tick = agora;
+    }
+
+    if ((agora - s_amostra_tick) >= s_config.periodo_amostra_ms)
+    {
+        s_amostra_tick = agora;
+        Amostrar();
+    }
+
+    if ((agora - s_envio_tick) >= s_config.periodo_envio_ms)
+    {
+        s_envio_tick = agora;
+        Enviar_Frame();
+    }
+}
+
+bool Trend_Set_Config(const TrendConfig_t* config)
+{
+    if ((config == NULL) ||
+        (config->periodo_amostra_ms < 10u) ||
+        (config->decimacao == 0u) ||
+        (config->periodo_envio_ms < config->periodo_amostra_ms))
+    {
+        return false;
+    }
+
+    s_config = *config;
+    Resetar_Canais();
+    return true;
+}
+
+void Trend_Get_Config(TrendConfig_t* config)
+{
+    if (config != NULL)
+    {
+        *config = s_config;
+    }
+}
+
+void Trend_Set_Enabled(bool habilitado)
+{
+    s_habilitado = habilitado;
+}
+
+uint32_t Trend_Get_Pontos_Descartados(void)
+{
+    return s_pontos_descartados;
+}
@@ -0,0 +1,202 @@
+/*******************************************************************************
+ * @file        agendador.c
+ * @brief       Agendador cooperativo com sono em WFI.
+ * @details     Substitui o superloop que chamava todos os handlers a cada
+ * volta. O ISR de 1 ms decrementa os contadores das tarefas peridicas e
+ * marca as vencidas num mapa de bits; ISRs de perifricos sinalizam tarefas
+ * diretamente. O superloop executa uma tarefa pronta por chamada (a de
+ * maior prioridade) e, sem nenhuma pronta, entra em WFI. Cada execuo 
+ * medida: tempo de execuo, latncia desde a liberao e cumprimento do
+ * prazo (deadline).
+ ******************************************************************************/
+
+#include "agendador.h"
+#include "app_eventos.h" // Eventos_Tempo_us
+#include "main.h"
+#include <string.h>
+
+//================================================================================
+// Definies e Variveis Internas
+//================================================================================
+
+// Seo crtica que preserva o estado anterior (pode ser chamada de ISR)
+#define AGENDADOR_ENTER_CRITICAL()  uint32_t primask_salvo = __get_PRIMASK(); __disable_irq()
+#define AGENDADOR_EXIT_CRITICAL()   __set_PRIMASK(primask_salvo)
+
+static const Tarefa_t* s_tabela = NULL;
+static uint8_t s_num_tarefas = 0;
+
+static volatile uint16_t s_prontas = 0;                        // bit i = tarefa i pronta
+static volatile uint16_t s_contador_ms[AGENDADOR_MAX_TAREFAS]; // ms at a prxima liberao
+static volatile uint32_t s_liberacao_us[AGENDADOR_MAX_TAREFAS];
+
+static TarefaStats_t s_stats_tarefa[AGENDADOR_MAX_TAREFAS];
+static uint64_t s_ocioso_us = 0;
+static uint32_t s_dormidas = 0;
+static uint32_t s_inicio_janela_ms = 0;
+
+//================================================================================
+// Funes Privadas
+//================================================================================
+
+/**
+ * @brief Marca a tarefa como pronta (chamar com IRQs mascaradas).
+ * @return false se ela j estava pendente.
+ */
+static bool Liberar(uint8_t id, uint32_t agora_us)
+{
+    uint16_t bit = (uint16_t)(1u << id);
+    if (s_prontas & bit) {
+        return false;
+    }
+    s_prontas |= bit;
+    s_liberacao_us[id] = agora_us;
+    return true;
+}
+
+//================================================================================
+// Funes Pblicas
+//================================================================================
+
+bool Agendador_Init(const Tarefa_t* tabela, uint8_t num_tarefas)
+{
+    if ((tabela == NULL) || (num_tarefas == 0) || (num_tarefas > AGENDADOR_MAX_TAREFAS)) {
+        return false;
+    }
+
+    uint32_t agora = Eventos_Tempo_us();
+
+    AGENDADOR_ENTER_CRITICAL();
+    s_tabela = tabela;
+    s_num_tarefas = num_tarefas;
+    s_prontas = 0;
+    for (uint8_t i = 0; i < num_tarefas; i++) {
+        s_contador_ms[i] = tabela[i].periodo_ms;
+        Liberar(i, agora);
+    }
+    AGENDADOR_EXIT_CRITICAL();
+
+    Agendador_Reset_Stats();
+    return true;
+}
+
+void Agendador_Sinalizar(uint8_t id)
+{
+    if (id >= s_num_tarefas) return;
+
+    uint32_t agora = Eventos_Tempo_us();
+    AGENDADOR_ENTER_CRITICAL();
+    Liberar(id, agora);
+    AGENDADOR_EXIT_CRITICAL();
+}
+
+void Agendador_Tick_ms(void)
+{
+    if (s_tabela == NULL) return;
+
+    uint32_t agora = Eventos_Tempo_us();
+    for (uint8_t i = 0; i < s_num_tarefas; i++) {
+        uint16_t periodo = s_tabela[i].periodo_ms;
+        if (periodo == 0) continue;
+
+        if (--s_contador_ms[i] == 0) {
+            s_contador_ms[i] = periodo;
+            if (!Liberar(i, agora)) {
+                s_stats_tarefa[i].liberacoes_perdidas++;
+            }
+        }
+    }
+}
+
+bool Agendador_Executar(void)
+{
+    uint8_t id;
+    uint32_t liberacao;
+
+    AGENDADOR_ENTER_CRITICAL();
+    uint16_t prontas = s_prontas;
+    if (prontas == 0) {
+        AGENDADOR_EXIT_CRITICAL();
+        return false;
+    }
+    for (id = 0; (prontas & (1u << id)) == 0; id++) {
+    }
+    s_prontas = (uint16_t)(prontas & ~(1u << id));
+    liberacao = s_liberacao_us[id];
+    AGENDADOR_EXIT_CRITICAL();
+
+    const Tarefa_t* tarefa = &s_tabela[id];
+    uint32_t inicio = Eventos_Tempo_us();
+    tarefa->executar();
+    uint32_t fim = Eventos_Tempo_us();
+
+    TarefaStats_t* st = &s_stats_tarefa[id];
+    uint32_t exec = fim - inicio;
+    uint32_t latencia = inicio - liberacao;
+    st->execucoes++;
+    st->exec_total_us += exec;
+    if (exec > st->wcet_us) {
+        st->wcet_us = exec;
+    }
+    if (latencia > st->latencia_max_us) {
+        st->latencia_max_us = latencia;
+    }
+    if ((tarefa->deadline_ms != 0) && ((fim - liberacao) > ((uint32_t)tarefa->deadline_ms * 1000u))) {
+        st->deadlines_perdidos++;
+    }
+    return true;
+}
+
+void Agendador_Ocioso(void)
+{
+    uint32_t inicio = Eventos_Tempo_us();
+
+    // WFI com PRIMASK ativo: a IRQ pendente acorda o ncleo e s  atendida
+    // depois de __enable_irq(), sem janela entre o teste e o sono.
+    __disable_irq();
+    if (s_prontas != 0) {
+        __enable_irq();
+        return;
+    }
+    __WFI();
+    __enable_irq();
+
+    s_ocioso_us += (uint32_t)(Eventos_Tempo_us() - inicio);
+    s_dormidas++;
+}
+
+uint8_t Agendador_Num_Tarefas(void)
+{
+    return s_num_tarefas;
+}
+
+const char* Agendador_Nome(uint8_t id)
+{
+    return (id < s_num_tarefas) ? s_tabela[id].nome : "?";
+}
+
+void Agendador_Get_Stats(AgendadorStats_t* out)
+{
+    if (out == NULL) return;
+    out->ocioso_ms = (uint32_t)(s_ocioso_us / 1000u);
+    out->total_ms = HAL_GetTick() - s_inicio_janela_ms;
+    out->dormidas = s_dormidas;
+}
+
+void Agendador_Get_Stats_Tarefa(uint8_t id, TarefaStats_t* out)
+{
+    if ((out == NULL) || (id >= s_num_tarefas)) return;
+    AGENDADOR_ENTER_CRITICAL(); // liberacoes_perdidas  escrito pelo ISR
+    *out = s_stats_tarefa[id];
+    AGENDADOR_EXIT_CRITICAL();
+}
+
+void Agendador_Reset_Stats(void)
+{
+    AGENDADOR_ENTER_CRITICAL();
+    memset(s_stats_tarefa, 0, sizeof(s_stats_tarefa));
+    AGENDADOR_EXIT_CRITICAL();
+    s_ocioso_us = 0;
+    s_dormidas = 0;
+    s_inicio_janela_ms = HAL_GetTick();
+}
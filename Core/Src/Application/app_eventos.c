@@ -0,0 +1,255 @@
+/*******************************************************************************
+ * @file        app_eventos.c
+ * @brief       Fila de eventos com pool esttico de payloads.
+ * @details     Produtores (parser DWIN, CLI, base de tempo, sequncia de
+ * servos) publicam eventos, inclusive a partir de ISR. O superloop despacha
+ * um evento por iterao, executando os handlers inscritos e contabilizando
+ * tempo de execuo e latncia. Nenhuma alocao dinmica  usada.
+ ******************************************************************************/
+
+#include "app_eventos.h"
+#include "main.h"
+#include <string.h>
+
+//================================================================================
+// Definies e Variveis Internas
+//================================================================================
+
+// Seo crtica que preserva o estado anterior (pode ser chamada de ISR)
+#define EVENTOS_ENTER_CRITICAL()  uint32_t primask_salvo = __get_PRIMASK(); __disable_irq()
+#define EVENTOS_EXIT_CRITICAL()   __set_PRIMASK(primask_salvo)
+
+typedef struct {
+    Tipo_Evento_t    tipo;
+    EventoPayload_t* payload;
+    uint32_t         t_publicacao_us;
+} EventoFila_t;
+
+typedef struct {
+    Tipo_Evento_t           tipo;
+    Funcao_Handler_Evento_t handler;
+} EventoInscricao_t;
+
+static EventoFila_t s_fila[EVENTOS_FILA_TAMANHO];
+static volatile uint8_t s_fila_head = 0;
+static volatile uint8_t s_fila_tail = 0;
+
+static EventoPayload_t s_pool[EVENTOS_POOL_BLOCOS];
+static volatile uint8_t s_pool_livres = 0;   // bit i = bloco i livre
+
+static EventoInscricao_t s_inscricoes[EVENTOS_MAX_HANDLERS];
+static uint8_t s_num_inscricoes = 0;
+
+static volatile EventosStats_t s_stats;
+static EventosTipoStats_t s_stats_tipo[EV_NUM_TIPOS];
+
+static Funcao_Aviso_Evento_t s_aviso_publicacao = NULL;
+
+static const char* const s_nomes[EV_NUM_TIPOS] = {
+    "NONE", "UI_START", "UI_PASSWORD", "UI_NEW_PASSWORD", "UI_DATETIME",
+    "PROC_STARTED", "PROC_FINISHED", "AUTH_OK", "AUTH_FAIL", "SETTINGS",
+    "SERVO_STEP", "SERVO_END", "DWIN_FRAME", "CLI_CMD",
+    "FREQ_JANELA", "SERVO_MOV",
+};
+
+//================================================================================
+// Funes Privadas
+//================================================================================
+
+static EventoPayload_t* Pool_Alocar(void)
+{
+    EventoPayload_t* bloco = NULL;
+
+    EVENTOS_ENTER_CRITICAL();
+    for (uint8_t i = 0; i < EVENTOS_POOL_BLOCOS; i++) {
+        if (s_pool_livres & (1u << i)) {
+            s_pool_livres &= (uint8_t)~(1u << i);
+            bloco = &s_pool[i];
+            break;
+        }
+    }
+    EVENTOS_EXIT_CRITICAL();
+
+    return bloco;
+}
+
+static void Pool_Liberar(EventoPayload_t* bloco)
+{
+    if (bloco == NULL) return;
+
+    uint8_t i = (uint8_t)(bloco - s_pool);
+    EVENTOS_ENTER_CRITICAL();
+    s_pool_livres |= (uint8_t)(1u << i);
+    EVENTOS_EXIT_CRITICAL();
+}
+
+static bool Fila_Inserir(Tipo_Evento_t tipo, EventoPayload_t* payload)
+{
+    bool ok = false;
+    uint32_t agora = Eventos_Tempo_us();
+
+    EVENTOS_ENTER_CRITICAL();
+    uint8_t proximo = (uint8_t)((s_fila_head + 1u) % EVENTOS_FILA_TAMANHO);
+    if (proximo != s_fila_tail) {
+        s_fila[s_fila_head].tipo = tipo;
+        s_fila[s_fila_head].payload = payload;
+        s_fila[s_fila_head].t_publicacao_us = agora;
+        s_fila_head = proximo;
+        ok = true;
+
+        s_stats.publicados++;
+        s_stats.profundidade++;
+        if (s_stats.profundidade > s_stats.profundidade_max) {
+            s_stats.profundidade_max = s_stats.profundidade;
+        }
+    } else {
+        s_stats.descartados_fila++;
+    }
+    EVENTOS_EXIT_CRITICAL();
+
+    if (ok && (s_aviso_publicacao != NULL)) {
+        s_aviso_publicacao();
+    }
+    return ok;
+}
+
+//================================================================================
+// Funes Pblicas
+//================================================================================
+
+void Eventos_Init(void)
+{
+    s_fila_head = 0;
+    s_fila_tail = 0;
+    s_pool_livres = (uint8_t)((1u << EVENTOS_POOL_BLOCOS) - 1u);
+    s_num_inscricoes = 0;
+    Eventos_Reset_Stats();
+}
+
+void Eventos_Set_Aviso_Publicacao(Funcao_Aviso_Evento_t aviso)
+{
+    s_aviso_publicacao = aviso;
+}
+
+bool Eventos_Registrar(Tipo_Evento_t tipo, Funcao_Handler_Evento_t handler)
+{
+    if ((handler == NULL) || (tipo >= EV_NUM_TIPOS) || (s_num_inscricoes >= EVENTOS_MAX_HANDLERS)) {
+        return false;
+    }
+    s_inscricoes[s_num_inscricoes].tipo = tipo;
+    s_inscricoes[s_num_inscricoes].handler = handler;
+    s_num_inscricoes++;
+    return true;
+}
+
+bool Eventos_Post(Tipo_Evento_t tipo)
+{
+    if (tipo >= EV_NUM_TIPOS) return false;
+    return Fila_Inserir(tipo, NULL);
+}
+
+bool Eventos_Post_Payload(Tipo_Evento_t tipo, const void* dados, uint16_t tam)
+{
+    if ((tipo >= EV_NUM_TIPOS) || (dados == NULL) || (tam > sizeof(EventoPayload_t))) {
+        return false;
+    }
+
+    EventoPayload_t* bloco = Pool_Alocar();
+    if (bloco == NULL) {
+        EVENTOS_ENTER_CRITICAL();
+        s_stats.descartados_pool++;
+        EVENTOS_EXIT_CRITICAL();
+        return false;
+    }
+
+    memcpy(bloco, dados, tam);
+
+    if (!Fila_Inserir(tipo, bloco)) {
+        Pool_Liberar(bloco);
+        return false;
+    }
+    return true;
+}
+
+bool Eventos_Dispatch(void)
+{
+    EventoFila_t item;
+
+    EVENTOS_ENTER_CRITICAL();
+    if (s_fila_tail == s_fila_head) {
+        EVENTOS_EXIT_CRITICAL();
+        return false;
+    }
+    item = s_fila[s_fila_tail];
+    s_fila_tail = (uint8_t)((s_fila_tail + 1u) % EVENTOS_FILA_TAMANHO);
+    s_stats.profundidade--;
+    EVENTOS_EXIT_CRITICAL();
+
+    uint32_t inicio = Eventos_Tempo_us();
+    uint32_t latencia = inicio - item.t_publicacao_us;
+    if (latencia > s_stats.latencia_max_us) {
+        s_stats.latencia_max_us = latencia;
+    }
+
+    Evento_t evento = { item.tipo, item.payload };
+    for (uint8_t i = 0; i < s_num_inscricoes; i++) {
+        if (s_inscricoes[i].tipo == item.tipo) {
+            s_inscricoes[i].handler(evento);
+        }
+    }
+
+    uint32_t exec = Eventos_Tempo_us() - inicio;
+    EventosTipoStats_t* st = &s_stats_tipo[item.tipo];
+    st->contagem++;
+    st->exec_total_us += exec;
+    if (exec > st->exec_max_us) {
+        st->exec_max_us = exec;
+    }
+    s_stats.despachados++;
+
+    Pool_Liberar(item.payload);
+    return true;
+}
+
+uint32_t Eventos_Tempo_us(void)
+{
+    uint32_t ms;
+    uint32_t val;
+    do {
+        ms  = HAL_GetTick();
+        val = SysTick->VAL;
+    } while (ms != HAL_GetTick());
+
+    uint32_t load = SysTick->LOAD + 1u;
+    return (ms * 1000u) + (((load - val) * 1000u) / load);
+}
+
+void Eventos_Get_Stats(EventosStats_t* out)
+{
+    if (out == NULL) return;
+    EVENTOS_ENTER_CRITICAL();
+    *out = s_stats;
+    EVENTOS_EXIT_CRITICAL();
+}
+
+void Eventos_Get_Stats_Tipo(Tipo_Evento_t tipo, EventosTipoStats_t* out)
+{
+    if ((out == NULL) || (tipo >= EV_NUM_TIPOS)) return;
+    *out = s_stats_tipo[tipo];
+}
+
+void Eventos_Reset_Stats(void)
+{
+    EVENTOS_ENTER_CRITICAL();
+    uint8_t profundidade = s_stats.profundidade;
+    memset((void*)&s_stats, 0, sizeof(s_stats));
+    s_stats.profundidade = profundidade;
+    s_stats.profundidade_max = profundidade;
+    EVENTOS_EXIT_CRITICAL();
+    memset(s_stats_tipo, 0, sizeof(s_stats_tipo));
+}
+
+const char* Eventos_Nome(Tipo_Evento_t tipo)
+{
+    return (tipo < EV_NUM_TIPOS) ? s_nomes[tipo] : "?";
+}
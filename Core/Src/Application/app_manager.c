@@ -21,46 +21,127 @@ static SystemState_t s_current_state = STATE_ACTIVE;
 static volatile bool s_go_to_sleep_request = false;
 static volatile bool s_wakeup_confirmed = false;
 
+// --- Sequncia de energia do display (entrada em STOP e retomada) ---
+#define SONO_DEBOUNCE_MS           500   // boto de desligar: espera a soltura
+#define DISPLAY_SINAL_MIN_MS        20   // aps cada passo, antes de testar o sinal
+#define DISPLAY_SINAL_MAX_MS       800   // antigo atraso fixo, agora s o limite
+#define DISPLAY_BOOT_TIMEOUT_MS   2000   // display sem responder: segue assim mesmo
+#define WAKE_STOP_CURTO_S         1800   // STOP curto: dispensa o autodiagnstico
+#define CONFIRMA_TIMEOUT_MS       5000
+#define CONFIG_SALVAR_MAX_MS      3000   // EEPROM sem responder: dorme sem gravar
+
+typedef enum {
+    PREP_DEBOUNCE,
+    PREP_DRENAR_TX,
+    PREP_DESLIGAR_DISPLAY,
+    PREP_HABILITAR_TOQUE
+} PrepStop_t;
+
+static PrepStop_t s_prep_fase = PREP_DEBOUNCE;
+static uint32_t s_prep_tick = 0;
+
 // --- Variveis para o modo de confirmao de "acordar" ---
 static uint32_t s_confirm_start_tick = 0;
 static uint32_t s_countdown_last_tick = 0;
 
+// --- Retomada rpida ---
+static WakeStats_t s_wake;
+static uint32_t s_sono_pedido_tick = 0;
+static uint32_t s_stop_inicio_s = 0;        // relgio RTC ao entrar em STOP
+static bool     s_stop_inicio_valido = false;
+static uint32_t s_wake_tick = 0;
+static uint32_t s_display_frames_ref = 0;
+
+// --- Autodiagnstico no bloqueante ---
+static DiagResultado_t s_diag;
+static uint8_t  s_diag_tela_retorno = 0;
+static uint8_t  s_diag_passo_tela = 0;      // passo cuja tela est visvel
+static uint32_t s_diag_tela_inicio = 0;
+static uint32_t s_diag_janela_freq = 0;     // janela de frequncia no incio do teste
+
 //================================================================================
 // Prottipos de Funes Privadas
 //================================================================================
 
-static void Task_Handle_High_Frequency_Polling(void);
+static void Tarefa_Cli_Rx(void);
+static void Tarefa_Dwin_Rx(void);
+static void Tarefa_Eventos(void);
+static void Tarefa_Cli_Tx(void);
+static void Tarefa_Dwin_Tx(void);
+static void Tarefa_Medicao(void);
+static void Tarefa_Display(void);
+static void Tarefa_Config(void);
+static void Aviso_Evento_Publicado(void);
 static void EnterStopMode(void);
 static void HandleWakeUpSequence(void);
-static bool Test_DisplayInfo(void);
-static bool Test_Servos(void);
-static bool Test_Capacimetro(void);
-static bool Test_Balanca(void);
-static bool Test_Termometro(void);
-static bool Test_EEPROM(void);
-static bool Test_RTC(void);
+static void Stop_Iniciar_Preparacao(void);
+static bool Stop_Preparacao_Concluida(void);
+static bool Sinal_Display_Estavel(void);
+static bool Wake_Display_Pronto(void);
+static void Wake_Concluir(void);
+static bool Rtc_Segundos(uint32_t* segundos);
+static void Tarefa_Diagnostico(void);
+static void Diag_Mostrar_Passo(uint8_t indice);
+static void Diag_Finalizar(void);
+static DiagStatus_t Test_DisplayInfo(bool inicio);
+static DiagStatus_t Test_Servos(bool inicio);
+static DiagStatus_t Test_Capacimetro(bool inicio);
+static DiagStatus_t Test_Balanca(bool inicio);
+static DiagStatus_t Test_Termometro(bool inicio);
+static DiagStatus_t Test_EEPROM(bool inicio);
+static DiagStatus_t Test_RTC(bool inicio);
+static void On_Servo_Event(Evento_t evento);
 
 //================================================================================
 // Implementao das Funes Pblicas
 //================================================================================
 
+// Os testes rodam todos em paralelo desde o incio; o tempo de exibio 
+// apenas o mnimo de cada tela. O tempo at a tela de retorno fica limitado
+// pelo teste mais lento (tipicamente a tara), no pela soma das telas.
 static const DiagnosticStep_t s_diagnostic_steps[] = {
-    {"Exibindo Logo e Versoes...",  LOGO,                3000, Test_DisplayInfo},
-    {"Verificando Servos...",       BOOT_CHECK_SERVOS,   1200, Test_Servos},
-    {"Verificando Medidor Freq...", BOOT_CHECK_CAPACI,   1200, Test_Capacimetro},
-    {"Verificando Balanca...",      BOOT_BALANCE,        1000, Test_Balanca},
-    {"Verificando Termometro...",   BOOT_THERMOMETER,    1000, Test_Termometro},
-    {"Verificando Memoria EEPROM...", BOOT_MEMORY,       1100, Test_EEPROM},
-    {"Verificando RTC...",          BOOT_CLOCK,          1100, Test_RTC},
+    /* descricao                      tela                exib.  timeout critico teste */
+    {"Exibindo Logo e Versoes...",    LOGO,                1500,    100, false, Test_DisplayInfo},
+    {"Verificando Servos...",         BOOT_CHECK_SERVOS,    300,    100, false, Test_Servos},
+    {"Verificando Medidor Freq...",   BOOT_CHECK_CAPACI,    300,   3000, false, Test_Capacimetro},
+    {"Verificando Balanca...",        BOOT_BALANCE,         300,   8000, false, Test_Balanca},
+    {"Verificando Termometro...",     BOOT_THERMOMETER,     300,    100, false, Test_Termometro},
+    {"Verificando Memoria EEPROM...", BOOT_MEMORY,          300,    100, true,  Test_EEPROM},
+    {"Verificando RTC...",            BOOT_CLOCK,           300,    100, false, Test_RTC},
 };
 static const size_t NUM_DIAGNOSTIC_STEPS = sizeof(s_diagnostic_steps) / sizeof(s_diagnostic_steps[0]);
 
+// Tabela do agendador (ordem = TarefaApp_t = prioridade). Tarefas de I/O
+// tambm so sinalizadas pelos ISRs de UART; o perodo  a garantia de
+// progresso para trabalho que no gera interrupo (printf, paginao).
+static const Tarefa_t s_tarefas[NUM_TAREFAS_APP] = {
+    /* nome       funcao                       periodo  deadline (ms) */
+    {"CLI_RX",   Tarefa_Cli_Rx,                  10,      10},
+    {"DWIN_RX",  Tarefa_Dwin_Rx,                 10,      10},
+    {"EVENTOS",  Tarefa_Eventos,                  0,      50},
+    {"CLI_TX",   Tarefa_Cli_Tx,                   5,      10},
+    {"DWIN_TX",  Tarefa_Dwin_Tx,                  5,      10},
+    {"MEDICAO",  Tarefa_Medicao,                 10,      20},
+    {"DISPLAY",  Tarefa_Display,                 10,      50},
+    {"CONFIG",   Tarefa_Config,                  20,     100},
+    {"DIAG",     Tarefa_Diagnostico,             10,      20},
+};
+
 
 void App_Manager_Init(void) {
 
+    Perfil_Init(); // base de tempo do profiler antes de qualquer ponto instrumentado
+    Eventos_Init(); // antes dos mdulos que se inscrevem em eventos
+    Eventos_Set_Aviso_Publicacao(Aviso_Evento_Publicado);
+    Log_Init();
     CLI_Init(&huart1);
 		printf("Debug: CLI_Init OK\r\n"); HAL_Delay(10);
     DWIN_Driver_Init(&huart2, Controller_DwinCallback);
+    DWIN_Driver_SetPageChangeCallback(Controller_PageChangeCallback);
+    Eventos_Registrar(EV_DWIN_FRAME_RECEIVED, Controller_Handle_Frame_Event);
+    Eventos_Registrar(EV_SERVOS_SEQUENCE_STEP_CHANGED, On_Servo_Event);
+    Eventos_Registrar(EV_SERVOS_SEQUENCE_FINISHED, On_Servo_Event);
+    Eventos_Registrar(EV_SERVO_MOVIMENTO_FIM, On_Servo_Event);
 		printf("Debug: DWIN_Driver_Init OK\r\n"); HAL_Delay(10);
     EEPROM_Driver_Init(&hi2c1);
 		printf("Debug: EEPROM_Driver_Init OK\r\n"); HAL_Delay(10);
@@ -70,8 +151,9 @@ void App_Manager_Init(void) {
     Medicao_Init();
     DisplayHandler_Init();
     Servos_Init();
+    Sequencia_Init();
     Frequency_Init();
-    ADS1232_Init();
+    TempSensor_Init(); // varredura contnua do ADC por DMA
 
     // Etapa 3: Carrega Configuraes
     printf("Sistema Integrado - Log de Inicializacao:\r\n");
@@ -82,45 +164,71 @@ void App_Manager_Init(void) {
     } else {
         printf("[OK]\r\n");
     }
+    Deriva_Init(); // modelo de deriva trmica vem com a configurao
+    ADS1232_Init(); // idem para a compensao de temperatura da clula
 		CLI_TX_Pump();
     Medicao_Set_Densidade(71.0);
     Medicao_Set_Umidade(25.73);
+
+    Agendador_Init(s_tarefas, NUM_TAREFAS_APP);
 }
 
 void App_Manager_Process(void) {
 
+    PERFIL_LOOP();
+
+    if (s_current_state == STATE_STOPPED) {
+        EnterStopMode();          // retorna s aps o toque acordar o MCU
+        HandleWakeUpSequence();   // restaurao seletiva + religa o display
+        s_current_state = STATE_WAKING;
+        return;
+    }
+
+    // Fora do STOP o agendador continua servindo I/O, eventos e medies:
+    // uma tarefa por volta (a de maior prioridade); sem nenhuma pronta, dorme
+    if (!Agendador_Executar()) {
+        Agendador_Ocioso();
+    }
+
     switch (s_current_state) {
         case STATE_ACTIVE:
-            Task_Handle_High_Frequency_Polling();
-            Medicao_Process();
-            DisplayHandler_Process();
-            Gerenciador_Config_Run_FSM();
-
             if (s_go_to_sleep_request) {
                 s_go_to_sleep_request = false;
+                Stop_Iniciar_Preparacao();
+            }
+            break;
+
+        case STATE_PREPARING_STOP:
+            if (Stop_Preparacao_Concluida()) {
                 s_current_state = STATE_STOPPED;
             }
             break;
 
-        case STATE_STOPPED:
-            EnterStopMode();
-            HandleWakeUpSequence();
-            s_current_state = STATE_CONFIRM_WAKEUP;
+        case STATE_WAKING:
+            if (Wake_Display_Pronto()) {
+                DWIN_Driver_SetScreen(TELA_CONFIRM_WAKEUP);
+                s_wake.tela_confirmacao_ms = HAL_GetTick() - s_wake_tick;
+                s_confirm_start_tick = HAL_GetTick();
+                s_countdown_last_tick = s_confirm_start_tick;
+                s_wakeup_confirmed = false;
+                s_current_state = STATE_CONFIRM_WAKEUP;
+            }
             break;
 
         case STATE_CONFIRM_WAKEUP:
+            // O boto de confirmao chega como evento DWIN (tarefas DWIN_RX/EVENTOS)
             if (s_wakeup_confirmed) {
                 s_wakeup_confirmed = false;
                 s_current_state = STATE_ACTIVE;
                 printf("Confirmado! Retornando ao modo ativo.\r\n");
-                App_Manager_Run_Self_Diagnostics(PRINCIPAL);
+                Wake_Concluir();
                 break;
             }
 
             // Lgica de timeout para a tela de confirmao
-            if (HAL_GetTick() - s_confirm_start_tick > 5000) {
+            if (HAL_GetTick() - s_confirm_start_tick > CONFIRMA_TIMEOUT_MS) {
                 printf("Timeout! Voltando para o modo Stop.\r\n");
-                s_current_state = STATE_STOPPED;
+                Stop_Iniciar_Preparacao();
                 break;
             }
 
@@ -128,17 +236,18 @@ void App_Manager_Process(void) {
             if (HAL_GetTick() - s_countdown_last_tick >= 1000) {
                 s_countdown_last_tick = HAL_GetTick();
                 uint32_t elapsed_ms = HAL_GetTick() - s_confirm_start_tick;
-                uint32_t remaining_seconds = (elapsed_ms > 5000) ? 0 : (5 - (elapsed_ms / 1000));
+                uint32_t remaining_seconds = (elapsed_ms > CONFIRMA_TIMEOUT_MS) ? 0 : ((CONFIRMA_TIMEOUT_MS / 1000) - (elapsed_ms / 1000));
                 DWIN_Driver_WriteInt(VP_REGRESSIVA, remaining_seconds);
             }
-						DWIN_TX_Pump();
-            DWIN_Driver_Process();
+            break;
+
+        default:
             break;
     }
 }
 
 void App_Manager_Request_Sleep(void) {
-    HAL_Delay(500); // Debounce de software para o boto de desligar
+    // O debounce do boto de desligar  feito na preparao (sem bloquear)
     s_go_to_sleep_request = true;
 }
 
@@ -146,171 +255,547 @@ void App_Manager_Confirm_Wakeup(void) {
     s_wakeup_confirmed = true;
 }
 
+void App_Manager_Get_Wake_Stats(WakeStats_t* out) {
+    if (out != NULL) {
+        *out = s_wake;
+    }
+}
+
+void App_Manager_Imprimir_Wake(void) {
+    if (s_wake.despertares == 0) {
+        printf("Wake: nenhum despertar desde o boot.\r\n");
+        return;
+    }
+    printf("Wake #%lu: entrada=%lu ms, STOP=", (unsigned long)s_wake.despertares,
+           (unsigned long)s_wake.entrada_stop_ms);
+    if (s_wake.duracao_stop_s == UINT32_MAX) {
+        printf("? s");
+    } else {
+        printf("%lu s", (unsigned long)s_wake.duracao_stop_s);
+    }
+    printf(", display=%lu ms%s, confirmacao=%lu ms, pronto=%lu ms, %s\r\n",
+           (unsigned long)s_wake.display_pronto_ms, s_wake.display_timeout ? " (timeout)" : "",
+           (unsigned long)s_wake.tela_confirmacao_ms, (unsigned long)s_wake.pronto_ms,
+           s_wake.diag_executado ? "com autodiagnostico" : "retomada rapida");
+}
+
+SystemState_t App_Manager_Get_State(void) {
+    return s_current_state;
+}
+
 bool App_Manager_Run_Self_Diagnostics(uint8_t return_tela) {
+    if (s_diag.em_execucao) {
+        return false;
+    }
+
     printf("\r\n>>> INICIANDO AUTODIAGNOSTICO <<<\r\n");
 
+    memset(&s_diag, 0, sizeof(s_diag));
+    s_diag.em_execucao = true;
+    s_diag.aprovado = true;
+    s_diag.num_passos = (uint8_t)NUM_DIAGNOSTIC_STEPS;
+    s_diag.inicio_ms = HAL_GetTick();
+    s_diag_tela_retorno = return_tela;
+
+    // Dispara todos os testes; os que no concluem na hora seguem na tarefa DIAG
     for (size_t i = 0; i < NUM_DIAGNOSTIC_STEPS; i++)
     {
         const DiagnosticStep_t* step = &s_diagnostic_steps[i];
-
-        printf("Diagnostico: %s\r\n", step->description);
-        DWIN_Driver_SetScreen(step->screen_id);
-        DWIN_TX_Pump(); // Garante que o comando seja enviado
-        
-        // Espera o tempo de exibio da tela
-        HAL_Delay(step->display_time_ms);
-
-        // Executa a funo de teste associada ao passo
-        if (step->execute_test != NULL)
-        {
-            if (!step->execute_test())
-            {
-                // A funo de teste j imprimiu a falha e mostrou a tela de erro
-                printf(">>> AUTODIAGNOSTICO FALHOU! <<<\r\n");
-                return false; // Interrompe em caso de falha
-            }
+        DiagStatus_t st = (step->execute_test != NULL) ? step->execute_test(true) : DIAG_OK;
+        s_diag.passos[i].status = st;
+        if (st != DIAG_EM_ANDAMENTO) {
+            s_diag.passos[i].duracao_ms = HAL_GetTick() - s_diag.inicio_ms;
         }
     }
 
-    printf(">>> AUTODIAGNOSTICO COMPLETO <<<\r\n\r\n");
-    DWIN_Driver_SetScreen(return_tela);
-    DWIN_TX_Pump();
-    
+    Diag_Mostrar_Passo(0);
+    Agendador_Sinalizar(TAREFA_DIAGNOSTICO);
     return true;
 }
 
+void App_Manager_Get_Diagnostico(DiagResultado_t* out) {
+    if (out != NULL) {
+        *out = s_diag;
+    }
+}
+
+void App_Manager_Imprimir_Diagnostico(void) {
+    static const char* const nomes_status[] = { "PEND", "EXEC", "OK", "FALHA" };
+
+    printf("Autodiagnostico: %s, %u falha(s), pronto em %lu ms%s\r\n",
+           s_diag.aprovado ? "APROVADO" : "REPROVADO", s_diag.falhas,
+           (unsigned long)s_diag.tempo_pronto_ms, s_diag.em_execucao ? " (em andamento)" : "");
+    for (uint8_t i = 0; i < s_diag.num_passos; i++) {
+        printf("  %-30s %-5s %5lu ms%s\r\n", s_diagnostic_steps[i].description,
+               nomes_status[s_diag.passos[i].status], (unsigned long)s_diag.passos[i].duracao_ms,
+               s_diagnostic_steps[i].critico ? " (critico)" : "");
+    }
+}
+
 //================================================================================
 // Implementao das Funes Privadas
 //================================================================================
 
 /**
- * @brief Agrupa as chamadas de polling de I/O de alta frequncia.
+ * @brief Linhas recebidas, edio e telemetria do console.
+ */
+static void Tarefa_Cli_Rx(void) {
+    PERFIL_INICIO(PERFIL_PONTO_CLI_RX);
+    CLI_Process();
+    PERFIL_FIM(PERFIL_PONTO_CLI_RX);
+}
+
+/**
+ * @brief Frames recebidos do display e polling de pgina.
+ */
+static void Tarefa_Dwin_Rx(void) {
+    PERFIL_INICIO(PERFIL_PONTO_DWIN_RX);
+    DWIN_Driver_Process();
+    PERFIL_FIM(PERFIL_PONTO_DWIN_RX);
+}
+
+/**
+ * @brief Um evento por execuo: com mais pendentes, volta  fila de prontas
+ *        e tarefas de maior prioridade podem intercalar.
  */
-static void Task_Handle_High_Frequency_Polling(void) {
+static void Tarefa_Eventos(void) {
+    PERFIL_INICIO(PERFIL_PONTO_EVENTOS);
+    if (Eventos_Dispatch()) {
+        Agendador_Sinalizar(TAREFA_EVENTOS);
+    }
+    PERFIL_FIM(PERFIL_PONTO_EVENTOS);
+}
+
+/**
+ * @brief Registros do log diferido e envio do FIFO do console.
+ */
+static void Tarefa_Cli_Tx(void) {
+    PERFIL_INICIO(PERFIL_PONTO_CLI_TX);
+    Log_Process();
+    Relatorio_Process();
     CLI_TX_Pump();
+    PERFIL_FIM(PERFIL_PONTO_CLI_TX);
+}
+
+/**
+ * @brief Lotes da fila TX do display (lanes de controle e dados).
+ */
+static void Tarefa_Dwin_Tx(void) {
+    PERFIL_INICIO(PERFIL_PONTO_DWIN_TX);
     DWIN_TX_Pump();
-    DWIN_Driver_Process();
-    CLI_Process();
-    Servos_Process();
+    PERFIL_FIM(PERFIL_PONTO_DWIN_TX);
 }
 
 /**
- * @brief Executa a sequncia para colocar o MCU em modo de baixo consumo.
+ * @brief Leitura da balana (Medicao_Process) e a sequncia de medio, que
+ *        avana com as leituras recm-consumidas.
  */
-static void EnterStopMode(void) {
+static void Tarefa_Medicao(void) {
+    PERFIL_INICIO(PERFIL_PONTO_MEDICAO);
+    Medicao_Process();
+    Sequencia_Process();
+    PERFIL_FIM(PERFIL_PONTO_MEDICAO);
+}
+
+/**
+ * @brief Sequncia de medio, bindings e tendncia da tela atual.
+ */
+static void Tarefa_Display(void) {
+    PERFIL_INICIO(PERFIL_PONTO_DISPLAY);
+    DisplayHandler_Process();
+    PERFIL_FIM(PERFIL_PONTO_DISPLAY);
+}
+
+/**
+ * @brief FSM de gravao assncrona das configuraes.
+ */
+static void Tarefa_Config(void) {
+    PERFIL_INICIO(PERFIL_PONTO_CONFIG);
+    Gerenciador_Config_Run_FSM();
+    PERFIL_FIM(PERFIL_PONTO_CONFIG);
+}
+
+/**
+ * @brief Toda publicao (inclusive de ISR) libera a tarefa de eventos.
+ */
+static void Aviso_Evento_Publicado(void) {
+    Agendador_Sinalizar(TAREFA_EVENTOS);
+}
+
+/**
+ * @brief Avana o autodiagnstico: consulta os testes pendentes e troca de
+ *        tela quando o teste do passo visvel concluiu e o mnimo passou.
+ */
+static void Tarefa_Diagnostico(void) {
+    if (!s_diag.em_execucao) {
+        return;
+    }
+
+    uint32_t agora = HAL_GetTick();
+    uint32_t decorrido = agora - s_diag.inicio_ms;
+
+    for (uint8_t i = 0; i < s_diag.num_passos; i++) {
+        const DiagnosticStep_t* step = &s_diagnostic_steps[i];
+        DiagResultadoPasso_t* r = &s_diag.passos[i];
+        if (r->status != DIAG_EM_ANDAMENTO) continue;
+
+        DiagStatus_t st = step->execute_test(false);
+        if ((st == DIAG_EM_ANDAMENTO) && (decorrido >= step->timeout_ms)) {
+            printf("   ... TIMEOUT: %s\r\n", step->description);
+            st = DIAG_FALHA;
+        }
+        if (st != DIAG_EM_ANDAMENTO) {
+            r->status = st;
+            r->duracao_ms = decorrido;
+        }
+    }
+
+    for (uint8_t i = 0; i < s_diag.num_passos; i++) {
+        if ((s_diag.passos[i].status == DIAG_FALHA) && s_diagnostic_steps[i].critico) {
+            s_diag.aprovado = false;
+            Diag_Finalizar(); // falha crtica: no espera as demais telas
+            return;
+        }
+    }
+
+    const DiagnosticStep_t* tela = &s_diagnostic_steps[s_diag_passo_tela];
+    if ((s_diag.passos[s_diag_passo_tela].status >= DIAG_OK) &&
+        ((agora - s_diag_tela_inicio) >= tela->display_time_ms)) {
+        if ((s_diag_passo_tela + 1u) < s_diag.num_passos) {
+            Diag_Mostrar_Passo((uint8_t)(s_diag_passo_tela + 1u));
+        } else {
+            Diag_Finalizar();
+        }
+    }
+}
+
+static void Diag_Mostrar_Passo(uint8_t indice) {
+    s_diag_passo_tela = indice;
+    s_diag_tela_inicio = HAL_GetTick();
+    printf("Diagnostico: %s\r\n", s_diagnostic_steps[indice].description);
+    DWIN_Driver_SetScreen(s_diagnostic_steps[indice].screen_id);
+}
+
+static void Diag_Finalizar(void) {
+    s_diag.falhas = 0;
+    for (uint8_t i = 0; i < s_diag.num_passos; i++) {
+        if (s_diag.passos[i].status == DIAG_FALHA) {
+            s_diag.falhas++;
+        }
+    }
+    s_diag.tempo_pronto_ms = HAL_GetTick() - s_diag.inicio_ms;
+    s_diag.em_execucao = false;
+
+    if (s_diag.aprovado) {
+        printf(">>> AUTODIAGNOSTICO COMPLETO <<<\r\n");
+        DWIN_Driver_SetScreen(s_diag_tela_retorno);
+    } else {
+        printf(">>> AUTODIAGNOSTICO FALHOU! <<<\r\n");
+        DWIN_Driver_SetScreen(MSG_ERROR); // Tela de erro genrica
+    }
+    App_Manager_Imprimir_Diagnostico();
+    printf("\r\n");
+}
+
+/**
+ * @brief Notificaes da sequncia de servos (substitui os ganchos previstos em servo_controle.c).
+ */
+static void On_Servo_Event(Evento_t evento) {
+    if (evento.type == EV_SERVOS_SEQUENCE_FINISHED) {
+        printf("Servos: sequencia finalizada.\r\n");
+    } else if (evento.type == EV_SERVO_MOVIMENTO_FIM) {
+        if (evento.payload != NULL) {
+            LOG1(SRV_MOVIMENTO_FIM, *(const ServoId_t*)evento.payload);
+        }
+    } else if (evento.payload != NULL) {
+        printf("Servos: passo %d\r\n", (int)*(const ServoStep_t*)evento.payload);
+    }
+}
+
+/**
+ * @brief Inicia a preparao para o STOP. O agendador segue rodando para
+ *        drenar os FIFOs de TX enquanto a sequncia do display avana.
+ */
+static void Stop_Iniciar_Preparacao(void) {
     printf("Entrando em modo Stop...\r\n");
+    s_sono_pedido_tick = HAL_GetTick();
+    s_prep_fase = PREP_DEBOUNCE;
+    s_prep_tick = s_sono_pedido_tick;
+    s_current_state = STATE_PREPARING_STOP;
+}
 
-    // Garante que todas as mensagens de log pendentes sejam enviadas
-    while (CLI_Driver_IsTxBusy() || DWIN_Driver_IsTxBusy()) {
-        CLI_TX_Pump();
-        DWIN_TX_Pump();
+/**
+ * @brief Aps um passo de energia, o sinal de toque do display (pull-down,
+ *        ativo em nvel alto) precisa assentar. Espera o nvel baixo em vez
+ *        de um atraso fixo; DISPLAY_SINAL_MAX_MS  s o limite.
+ */
+static bool Sinal_Display_Estavel(void) {
+    uint32_t decorrido = HAL_GetTick() - s_prep_tick;
+    if (decorrido < DISPLAY_SINAL_MIN_MS) {
+        return false;
+    }
+    return (HAL_GPIO_ReadPin(SINAL_DISPLAY_GPIO_Port, SINAL_DISPLAY_Pin) == GPIO_PIN_RESET) ||
+           (decorrido >= DISPLAY_SINAL_MAX_MS);
+}
+
+/**
+ * @brief Avana a sequncia de desligamento.
+ * @return true quando o MCU pode entrar em STOP.
+ */
+static bool Stop_Preparacao_Concluida(void) {
+    switch (s_prep_fase) {
+        case PREP_DEBOUNCE:
+            // O aprendizado da deriva vai para a EEPROM antes do STOP; o
+            // gerenciador recusa enquanto o bloco de sensores est sendo
+            // gravado. Com a EEPROM sem responder, dorme sem salvar.
+            if ((HAL_GetTick() - s_prep_tick) < SONO_DEBOUNCE_MS) {
+                return false;
+            }
+            if (!Deriva_Salvar() &&
+                ((HAL_GetTick() - s_prep_tick) < (SONO_DEBOUNCE_MS + CONFIG_SALVAR_MAX_MS))) {
+                return false;
+            }
+            s_prep_tick = HAL_GetTick();
+            s_prep_fase = PREP_DRENAR_TX;
+            return false;
+
+        case PREP_DRENAR_TX:
+            // Garante que todas as mensagens de log pendentes sejam enviadas
+            if (CLI_Driver_IsTxBusy() || DWIN_Driver_IsTxBusy()) {
+                return false;
+            }
+            if (Gerenciador_Config_Salvamento_Pendente() &&
+                ((HAL_GetTick() - s_prep_tick) < CONFIG_SALVAR_MAX_MS)) {
+                return false;
+            }
+            HAL_GPIO_WritePin(DISPLAY_PWR_CTRL_GPIO_Port, DISPLAY_PWR_CTRL_Pin, GPIO_PIN_SET);
+            s_prep_tick = HAL_GetTick();
+            s_prep_fase = PREP_DESLIGAR_DISPLAY;
+            return false;
+
+        case PREP_DESLIGAR_DISPLAY:
+            if (!Sinal_Display_Estavel()) {
+                return false;
+            }
+            HAL_GPIO_WritePin(HAB_TOUCH_GPIO_Port, HAB_TOUCH_Pin, GPIO_PIN_SET);
+            s_prep_tick = HAL_GetTick();
+            s_prep_fase = PREP_HABILITAR_TOQUE;
+            return false;
+
+        case PREP_HABILITAR_TOQUE:
+        default:
+            return Sinal_Display_Estavel();
     }
-    HAL_Delay(10);
+}
 
-    HAL_GPIO_WritePin(DISPLAY_PWR_CTRL_GPIO_Port, DISPLAY_PWR_CTRL_Pin, GPIO_PIN_SET);
-    HAL_Delay(800);
-    HAL_GPIO_WritePin(HAB_TOUCH_GPIO_Port, HAB_TOUCH_Pin, GPIO_PIN_SET);
-    HAL_Delay(800);
+/**
+ * @brief Entra em STOP. S retorna depois que o toque (EXTI) acorda o MCU.
+ */
+static void EnterStopMode(void) {
+    s_wake.entrada_stop_ms = HAL_GetTick() - s_sono_pedido_tick;
+    s_stop_inicio_valido = Rtc_Segundos(&s_stop_inicio_s);
 
+    // Um pulso do sinal durante a sequncia no pode acordar o MCU na hora
+    __HAL_GPIO_EXTI_CLEAR_RISING_IT(SINAL_DISPLAY_Pin);
     __HAL_PWR_CLEAR_FLAG(PWR_FLAG_WUF1);
+    TempSensor_Suspender();
     HAL_PWR_EnterSTOPMode(PWR_MAINREGULATOR_ON, PWR_STOPENTRY_WFI);
 }
 
 /**
- * @brief Executa a sequncia de hardware e software aps o MCU acordar.
+ * @brief Retomada aps o STOP: restaura s o que o STOP perde.
+ * @details O clock do sistema volta ao padro e precisa ser reconfigurado.
+ * Registradores de USART/DMA/timers so retidos, ento as UARTs no so
+ * reinicializadas e as filas dos drivers so preservadas; a recepo s 
+ * rearmada se tiver parado. O display  religado e a tela de confirmao
+ * espera a primeira resposta dele (STATE_WAKING), sem atrasos fixos.
  */
 static void HandleWakeUpSequence(void) {
-    // O cdigo continua daqui quando a interrupo de toque (EXTI) acorda o MCU
     SystemClock_Config();
+    s_wake_tick = HAL_GetTick();
+    s_wake.despertares++;
 
-    // Reinicializa perifricos que perdem configurao no modo Stop
-    MX_USART1_UART_Init();
-    MX_USART2_UART_Init();
-    DWIN_Driver_Init(&huart2, Controller_DwinCallback);
+    if (huart1.RxState != HAL_UART_STATE_BUSY_RX) {
+        CLI_Restart_Rx();
+    }
+    DWIN_Driver_Resume();
+    TempSensor_Retomar();
+
+    uint32_t agora_s;
+    if (s_stop_inicio_valido && Rtc_Segundos(&agora_s) && (agora_s >= s_stop_inicio_s)) {
+        s_wake.duracao_stop_s = agora_s - s_stop_inicio_s;
+    } else {
+        s_wake.duracao_stop_s = UINT32_MAX; // desconhecida: tratada como longa
+    }
 
     printf("\r\n>>> TOQUE DETECTADO! Entrando em modo de confirmacao... <<<\r\n");
 
     HAL_GPIO_WritePin(HAB_TOUCH_GPIO_Port, HAB_TOUCH_Pin, GPIO_PIN_RESET);
-    HAL_Delay(800);
     HAL_GPIO_WritePin(DISPLAY_PWR_CTRL_GPIO_Port, DISPLAY_PWR_CTRL_Pin, GPIO_PIN_RESET);
-    HAL_Delay(800);
+    s_display_frames_ref = DWIN_Driver_GetRxFrameCount();
+    s_wake.display_timeout = false;
+}
 
-    DWIN_Driver_SetScreen(TELA_CONFIRM_WAKEUP);
+/**
+ * @brief O display est pronto quando responde a qualquer leitura aps ser
+ *        religado (a leitura de pgina  antecipada a cada chamada).
+ */
+static bool Wake_Display_Pronto(void) {
+    uint32_t decorrido = HAL_GetTick() - s_wake_tick;
 
-    // Garante que o comando para mudar de tela seja enviado
-    while (DWIN_Driver_IsTxBusy()) {
-        DWIN_TX_Pump();
+    if (DWIN_Driver_GetRxFrameCount() != s_display_frames_ref) {
+        s_wake.display_pronto_ms = decorrido;
+        return true;
     }
+    if (decorrido >= DISPLAY_BOOT_TIMEOUT_MS) {
+        s_wake.display_pronto_ms = decorrido;
+        s_wake.display_timeout = true;
+        return true;
+    }
+    DWIN_Driver_RequestPageReadback();
+    return false;
+}
+
+/**
+ * @brief Confirmao recebida: com a sesso anterior saudvel e um STOP curto
+ *        o autodiagnstico  dispensado; caso contrrio, roda em segundo plano.
+ */
+static void Wake_Concluir(void) {
+    bool saudavel = (s_diag.num_passos > 0) && !s_diag.em_execucao && s_diag.aprovado && (s_diag.falhas == 0);
+    bool stop_curto = (s_wake.duracao_stop_s <= WAKE_STOP_CURTO_S);
+
+    s_wake.pronto_ms = HAL_GetTick() - s_wake_tick;
+    s_wake.diag_executado = !(saudavel && stop_curto);
 
-    s_confirm_start_tick = HAL_GetTick();
-    s_countdown_last_tick = s_confirm_start_tick;
-    s_wakeup_confirmed = false;
+    if (s_wake.diag_executado) {
+        App_Manager_Run_Self_Diagnostics(PRINCIPAL);
+    } else {
+        DWIN_Driver_SetScreen(PRINCIPAL);
+    }
+    App_Manager_Imprimir_Wake();
+}
+
+/**
+ * @brief Relgio do RTC em segundos desde 01/01/2000 (durao do STOP).
+ */
+static bool Rtc_Segundos(uint32_t* segundos) {
+    static const uint16_t dias_antes_mes[12] = { 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
+    uint8_t dia, mes, ano, hora, minuto, segundo;
+
+    if (!RTC_Driver_GetDate(&dia, &mes, &ano) || !RTC_Driver_GetTime(&hora, &minuto, &segundo) ||
+        (mes < 1) || (mes > 12) || (dia < 1)) {
+        return false;
+    }
+
+    uint32_t dias = (uint32_t)ano * 365u + ((uint32_t)ano + 3u) / 4u + dias_antes_mes[mes - 1] + (dia - 1u);
+    if ((mes > 2) && ((ano % 4u) == 0)) {
+        dias++;
+    }
+    *segundos = (dias * 86400u) + ((uint32_t)hora * 3600u) + ((uint32_t)minuto * 60u) + segundo;
+    return true;
 }
 
 // --- Implementao das Funes de Teste Individuais ---
+// Cada teste  chamado com inicio=true ao disparar o autodiagnstico e depois
+// a cada execuo da tarefa DIAG, at concluir. Nenhum deles pode bloquear.
 
 /** @brief Mostra as informaes de verso no display. Sempre retorna sucesso. */
-static bool Test_DisplayInfo(void)
+static DiagStatus_t Test_DisplayInfo(bool inicio)
 {
-    char nr_serial_buffer[17];
-    Gerenciador_Config_Get_Serial(nr_serial_buffer, sizeof(nr_serial_buffer));
-    
-    DWIN_Driver_WriteString(VP_HARDWARE, HARDWARE, strlen(HARDWARE));
-    DWIN_Driver_WriteString(VP_FIRMWARE, FIRMWARE, strlen(FIRMWARE));
-    DWIN_Driver_WriteString(VP_FIRM_IHM, FIRM_IHM, strlen(FIRM_IHM));
-    DWIN_Driver_WriteString(VP_SERIAL, nr_serial_buffer, strlen(nr_serial_buffer));
-    
-    // Espera a transmisso terminar para no sobrecarregar o buffer do DWIN
-    while (DWIN_Driver_IsTxBusy())
+    if (inicio)
     {
-        DWIN_TX_Pump();
+        char nr_serial_buffer[17];
+        Gerenciador_Config_Get_Serial(nr_serial_buffer, sizeof(nr_serial_buffer));
+
+        // A fila TX do DWIN envia em segundo plano (tarefa DWIN_TX)
+        DWIN_Driver_WriteString(VP_HARDWARE, HARDWARE, strlen(HARDWARE));
+        DWIN_Driver_WriteString(VP_FIRMWARE, FIRMWARE, strlen(FIRMWARE));
+        DWIN_Driver_WriteString(VP_FIRM_IHM, FIRM_IHM, strlen(FIRM_IHM));
+        DWIN_Driver_WriteString(VP_SERIAL, nr_serial_buffer, strlen(nr_serial_buffer));
     }
-    return true;
+    return DIAG_OK;
 }
 
 /** @brief Lgica de teste para os servos (atualmente apenas visual). */
-static bool Test_Servos(void) {
+static DiagStatus_t Test_Servos(bool inicio) {
     // Se houvesse uma forma de verificar o feedback dos servos, a lgica estaria aqui.
     // Como  um teste visual, simplesmente retornamos sucesso.
-    return true;
+    (void)inicio;
+    return DIAG_OK;
 }
 
-/** @brief Lgica de teste para o capacmetro (atualmente apenas visual). */
-static bool Test_Capacimetro(void) {
-    // Poderia ler a frequncia e verificar se est dentro de uma faixa esperada.
-    return true;
+/** @brief Presena de sinal no medidor de frequncia (uma janela de 1 s completa). */
+static DiagStatus_t Test_Capacimetro(bool inicio) {
+    DadosBrutos_t brutos;
+    Medicao_Get_Brutos(&brutos);
+
+    if (inicio) {
+        s_diag_janela_freq = brutos.Janelas_Frequencia;
+        return DIAG_EM_ANDAMENTO;
+    }
+    // A primeira janela aps o incio pode ser parcial: avalia a segunda
+    if ((brutos.Janelas_Frequencia - s_diag_janela_freq) < 2u) {
+        return DIAG_EM_ANDAMENTO;
+    }
+    if (brutos.Pulsos_Janela == 0) {
+        printf("   ... FALHA! Medidor de frequencia sem pulsos.\r\n");
+        return DIAG_FALHA;
+    }
+    return DIAG_OK;
 }
 
-/** @brief Executa a tara da balana como forma de teste. */
-static bool Test_Balanca(void) {
-    ADS1232_Tare(); // A prpria tara  um bom teste funcional.
-    // Para um teste mais robusto, poderamos verificar se o valor aps a tara  prximo de zero.
-    return true;
+/** @brief Tara incremental da balana (amostras entregues pela tarefa MEDICAO). */
+static DiagStatus_t Test_Balanca(bool inicio) {
+    if (inicio) {
+        ADS1232_Tare_Start(); // A prpria tara  um bom teste funcional.
+        return DIAG_EM_ANDAMENTO;
+    }
+    switch (ADS1232_Tare_GetState()) {
+        case ADS1232_TARA_OK:     return DIAG_OK;
+        case ADS1232_TARA_FALHOU: return DIAG_FALHA;
+        default:                  return DIAG_EM_ANDAMENTO;
+    }
 }
 
-/** @brief L a temperatura inicial e a armazena. */
-static bool Test_Termometro(void) {
+/** @brief L a temperatura inicial, armazena e verifica a faixa plausvel. */
+static DiagStatus_t Test_Termometro(bool inicio) {
+    (void)inicio;
+    if (!TempSensor_Pronto()) {
+        return DIAG_EM_ANDAMENTO; // primeira volta do buffer do ADC (~15 ms)
+    }
     float temp_inicial = TempSensor_GetTemperature(); 
     Medicao_Set_Temp_Instru(temp_inicial); // Usa o handler correto para armazenar o dado
-    printf("   ... Temperatura: %.2f C\r\n", temp_inicial);
-    // Um teste real poderia verificar se a temperatura est em uma faixa plausvel (ex: > 0 e < 100)
-    return true;
+    LOG1(SIS_TEMP_INICIAL, LOG_F(temp_inicial));
+    if ((temp_inicial < -20.0f) || (temp_inicial > 85.0f)) {
+        printf("   ... FALHA! Temperatura fora da faixa.\r\n");
+        return DIAG_FALHA;
+    }
+    return DIAG_OK;
 }
 
 /** @brief Verifica se a comunicao com a memria EEPROM est ativa. */
-static bool Test_EEPROM(void) {
+static DiagStatus_t Test_EEPROM(bool inicio) {
+    (void)inicio;
     if (!EEPROM_Driver_IsReady()) {
         printf("   ... FALHA! EEPROM nao responde.\r\n");
-        DWIN_Driver_SetScreen(MSG_ERROR); // Tela de erro genrica
-        DWIN_TX_Pump();
-        return false;
+        return DIAG_FALHA;
     }
     printf("   ... EEPROM OK.\r\n");
-    return true;
+    return DIAG_OK;
 }
 
-/** @brief Lgica de teste para o RTC (atualmente apenas visual). */
-static bool Test_RTC(void) {
-    // O RTC j foi inicializado. Um teste real poderia ler a data/hora e verificar se so vlidas.
-    return true;
-}
\ No newline at end of file
+/** @brief Verifica se o RTC mantm data e hora vlidas. */
+static DiagStatus_t Test_RTC(bool inicio) {
+    uint8_t dia, mes, ano, hora, minuto, segundo;
+    (void)inicio;
+
+    if (!RTC_Driver_GetDate(&dia, &mes, &ano) || !RTC_Driver_GetTime(&hora, &minuto, &segundo)) {
+        printf("   ... FALHA! RTC nao responde.\r\n");
+        return DIAG_FALHA;
+    }
+    if ((dia < 1) || (dia > 31) || (mes < 1) || (mes > 12) || (hora > 23) || (minuto > 59) || (segundo > 59)) {
+        printf("   ... FALHA! RTC com data/hora invalida.\r\n");
+        return DIAG_FALHA;
+    }
+    return DIAG_OK;
+}
@@ -11,8 +11,14 @@
 #include "dwin_driver.h"
 #include "app_manager.h"
 #include "medicao_handler.h"
+#include "sequencia_handler.h"
 #include "relato.h"
 #include "rtc_driver.h"
+#include "trend_handler.h"
+#include "app_eventos.h"
+#include "log_diferido.h"
+#include "controller.h"
+#include "memoria.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -22,8 +28,16 @@
 // Definies e Constantes
 //================================================================================
 #define CLI_RX_BUFFER_SIZE 128
-#define CLI_TX_FIFO_SIZE 1024
+#define CLI_TX_FIFO_SIZE 1024          // potncia de 2 (ndices livres com mscara)
 #define CLI_TX_DMA_BUFFER_SIZE 64
+#define CLI_TX_LINE_BUFFER_SIZE 64     // acumulador do printf (descarregado no '\n')
+#define CLI_RX_DMA_SIZE 256            // anel circular do DMA de RX (potncia de 2)
+#define CLI_CMD_FILA_TAMANHO 4         // linhas completas aguardando execuo
+#define CLI_HISTORICO_TAMANHO 4        // comandos lembrados (setas cima/baixo)
+#define CLI_TX_WAIT_MAX_MS 50          // limite da poltica CLI_TX_OVERFLOW_WAIT
+#define CLI_TLM_PERIODO_MIN_MS 10
+#define CLI_FRAME_BRUTO_MAX (1 + CLI_FRAME_PAYLOAD_MAX + 2)      // tipo + payload + CRC16
+#define CLI_FRAME_FIO_MAX   (CLI_FRAME_BRUTO_MAX + 1 + 2)        // + overhead COBS + delimitadores
 
 //================================================================================
 // Tipos de Dados e Estruturas
@@ -40,6 +54,16 @@ typedef struct {
 //================================================================================
 static void ProcessReceivedCommand(void);
 static void ShowPrompt(void);
+static void CLI_TX_Start_DMA(void);
+static void CLI_TX_Flush_Line(void);
+static uint16_t CLI_TX_Free(void);
+static void CLI_RX_Start(void);
+static void CLI_RX_Consumir(void);
+static uint32_t CLI_RX_Total_Escrito(void);
+static void CLI_RX_Byte(uint8_t ch);
+static uint16_t CRC16_CCITT(const uint8_t* data, uint16_t len);
+static uint16_t COBS_Encode(const uint8_t* in, uint16_t len, uint8_t* out);
+static void CLI_Telemetria_Process(void);
 
 // --- Handlers de Comando ---
 static void Cmd_Help(char* args);
@@ -47,16 +71,35 @@ static void Cmd_Dwin(char* args);
 static void Cmd_GetPeso(char* args);
 static void Cmd_GetTemp(char* args);
 static void Cmd_GetFreq(char* args);
+static void Cmd_GetUmidade(char* args);
+static void Cmd_Sequencia(char* args);
+#if ADS1232_TEMP_INTERLEAVE
+static void Cmd_TempBalanca(char* args);
+#endif
+static void Cmd_Deriva(char* args);
 static void Cmd_Service(char* args);
 static void Cmd_SetTime(char* args);
 static void Cmd_WhoAmI(char* args);
 static void Cmd_SetDate(char* args);
+static void Cmd_Trend(char* args);
+static void Cmd_Eventos(char* args);
+static void Cmd_Agendador(char* args);
+static void Cmd_Perf(char* args);
+static void Cmd_Memoria(char* args);
+static void Cmd_Diagnostico(char* args);
+static void Cmd_Wake(char* args);
+static void Cmd_TxQueue(char* args);
+static void Cmd_Log(char* args);
+static void Cmd_Telemetria(char* args);
+static void Cmd_Modo(char* args);
+static void CLI_Handle_Command_Event(Evento_t evento);
 
 // --- Handlers de Subcomando DWIN ---
 static void Handle_Dwin_PIC(char* sub_args);
 static void Handle_Dwin_INT(char* sub_args);
 static void Handle_Dwin_INT32(char* sub_args);
 static void Handle_Dwin_RAW(char* sub_args);
+static void Handle_Dwin_STAT(char* sub_args);
 
 // --- Funes Auxiliares ---
 static uint8_t HexCharToValue(char c);
@@ -70,24 +113,75 @@ static void FindAndExecuteCommand(const CliCommand_t* command_table, size_t tabl
 static UART_HandleTypeDef* s_huart_debug = NULL;
 
 // --- Buffers de Recepo (RX) ---
-static uint8_t s_cli_rx_byte;
-static char s_cli_rx_buffer[CLI_RX_BUFFER_SIZE];
-static uint16_t s_cli_rx_index = 0;
-static volatile bool s_is_command_ready = false;
+// DMA circular + idle-line: o ISR s publica quantos bytes chegaram;
+// a montagem das linhas, o eco e a edio rodam no superloop.
+static uint8_t s_rx_dma[CLI_RX_DMA_SIZE];
+static volatile uint32_t s_rx_total = 0;     // bytes escritos pelo DMA (contador livre)
+static volatile uint16_t s_rx_dma_pos = 0;   // ltima posio reportada pelo HAL
+static volatile bool s_rx_erro = false;
+static uint32_t s_rx_lidos = 0;              // bytes j consumidos pelo superloop
+
+// Linha em edio
+static char s_linha[CLI_RX_BUFFER_SIZE];
+static uint8_t s_linha_len = 0;
+static bool s_ultimo_cr = false;             // ignora o '\n' de um par "\r\n"
+static bool s_descartar_linha = false;       // linha corrompida por overflow do anel
+static uint8_t s_esc_estado = 0;             // 0: normal, 1: ESC, 2: ESC [
+
+// Comandos completos aguardando o evento EV_CLI_COMMAND_READY
+static char s_cmd_fila[CLI_CMD_FILA_TAMANHO][CLI_RX_BUFFER_SIZE];
+static uint8_t s_cmd_head = 0;
+static uint8_t s_cmd_tail = 0;
+static char s_cmd_atual[CLI_RX_BUFFER_SIZE];
+static bool s_command_event_posted = false;
+
+// Histrico (modo humano)
+static char s_historico[CLI_HISTORICO_TAMANHO][CLI_RX_BUFFER_SIZE];
+static uint8_t s_hist_head = 0;
+static uint8_t s_hist_count = 0;
+static int8_t s_hist_nav = -1;
+
+static CliModo_t s_modo = CLI_MODO_HUMANO;
+static CliRxStats_t s_rx_stats;
 
 // --- Buffers e Controle de Transmisso (TX) ---
+// Anel SPSC: produtor = printf/CLI_Write (superloop), consumidor = CLI_TX_Pump
+// (superloop). ndices livres (uint16) mascarados; cada lado s escreve o seu.
 static uint8_t s_cli_tx_fifo[CLI_TX_FIFO_SIZE];
 static volatile uint16_t s_tx_fifo_head = 0;
 static volatile uint16_t s_tx_fifo_tail = 0;
 static uint8_t s_cli_tx_dma_buffer[CLI_TX_DMA_BUFFER_SIZE];
 static volatile bool s_is_dma_tx_busy = false;
+static bool s_stream_aberto = false;         // DMA reservado para CLI_Stream_Enviar
+
+// Acumulador de linha do printf: uma nica escrita no anel por linha
+static uint8_t s_tx_line[CLI_TX_LINE_BUFFER_SIZE];
+static uint8_t s_tx_line_len = 0;
+
+// --- Telemetria ---
+static CliTelemetriaConfig_t s_tlm_config = { false, 100, TLM_MASCARA_TODOS };
+static CliTelemetriaStats_t s_tlm_stats;
+static uint32_t s_tlm_ultimo_tick = 0;
+static uint16_t s_tlm_seq = 0;
+static uint16_t s_tlm_estado_reportado[2] = { 0xFFFF, 0xFFFF }; // por TlmMaquina_t
+
+static CliTxOverflowPolicy_t s_tx_policy = CLI_TX_OVERFLOW_DROP_NEWEST;
+static CliTxStats_t s_tx_stats;
 
 // --- Tabela de Comandos ---
 static const CliCommand_t s_command_table[] = {
     {"HELP", Cmd_Help},    {"?", Cmd_Help},       {"DWIN", Cmd_Dwin},
     {"PESO", Cmd_GetPeso}, {"TEMP", Cmd_GetTemp}, {"FREQ", Cmd_GetFreq},
+#if ADS1232_TEMP_INTERLEAVE
+    {"BTEMP", Cmd_TempBalanca},
+#endif
+    {"DERIVA", Cmd_Deriva},
     {"SERVICE", Cmd_Service}, {"WHO_AM_I", Cmd_WhoAmI}, {"TIME", Cmd_SetTime},
-    {"DATE", Cmd_SetDate},
+    {"DATE", Cmd_SetDate}, {"TREND", Cmd_Trend}, {"UMID", Cmd_GetUmidade},
+    {"SEQ", Cmd_Sequencia},
+    {"EVT", Cmd_Eventos}, {"SCHED", Cmd_Agendador}, {"PERF", Cmd_Perf}, {"MEM", Cmd_Memoria}, {"DIAG", Cmd_Diagnostico},
+    {"WAKE", Cmd_Wake}, {"TXQ", Cmd_TxQueue}, {"LOG", Cmd_Log},
+    {"TLM", Cmd_Telemetria}, {"MODO", Cmd_Modo},
 };
 static const size_t NUM_COMMANDS = sizeof(s_command_table) / sizeof(s_command_table[0]);
 
@@ -95,7 +189,8 @@ static const CliCommand_t s_dwin_subcommand_table[] = {
     {"PIC", Handle_Dwin_PIC},
     {"INT", Handle_Dwin_INT},
     {"INT32", Handle_Dwin_INT32},
-    {"RAW", Handle_Dwin_RAW}
+    {"RAW", Handle_Dwin_RAW},
+    {"STAT", Handle_Dwin_STAT}
 };
 static const size_t NUM_DWIN_SUBCOMMANDS = sizeof(s_dwin_subcommand_table) / sizeof(s_dwin_subcommand_table[0]);
 
@@ -107,11 +202,33 @@ static const char HELP_TEXT[] =
     "| DATE DD/MM/AA            | Define a data do sistema.                     |\r\n"
     "| PESO                     | Mostra a leitura atual da balanca.            |\r\n"
     "| TEMP                     | Mostra a leitura do sensor de temperatura.    |\r\n"
+#if ADS1232_TEMP_INTERLEAVE
+    "| BTEMP [RAZAO <n> <desc>] | Temperatura da celula e intercalacao no ADS.  |\r\n"
+    "| BTEMP COMP <zero> <ppm>  | Deriva: contagens/C (zero) e ppm/C (span).    |\r\n"
+#endif
     "| FREQ                     | Mostra a ultima leitura de frequencia.        |\r\n"
+    "| DERIVA [ON|OFF|RESET]    | Deriva termica da frequencia (Escala A).      |\r\n"
+    "| DERIVA REF <C>           | Temperatura em que a Cal A vale sem correcao. |\r\n"
+    "| UMID                     | Mostra a ultima serie de repeticoes.          |\r\n"
+    "| SEQ [START|STOP]         | Sequencia de medicao: tempos por passo (ms).  |\r\n"
     "| SERVICE                  | Entra na tela de servico.                     |\r\n"
+    "| TREND [ON|OFF]           | Habilita o grafico de tendencia (Monitor).    |\r\n"
+    "| TREND <ms> <dec> <ms_tx> | Amostragem, decimacao min/max e taxa de envio.|\r\n"
+    "| TXQ [NEW|OLD|WAIT|RESET] | Fila TX do console: politica e descartes.     |\r\n"
+    "| EVT [RESET]              | Estatisticas da fila de eventos.              |\r\n"
+    "| DIAG [RUN]               | Resultado do autodiagnostico; RUN reexecuta.  |\r\n"
+    "| WAKE                     | Tempos do ultimo despertar (STOP -> ativo).   |\r\n"
+    "| SCHED [RESET]            | Tarefas: execucao, latencia, prazos e carga.  |\r\n"
+    "| PERF [RESET]             | Perfil: handlers, periodo do loop e ISRs (us).|\r\n"
+    "| MEM                      | RAM estatica, orcamento e pico da pilha.      |\r\n"
+    "| LOG [<mod|ALL> <nivel>]  | Filtro do log binario (DEBUG..ERRO, OFF).     |\r\n"
+    "| TLM [ON|OFF]             | Telemetria binaria (ver telemetry_decoder.py).|\r\n"
+    "| TLM <ms> <mascara_hex>   | Periodo de amostragem e canais (ex: 100 FF).  |\r\n"
+    "| MODO [HUMANO|MAQUINA]    | Maquina: sem eco/prompt, 'OK' ao fim de cada. |\r\n"
     "| DWIN PIC <id>            | Muda a tela (ex: DWIN PIC 1).                 |\r\n"
     "| DWIN INT <addr_h> <val>  | Escreve int16 no VP (ex: DWIN INT 2190 1234). |\r\n"
     "| DWIN RAW <bytes_hex>     | Envia bytes crus para o DWIN (ex: 5AA5...).   |\r\n"
+    "| DWIN STAT [RESET]        | Fila TX do DWIN por lane e pagina atual.      |\r\n"
     "===========================================================================|\r\n";
 
 //================================================================================
@@ -120,51 +237,461 @@ static const char HELP_TEXT[] =
 
 void CLI_Init(UART_HandleTypeDef* debug_huart) {
     s_huart_debug = debug_huart;
-    if (HAL_UART_Receive_IT(s_huart_debug, &s_cli_rx_byte, 1) != HAL_OK) {
-        Error_Handler();
-    }
+    Eventos_Registrar(EV_CLI_COMMAND_READY, CLI_Handle_Command_Event);
+    CLI_RX_Start();
     printf("\r\nCLI Pronta. Digite 'HELP' para comandos.\r\n");
     ShowPrompt();
 }
 
 void CLI_Process(void) {
-    if (s_is_command_ready) {
-        ProcessReceivedCommand();
-        memset(s_cli_rx_buffer, 0, CLI_RX_BUFFER_SIZE);
-        s_cli_rx_index = 0;
-        s_is_command_ready = false;
-        ShowPrompt();
+    CLI_RX_Consumir();
+    CLI_Telemetria_Process();
+
+    // Um evento por comando: a linha sai da fila s quando o evento  despachado
+    if (s_cmd_head != s_cmd_tail && !s_command_event_posted) {
+        s_command_event_posted = Eventos_Post(EV_CLI_COMMAND_READY);
     }
 }
 
-void CLI_TX_Pump(void) {
-    if (s_is_dma_tx_busy || (s_tx_fifo_head == s_tx_fifo_tail)) {
+static void CLI_Handle_Command_Event(Evento_t evento) {
+    (void)evento;
+    s_command_event_posted = false;
+    if (s_cmd_head == s_cmd_tail) {
         return;
     }
+    memcpy(s_cmd_atual, s_cmd_fila[s_cmd_tail], CLI_RX_BUFFER_SIZE);
+    s_cmd_tail = (uint8_t)((s_cmd_tail + 1u) % CLI_CMD_FILA_TAMANHO);
+    s_rx_stats.comandos++;
 
-    // --- Seo Crtica ---
-    HAL_NVIC_DisableIRQ(USART1_IRQn);
-    HAL_NVIC_DisableIRQ(DMA1_Channel1_IRQn);
+    ProcessReceivedCommand();
+    ShowPrompt();
+}
+
+void CLI_Restart_Rx(void) {
+    HAL_UART_AbortReceive(s_huart_debug);
+    s_rx_erro = false;
+    s_linha_len = 0;
+    s_esc_estado = 0;
+    CLI_RX_Start();
+}
 
-    if (s_is_dma_tx_busy) { // Dupla verificao para segurana
-        HAL_NVIC_EnableIRQ(USART1_IRQn);
-        HAL_NVIC_EnableIRQ(DMA1_Channel1_IRQn);
+void CLI_Set_Modo(CliModo_t modo) {
+    s_modo = modo;
+    s_linha_len = 0;
+    s_esc_estado = 0;
+    s_hist_nav = -1;
+}
+
+CliModo_t CLI_Get_Modo(void) {
+    return s_modo;
+}
+
+void CLI_Get_Rx_Stats(CliRxStats_t* out) {
+    if (out != NULL) {
+        *out = s_rx_stats;
+    }
+}
+
+void CLI_TX_Pump(void) {
+    CLI_TX_Flush_Line(); // linha parcial (ex.: prompt) no fica presa no acumulador
+    CLI_TX_Start_DMA();
+}
+
+/**
+ * @brief Copia do anel para o buffer linear e dispara o DMA. Sem mascarar IRQs:
+ *        o ISR de TX s libera s_is_dma_tx_busy.
+ */
+static void CLI_TX_Start_DMA(void) {
+    if (s_is_dma_tx_busy || s_stream_aberto) {
         return;
     }
+
+    uint16_t tail = s_tx_fifo_tail;
+    uint16_t used = (uint16_t)(s_tx_fifo_head - tail);
+    if (used == 0) {
+        return;
+    }
+
+    uint16_t bytes_to_send = (used < CLI_TX_DMA_BUFFER_SIZE) ? used : CLI_TX_DMA_BUFFER_SIZE;
+    uint16_t idx = tail & (CLI_TX_FIFO_SIZE - 1);
+    uint16_t first = CLI_TX_FIFO_SIZE - idx;
+    if (first > bytes_to_send) first = bytes_to_send;
+
+    memcpy(s_cli_tx_dma_buffer, &s_cli_tx_fifo[idx], first);
+    memcpy(&s_cli_tx_dma_buffer[first], s_cli_tx_fifo, bytes_to_send - first);
+    s_tx_fifo_tail = (uint16_t)(tail + bytes_to_send);
+
     s_is_dma_tx_busy = true;
+    if (HAL_UART_Transmit_DMA(s_huart_debug, s_cli_tx_dma_buffer, bytes_to_send) != HAL_OK) {
+        s_is_dma_tx_busy = false;
+    }
+}
+
+static uint16_t CLI_TX_Free(void) {
+    return (uint16_t)(CLI_TX_FIFO_SIZE - (uint16_t)(s_tx_fifo_head - s_tx_fifo_tail));
+}
 
-    uint16_t bytes_to_send = 0;
-    while ((s_tx_fifo_tail != s_tx_fifo_head) && (bytes_to_send < CLI_TX_DMA_BUFFER_SIZE)) {
-        s_cli_tx_dma_buffer[bytes_to_send++] = s_cli_tx_fifo[s_tx_fifo_tail];
-        s_tx_fifo_tail = (s_tx_fifo_tail + 1) % CLI_TX_FIFO_SIZE;
+uint16_t CLI_Write(const uint8_t* data, uint16_t len) {
+    if (data == NULL || len == 0) {
+        return 0;
     }
 
-    HAL_NVIC_EnableIRQ(USART1_IRQn);
-    HAL_NVIC_EnableIRQ(DMA1_Channel1_IRQn);
-    // --- Fim da Seo Crtica ---
+    uint16_t free_space = CLI_TX_Free();
+
+    if (len > free_space) {
+        switch (s_tx_policy) {
+            case CLI_TX_OVERFLOW_DROP_OLDEST: {
+                // Seguro apenas porque produtor e consumidor rodam no superloop
+                uint16_t descartar = len - free_space;
+                if (descartar > (uint16_t)(s_tx_fifo_head - s_tx_fifo_tail)) {
+                    descartar = (uint16_t)(s_tx_fifo_head - s_tx_fifo_tail);
+                }
+                s_tx_fifo_tail = (uint16_t)(s_tx_fifo_tail + descartar);
+                s_tx_stats.bytes_descartados += descartar;
+                s_tx_stats.escritas_truncadas++;
+                free_space = CLI_TX_Free();
+                break;
+            }
+            case CLI_TX_OVERFLOW_WAIT: {
+                // Espera limitada; com IRQs mascaradas o DMA no conclui, ento desiste
+                uint32_t inicio = HAL_GetTick();
+                while (len > free_space && __get_PRIMASK() == 0u && !s_stream_aberto &&
+                       (HAL_GetTick() - inicio) < CLI_TX_WAIT_MAX_MS) {
+                    CLI_TX_Start_DMA();
+                    free_space = CLI_TX_Free();
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    uint16_t aceitos = (len <= free_space) ? len : free_space;
+    if (aceitos < len) {
+        s_tx_stats.bytes_descartados += (uint32_t)(len - aceitos);
+        s_tx_stats.escritas_truncadas++;
+    }
+
+    uint16_t head = s_tx_fifo_head;
+    uint16_t idx = head & (CLI_TX_FIFO_SIZE - 1);
+    uint16_t first = CLI_TX_FIFO_SIZE - idx;
+    if (first > aceitos) first = aceitos;
+
+    memcpy(&s_cli_tx_fifo[idx], data, first);
+    memcpy(s_cli_tx_fifo, &data[first], aceitos - first);
+    __DMB();
+    s_tx_fifo_head = (uint16_t)(head + aceitos); // publica o bloco de uma vez
 
-    if (bytes_to_send > 0 && HAL_UART_Transmit_DMA(s_huart_debug, s_cli_tx_dma_buffer, bytes_to_send) != HAL_OK) {
+    uint16_t used = (uint16_t)(s_tx_fifo_head - s_tx_fifo_tail);
+    if (used > s_tx_stats.high_water) {
+        s_tx_stats.high_water = used;
+    }
+    s_tx_stats.bytes_enfileirados += aceitos;
+
+    return aceitos;
+}
+
+bool CLI_Write_Frame(uint8_t tipo, const uint8_t* payload, uint16_t len) {
+    uint8_t bruto[CLI_FRAME_BRUTO_MAX];
+    uint8_t fio[CLI_FRAME_FIO_MAX];
+
+    if (len > CLI_FRAME_PAYLOAD_MAX || (payload == NULL && len > 0)) {
+        return false;
+    }
+
+    bruto[0] = tipo;
+    if (len > 0) {
+        memcpy(&bruto[1], payload, len);
+    }
+    uint16_t crc = CRC16_CCITT(bruto, (uint16_t)(len + 1));
+    bruto[len + 1] = (uint8_t)crc;
+    bruto[len + 2] = (uint8_t)(crc >> 8);
+
+    fio[0] = 0x00;
+    uint16_t n = COBS_Encode(bruto, (uint16_t)(len + 3), &fio[1]);
+    fio[n + 1] = 0x00;
+    n = (uint16_t)(n + 2);
+
+    // Texto pendente sai antes, preservando a ordem no fluxo
+    CLI_TX_Flush_Line();
+    if (CLI_TX_Free() < n) {
+        return false;
+    }
+    CLI_Write(fio, n);
+    return true;
+}
+
+bool CLI_Stream_Abrir(void) {
+    if (s_stream_aberto) {
+        return false;
+    }
+    CLI_TX_Flush_Line(); // o que j foi impresso fica no FIFO, antes do fluxo
+    s_stream_aberto = true;
+    return true;
+}
+
+bool CLI_Stream_Enviar(const uint8_t* data, uint16_t len) {
+    if (!s_stream_aberto || data == NULL || len == 0 || s_is_dma_tx_busy) {
+        return false;
+    }
+    s_is_dma_tx_busy = true;
+    if (HAL_UART_Transmit_DMA(s_huart_debug, (uint8_t*)data, len) != HAL_OK) {
         s_is_dma_tx_busy = false;
+        return false;
+    }
+    return true;
+}
+
+bool CLI_Stream_Livre(void) {
+    return !s_is_dma_tx_busy;
+}
+
+void CLI_Stream_Fechar(void) {
+    s_stream_aberto = false; // o FIFO retido volta a ser bombeado no prximo CLI_TX_Pump
+}
+
+void CLI_Set_Tx_Overflow_Policy(CliTxOverflowPolicy_t policy) {
+    s_tx_policy = policy;
+}
+
+CliTxOverflowPolicy_t CLI_Get_Tx_Overflow_Policy(void) {
+    return s_tx_policy;
+}
+
+void CLI_Get_Tx_Stats(CliTxStats_t* out) {
+    if (out != NULL) {
+        *out = s_tx_stats;
+    }
+}
+
+void CLI_Reset_Tx_Stats(void) {
+    memset(&s_tx_stats, 0, sizeof(s_tx_stats));
+}
+
+/**
+ * @brief CRC-16/CCITT-FALSE (poli 0x1021, inicial 0xFFFF), bit a bit para no gastar flash com tabela.
+ */
+static uint16_t CRC16_CCITT(const uint8_t* data, uint16_t len) {
+    uint16_t crc = 0xFFFF;
+    for (uint16_t i = 0; i < len; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (uint8_t b = 0; b < 8; b++) {
+            crc = (crc & 0x8000u) ? (uint16_t)((crc << 1) ^ 0x1021u) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+/**
+ * @brief Codificao COBS: remove todos os 0x00 do bloco (0x00 vira delimitador de frame).
+ * @return Tamanho codificado (no mximo len + len/254 + 1).
+ */
+static uint16_t COBS_Encode(const uint8_t* in, uint16_t len, uint8_t* out) {
+    uint16_t pos_codigo = 0;
+    uint16_t pos = 1;
+    uint8_t codigo = 1;
+
+    for (uint16_t i = 0; i < len; i++) {
+        if (in[i] == 0x00) {
+            out[pos_codigo] = codigo;
+            pos_codigo = pos++;
+            codigo = 1;
+        } else {
+            out[pos++] = in[i];
+            if (++codigo == 0xFF) {
+                out[pos_codigo] = codigo;
+                pos_codigo = pos++;
+                codigo = 1;
+            }
+        }
+    }
+    out[pos_codigo] = codigo;
+    return pos;
+}
+
+static void CLI_TX_Flush_Line(void) {
+    if (s_tx_line_len > 0) {
+        CLI_Write(s_tx_line, s_tx_line_len);
+        s_tx_line_len = 0;
+    }
+}
+
+static void CLI_RX_Start(void) {
+    s_rx_dma_pos = 0;
+    s_rx_total = 0;
+    s_rx_lidos = 0;
+    if (HAL_UARTEx_ReceiveToIdle_DMA(s_huart_debug, s_rx_dma, CLI_RX_DMA_SIZE) != HAL_OK) {
+        HAL_UART_AbortReceive(s_huart_debug);
+        if (HAL_UARTEx_ReceiveToIdle_DMA(s_huart_debug, s_rx_dma, CLI_RX_DMA_SIZE) != HAL_OK) {
+            Error_Handler();
+        }
+    }
+}
+
+/**
+ * @brief Bytes j escritos pelo DMA (contador livre). Os eventos do HAL s
+ *        chegam em meia transferncia, fim do anel e linha ociosa: no meio de
+ *        uma rajada o DMA est at meio anel  frente do ltimo evento. Sem o
+ *        contador do DMA, um superloop atrasado l posies j sobrescritas
+ *        sem detectar a perda.
+ */
+static uint32_t CLI_RX_Total_Escrito(void) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t total = s_rx_total;
+    uint16_t pos = s_rx_dma_pos;
+    uint16_t hw = (uint16_t)(CLI_RX_DMA_SIZE - __HAL_DMA_GET_COUNTER(s_huart_debug->hdmarx));
+    __set_PRIMASK(primask);
+
+    return total + (uint16_t)((hw - pos) & (CLI_RX_DMA_SIZE - 1u));
+}
+
+/**
+ * @brief Consome o anel do DMA. Para quando a fila de comandos enche
+ *        (os bytes continuam no anel at haver espao).
+ */
+static void CLI_RX_Consumir(void) {
+    if (s_rx_erro) {
+        s_rx_erro = false;
+        s_rx_stats.erros_uart++;
+        HAL_UART_AbortReceive(s_huart_debug);
+        s_linha_len = 0;
+        s_descartar_linha = true;
+        CLI_RX_Start();
+        return;
+    }
+
+    uint32_t total = CLI_RX_Total_Escrito();
+    uint32_t pendentes = total - s_rx_lidos;
+    if (pendentes > CLI_RX_DMA_SIZE) {
+        // O DMA deu a volta sobre dados no lidos: descarta tudo e a linha atual
+        s_rx_stats.bytes_perdidos += pendentes;
+        s_rx_lidos = total;
+        s_linha_len = 0;
+        s_descartar_linha = true;
+        return;
+    }
+
+    while (s_rx_lidos != total) {
+        if ((uint8_t)((s_cmd_head + 1u) % CLI_CMD_FILA_TAMANHO) == s_cmd_tail) {
+            return; // fila de comandos cheia: retoma aps o prximo despacho
+        }
+        CLI_RX_Byte(s_rx_dma[s_rx_lidos & (CLI_RX_DMA_SIZE - 1u)]);
+        s_rx_lidos++;
+        s_rx_stats.bytes_recebidos++;
+    }
+}
+
+static void CLI_Echo(const char* txt, uint16_t len) {
+    if (s_modo == CLI_MODO_HUMANO) {
+        CLI_Write((const uint8_t*)txt, len);
+    }
+}
+
+static void CLI_Redesenhar_Linha(void) {
+    CLI_Echo("\r\x1b[K> ", 6);
+    CLI_Echo(s_linha, s_linha_len);
+}
+
+static void CLI_Historico_Adicionar(void) {
+    if (s_hist_count > 0) {
+        uint8_t ultimo = (uint8_t)((s_hist_head + CLI_HISTORICO_TAMANHO - 1u) % CLI_HISTORICO_TAMANHO);
+        if (strcmp(s_historico[ultimo], s_linha) == 0) {
+            return; // no repete o ltimo
+        }
+    }
+    memcpy(s_historico[s_hist_head], s_linha, (size_t)s_linha_len + 1u);
+    s_hist_head = (uint8_t)((s_hist_head + 1u) % CLI_HISTORICO_TAMANHO);
+    if (s_hist_count < CLI_HISTORICO_TAMANHO) {
+        s_hist_count++;
+    }
+}
+
+static void CLI_Historico_Navegar(bool anterior) {
+    if (anterior && (s_hist_nav + 1) < (int8_t)s_hist_count) {
+        s_hist_nav++;
+    } else if (!anterior && s_hist_nav >= 0) {
+        s_hist_nav--;
+    } else {
+        return;
+    }
+
+    if (s_hist_nav < 0) {
+        s_linha_len = 0;
+    } else {
+        uint8_t idx = (uint8_t)((s_hist_head + CLI_HISTORICO_TAMANHO - 1u - (uint8_t)s_hist_nav) % CLI_HISTORICO_TAMANHO);
+        s_linha_len = (uint8_t)strlen(s_historico[idx]);
+        memcpy(s_linha, s_historico[idx], s_linha_len);
+    }
+    s_linha[s_linha_len] = '\0';
+    CLI_Redesenhar_Linha();
+}
+
+static void CLI_Linha_Concluida(void) {
+    CLI_Echo("\r\n", 2);
+
+    if (s_descartar_linha) {
+        s_descartar_linha = false;
+        s_linha_len = 0;
+        s_rx_stats.linhas_descartadas++;
+        return;
+    }
+    if (s_linha_len == 0) {
+        if (s_modo == CLI_MODO_HUMANO) {
+            CLI_Echo("> ", 2);
+        }
+        return;
+    }
+
+    s_linha[s_linha_len] = '\0';
+    if (s_modo == CLI_MODO_HUMANO) {
+        CLI_Historico_Adicionar();
+    }
+    memcpy(s_cmd_fila[s_cmd_head], s_linha, (size_t)s_linha_len + 1u);
+    s_cmd_head = (uint8_t)((s_cmd_head + 1u) % CLI_CMD_FILA_TAMANHO);
+    s_linha_len = 0;
+    s_hist_nav = -1;
+}
+
+/**
+ * @brief Edio de linha: CR/LF/CRLF, backspace, setas (histrico) e eco.
+ */
+static void CLI_RX_Byte(uint8_t ch) {
+    bool era_cr = s_ultimo_cr;
+    s_ultimo_cr = (ch == '\r');
+
+    if (s_esc_estado == 1) {
+        s_esc_estado = (ch == '[') ? 2 : 0;
+        return;
+    }
+    if (s_esc_estado == 2) {
+        s_esc_estado = 0;
+        if (s_modo == CLI_MODO_HUMANO && (ch == 'A' || ch == 'B')) {
+            CLI_Historico_Navegar(ch == 'A');
+        }
+        return;
+    }
+
+    if (ch == '\n' && era_cr) {
+        return;
+    }
+    if (ch == '\r' || ch == '\n') {
+        CLI_Linha_Concluida();
+    } else if (ch == 0x1B) {
+        s_esc_estado = 1;
+    } else if (ch == '\b' || ch == 127) {
+        if (s_linha_len > 0) {
+            s_linha_len--;
+            CLI_Echo("\b \b", 3);
+        }
+    } else if (isprint(ch)) {
+        if (s_linha_len < (CLI_RX_BUFFER_SIZE - 1)) {
+            s_linha[s_linha_len++] = (char)ch;
+            CLI_Echo((const char*)&ch, 1);
+        } else {
+            s_descartar_linha = true; // linha longa demais: no executa truncada
+        }
     }
 }
 
@@ -172,64 +699,181 @@ bool CLI_Driver_IsTxBusy(void)
 {
     // A transmisso est "ocupada" se o DMA ainda estiver enviando
     // OU se ainda houver dados na fila (FIFO) esperando para serem enviados.
-    return (s_is_dma_tx_busy || (s_tx_fifo_head != s_tx_fifo_tail));
+    return (s_is_dma_tx_busy || s_stream_aberto || (s_tx_fifo_head != s_tx_fifo_tail) ||
+            (s_tx_line_len > 0));
 }
 
-//================================================================================
-// Funes de Callback e de Interrupo
-//================================================================================
+bool CLI_Telemetria_Set_Config(const CliTelemetriaConfig_t* config) {
+    if (config == NULL || config->periodo_ms < CLI_TLM_PERIODO_MIN_MS ||
+        config->mascara == 0 || (config->mascara & (uint16_t)~TLM_MASCARA_TODOS) != 0) {
+        return false;
+    }
+    if (config->ativo && !s_tlm_config.ativo) {
+        // Nova sesso: reenvia os estados atuais e reinicia a contagem
+        s_tlm_estado_reportado[TLM_MAQUINA_APP] = 0xFFFF;
+        s_tlm_estado_reportado[TLM_MAQUINA_TELA] = 0xFFFF;
+        s_tlm_seq = 0;
+        memset(&s_tlm_stats, 0, sizeof(s_tlm_stats));
+        s_tlm_ultimo_tick = HAL_GetTick();
+    }
+    s_tlm_config = *config;
+    return true;
+}
 
-void CLI_Printf_Transmit(uint8_t ch) {
-    HAL_NVIC_DisableIRQ(USART1_IRQn);
-    HAL_NVIC_DisableIRQ(DMA1_Channel1_IRQn);
+void CLI_Telemetria_Get_Config(CliTelemetriaConfig_t* config) {
+    if (config != NULL) {
+        *config = s_tlm_config;
+    }
+}
 
-    if (ch == '\n') {
-        uint16_t next_head = (s_tx_fifo_head + 1) % CLI_TX_FIFO_SIZE;
-        if (next_head != s_tx_fifo_tail) {
-            s_cli_tx_fifo[s_tx_fifo_head] = '\r';
-            s_tx_fifo_head = next_head;
-        }
+void CLI_Telemetria_Get_Stats(CliTelemetriaStats_t* out) {
+    if (out != NULL) {
+        *out = s_tlm_stats;
     }
+}
+
+static void Put_U16_LE(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
 
-    uint16_t next_head = (s_tx_fifo_head + 1) % CLI_TX_FIFO_SIZE;
-    if (next_head != s_tx_fifo_tail) {
-        s_cli_tx_fifo[s_tx_fifo_head] = ch;
-        s_tx_fifo_head = next_head;
+static void Put_U32_LE(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t Float_Bits(float f) {
+    uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+/**
+ * @brief Envia TS(4) MAQUINA(1) ANTERIOR(2) NOVO(2) quando o estado muda.
+ *        Se o FIFO estiver cheio, tenta de novo na prxima volta.
+ */
+static void Telemetria_Verificar_Transicao(TlmMaquina_t maquina, uint16_t atual) {
+    uint16_t anterior = s_tlm_estado_reportado[maquina];
+    if (atual == anterior) {
+        return;
     }
 
-    HAL_NVIC_EnableIRQ(USART1_IRQn);
-    HAL_NVIC_EnableIRQ(DMA1_Channel1_IRQn);
+    uint8_t buf[9];
+    Put_U32_LE(&buf[0], HAL_GetTick());
+    buf[4] = (uint8_t)maquina;
+    Put_U16_LE(&buf[5], anterior);
+    Put_U16_LE(&buf[7], atual);
+    if (CLI_Write_Frame(CLI_FRAME_TIPO_TRANSICAO, buf, sizeof(buf))) {
+        s_tlm_estado_reportado[maquina] = atual;
+        s_tlm_stats.transicoes_enviadas++;
+    }
 }
 
-void CLI_HandleRxCplt(UART_HandleTypeDef *huart) {
-    if (s_is_command_ready) {
-        return; // Ignora bytes enquanto o comando anterior no for processado
+/**
+ * @brief Amostra: SEQ(2) TS(4) MASCARA(2) + 4 bytes por canal habilitado, em ordem de bit.
+ */
+static void Telemetria_Enviar_Amostra(uint32_t agora) {
+    uint8_t buf[8 + (TLM_NUM_CANAIS * 4)];
+    uint16_t pos = 8;
+    DadosMedicao_t med;
+    DadosBrutos_t brutos;
+
+    Medicao_Get_UltimaMedicao(&med);
+    Medicao_Get_Brutos(&brutos);
+
+    for (uint8_t ch = 0; ch < TLM_NUM_CANAIS; ch++) {
+        if ((s_tlm_config.mascara & (1u << ch)) == 0) {
+            continue;
+        }
+        uint32_t v;
+        switch ((TlmCanal_t)ch) {
+            case TLM_CANAL_ADC_BRUTO:   v = (uint32_t)brutos.Contagem_ADC; break;
+            case TLM_CANAL_PESO_G:      v = Float_Bits(med.Peso); break;
+            case TLM_CANAL_PULSOS:      v = brutos.Pulsos_Janela; break;
+            case TLM_CANAL_JANELA:      v = brutos.Janelas_Frequencia; break;
+            case TLM_CANAL_ESCALA_A:    v = Float_Bits(med.Escala_A); break;
+            case TLM_CANAL_TEMP_INSTRU: v = Float_Bits(med.Temp_Instru); break;
+#if ADS1232_TEMP_INTERLEAVE
+            case TLM_CANAL_TEMP_CELULA: {
+                float temp_celula = -273.0f;
+                (void)ADS1232_Get_Temperatura(&temp_celula);
+                v = Float_Bits(temp_celula);
+                break;
+            }
+#endif
+            default:
+                v = (uint32_t)App_Manager_Get_State() | ((uint32_t)Controller_GetCurrentScreen() << 16);
+                break;
+        }
+        Put_U32_LE(&buf[pos], v);
+        pos += 4;
     }
 
-    if (s_cli_rx_byte == '\r' || s_cli_rx_byte == '\n') {
-        if (s_cli_rx_index > 0) {
-            s_cli_rx_buffer[s_cli_rx_index] = '\0';
-            s_is_command_ready = true;
-            printf("\r\n");
-        } else {
-            ShowPrompt();
+    Put_U16_LE(&buf[0], s_tlm_seq++);
+    Put_U32_LE(&buf[2], agora);
+    Put_U16_LE(&buf[6], s_tlm_config.mascara);
+
+    if (CLI_Write_Frame(CLI_FRAME_TIPO_TELEMETRIA, buf, pos)) {
+        s_tlm_stats.amostras_enviadas++;
+    } else {
+        s_tlm_stats.amostras_descartadas++; // o host percebe a lacuna pelo SEQ
+    }
+}
+
+static void CLI_Telemetria_Process(void) {
+    if (!s_tlm_config.ativo) {
+        return;
+    }
+
+    Telemetria_Verificar_Transicao(TLM_MAQUINA_APP, (uint16_t)App_Manager_Get_State());
+    Telemetria_Verificar_Transicao(TLM_MAQUINA_TELA, Controller_GetCurrentScreen());
+
+    uint32_t agora = HAL_GetTick();
+    if ((agora - s_tlm_ultimo_tick) >= s_tlm_config.periodo_ms) {
+        s_tlm_ultimo_tick += s_tlm_config.periodo_ms;
+        if ((agora - s_tlm_ultimo_tick) >= s_tlm_config.periodo_ms) {
+            s_tlm_ultimo_tick = agora; // atrasou mais de um perodo: no tenta recuperar
         }
-    } else if (s_cli_rx_byte == '\b' || s_cli_rx_byte == 127) { // Backspace
-        if (s_cli_rx_index > 0) {
-            s_cli_rx_index--;
-            CLI_Printf_Transmit('\b');
-            CLI_Printf_Transmit(' ');
-            CLI_Printf_Transmit('\b');
+        Telemetria_Enviar_Amostra(agora);
+    }
+}
+
+//================================================================================
+// Funes de Callback e de Interrupo
+//================================================================================
+
+void CLI_Printf_Transmit(uint8_t ch) {
+    if (ch == '\n') {
+        if (s_tx_line_len >= (CLI_TX_LINE_BUFFER_SIZE - 1)) {
+            CLI_TX_Flush_Line();
         }
-    } else if (isprint(s_cli_rx_byte) && s_cli_rx_index < (CLI_RX_BUFFER_SIZE - 1)) {
-        s_cli_rx_buffer[s_cli_rx_index++] = (char)s_cli_rx_byte;
-        CLI_Printf_Transmit(s_cli_rx_byte); // Eco no bloqueante
+        s_tx_line[s_tx_line_len++] = '\r';
+        s_tx_line[s_tx_line_len++] = '\n';
+        CLI_TX_Flush_Line();
+        return;
     }
 
-    if (HAL_UART_Receive_IT(s_huart_debug, &s_cli_rx_byte, 1) != HAL_OK) {
-        HAL_UART_AbortReceive_IT(s_huart_debug);
-        HAL_UART_Receive_IT(s_huart_debug, &s_cli_rx_byte, 1);
+    s_tx_line[s_tx_line_len++] = ch;
+    if (s_tx_line_len >= CLI_TX_LINE_BUFFER_SIZE) {
+        CLI_TX_Flush_Line();
+    }
+}
+
+/**
+ * @brief Evento de RX (idle-line, meia-transferncia ou volta do anel).
+ *        Custo constante por evento, no por byte: s atualiza o contador.
+ */
+void CLI_HandleRxEvent(UART_HandleTypeDef *huart, uint16_t size) {
+    (void)huart;
+    if (size > CLI_RX_DMA_SIZE) {
+        return;
     }
+    uint16_t pos = s_rx_dma_pos;
+    uint16_t novos = (size >= pos) ? (uint16_t)(size - pos) : (uint16_t)(size + CLI_RX_DMA_SIZE - pos);
+    s_rx_total += novos;
+    s_rx_dma_pos = (size == CLI_RX_DMA_SIZE) ? 0 : size;
 }
 
 void CLI_HandleTxCplt(UART_HandleTypeDef *huart) {
@@ -237,13 +881,8 @@ void CLI_HandleTxCplt(UART_HandleTypeDef *huart) {
 }
 
 void CLI_HandleError(UART_HandleTypeDef *huart) {
-    if (__HAL_UART_GET_FLAG(huart, UART_FLAG_ORE)) {
-        (void)huart->Instance->RDR;
-        __HAL_UART_CLEAR_FLAG(huart, UART_CLEAR_OREF);
-    }
-
-    HAL_UART_AbortReceive_IT(s_huart_debug);
-    HAL_UART_Receive_IT(s_huart_debug, &s_cli_rx_byte, 1);
+    __HAL_UART_CLEAR_FLAG(huart, UART_CLEAR_OREF | UART_CLEAR_NEF | UART_CLEAR_FEF);
+    s_rx_erro = true; // a recepo  reiniciada no superloop
 }
 
 //================================================================================
@@ -251,7 +890,12 @@ void CLI_HandleError(UART_HandleTypeDef *huart) {
 //================================================================================
 
 static void Cmd_Help(char* args) {
-    printf("%s", HELP_TEXT);
+    // O texto de ajuda  maior que o FIFO: usa espera limitada em vez de descartar
+    CliTxOverflowPolicy_t policy = s_tx_policy;
+    s_tx_policy = CLI_TX_OVERFLOW_WAIT;
+    CLI_TX_Flush_Line();
+    CLI_Write((const uint8_t*)HELP_TEXT, sizeof(HELP_TEXT) - 1);
+    s_tx_policy = policy;
 }
 
 static void Cmd_Service(char* args) {
@@ -267,6 +911,89 @@ static void Cmd_GetPeso(char* args) {
 static void Cmd_GetTemp(char* args) {
     float temperatura = TempSensor_GetTemperature();
     printf("Temperatura interna do MCU: %.2f C\r\n", temperatura);
+    printf("VDDA (VREFINT): %u mV\r\n", (unsigned)TempSensor_Get_VDDA_mV());
+}
+
+#if ADS1232_TEMP_INTERLEAVE
+/**
+ * @brief BTEMP: canal de temperatura do ADS1232 intercalado com o peso.
+ *        RAZAO 0 desliga as leituras de temperatura; COMP 0 0 desliga a compensao.
+ */
+static void Cmd_TempBalanca(char* args) {
+    unsigned int razao, descarte;
+    float zero, span;
+    ADS1232_CompTemp_t comp;
+    ADS1232_Get_Comp_Temp(&comp);
+
+    if (args != NULL && *args != '\0') {
+        if (sscanf(args, "RAZAO %u %u", &razao, &descarte) == 2 && razao <= 10000u && descarte <= 16u) {
+            ADS1232_Set_Intercalacao((uint16_t)razao, (uint8_t)descarte);
+        } else if (sscanf(args, "COMP %f %f", &zero, &span) == 2) {
+            comp.zero_cont_por_c = zero;
+            comp.span_ppm_por_c = span;
+            comp.ativo = (zero != 0.0f) || (span != 0.0f);
+            ADS1232_Get_Temperatura(&comp.t_ref_c); // span de referncia = temperatura atual
+            if (!ADS1232_Set_Comp_Temp(&comp)) {
+                printf("Compensacao aplicada, mas a EEPROM esta ocupada: repita o comando para gravar.\r\n");
+            }
+        } else {
+            printf("Uso: BTEMP [RAZAO <n_peso> <descarte>] ou BTEMP COMP <cont/C> <ppm/C>\r\n");
+            return;
+        }
+    }
+
+    float temp_c;
+    ADS1232_Intercalacao_t st;
+    ADS1232_Get_Intercalacao(&st);
+    if (ADS1232_Get_Temperatura(&temp_c)) {
+        printf("Temperatura da celula: %.2f C\r\n", temp_c);
+    } else {
+        printf("Temperatura da celula: sem leitura valida\r\n");
+    }
+    printf("Intercalacao: 1 a cada %u pesos, descarte %u | peso=%lu temp=%lu inval=%lu desc=%lu perda=%u.%u%%\r\n",
+           st.razao, st.descarte, (unsigned long)st.peso, (unsigned long)st.temperatura,
+           (unsigned long)st.invalidas, (unsigned long)st.descartadas,
+           st.perda_peso_pm / 10u, st.perda_peso_pm % 10u);
+    printf("Compensacao: %s zero=%.2f cont/C span=%.1f ppm/C t_ref=%.2f C\r\n",
+           comp.ativo ? "ON" : "OFF", comp.zero_cont_por_c, comp.span_ppm_por_c, comp.t_ref_c);
+}
+#endif
+
+/**
+ * @brief DERIVA: modelo online frequncia x temperatura do instrumento.
+ */
+static void Cmd_Deriva(char* args) {
+    float t_ref;
+
+    if (args != NULL && *args != '\0') {
+        if (strcasecmp(args, "ON") == 0) {
+            Deriva_Set_Ativa(true);
+        } else if (strcasecmp(args, "OFF") == 0) {
+            Deriva_Set_Ativa(false);
+        } else if (strcasecmp(args, "RESET") == 0) {
+            Deriva_Reset();
+        } else if (sscanf(args, "REF %f", &t_ref) == 1 && t_ref > -40.0f && t_ref < 85.0f) {
+            Deriva_Set_Referencia(t_ref);
+        } else {
+            printf("Uso: DERIVA [ON|OFF|RESET] ou DERIVA REF <graus C>\r\n");
+            return;
+        }
+    }
+
+    DerivaInfo_t info;
+    DadosMedicao_t dados;
+    Deriva_Get_Info(&info);
+    Medicao_Get_UltimaMedicao(&dados);
+    float temp_c = TempSensor_GetTemperature();
+
+    printf("Deriva termica: %s, %s\r\n", info.ativa ? "ON" : "OFF",
+           info.confiavel ? "corrigindo" : "aprendendo");
+    printf("  - f_vazio = %.1f Hz %+.2f Hz/C x (T - %.2f C)  (b +-%.2f)\r\n",
+           info.a_hz, info.b_hz_por_c, info.t_ref_c, info.desvio_b);
+    printf("  - Amostras: %lu (%lu rejeitadas na sessao), ruido %.2f Hz\r\n",
+           (unsigned long)info.amostras, (unsigned long)info.rejeitadas, info.ruido_hz);
+    printf("  - Agora: T=%.2f C, f=%.1f Hz -> %.1f Hz corrigida\r\n",
+           temp_c, dados.Frequencia, Deriva_Corrigir(dados.Frequencia, temp_c));
 }
 
 static void Cmd_GetFreq(char* args) {
@@ -277,6 +1004,36 @@ static void Cmd_GetFreq(char* args) {
     printf("  - Escala A (calc): %.2f\r\n", dados_atuais.Escala_A);
 }
 
+static void Cmd_GetUmidade(char* args) {
+    ResultadoRepeticao_t rep;
+    Medicao_Get_Repeticao(&rep);
+    printf("Repeticoes%s:\r\n", Medicao_Repeticao_Em_Andamento() ? " (em andamento)" : "");
+    printf("  - Amostras: %u de %u (%u rejeitadas)%s\r\n", rep.Amostras, rep.Alvo, rep.Rejeitadas,
+           rep.Parada_Antecipada ? ", parada antecipada" : "");
+    printf("  - Umidade media: %.2f %%\r\n", rep.Umidade_Media);
+    printf("  - Desvio: %.3f  IC95: +-%.3f  (tolerancia %.3f)\r\n", rep.Desvio, rep.Semi_IC, rep.Tolerancia);
+}
+
+static void Cmd_Sequencia(char* args) {
+    if (args != NULL && strcasecmp(args, "START") == 0) {
+        Display_StartMeasurementSequence();
+        return;
+    }
+    if (args != NULL && strcasecmp(args, "STOP") == 0) {
+        Sequencia_Abortar();
+        return;
+    }
+
+    SequenciaTempos_t t;
+    Sequencia_Get_Tempos(&t);
+    printf("Sequencia: passo %s, receita %u, %lu ciclos, %lu falhas\r\n", Sequencia_Nome_Passo(Sequencia_Get_Passo()),
+           Sequencia_Get_Receita(), (unsigned long)t.ciclos, (unsigned long)t.falhas);
+    for (uint8_t i = SEQ_PASSO_VAZIO; i <= SEQ_PASSO_MEDE; i++) {
+        printf("  %-8s %6lu ms\r\n", Sequencia_Nome_Passo((SequenciaPasso_t)i), (unsigned long)t.passo_ms[i]);
+    }
+    printf("  %-8s %6lu ms (max %lu)\r\n", "CICLO", (unsigned long)t.ciclo_ms, (unsigned long)t.ciclo_max_ms);
+}
+
 static void Cmd_Dwin(char* args) {
     if (args == NULL) {
         printf("Subcomando DWIN faltando. Use 'HELP'.");
@@ -328,6 +1085,271 @@ static void Cmd_WhoAmI(char* args) {
     Who_am_i();
 }
 
+static void Cmd_TxQueue(char* args) {
+    static const char* const nomes[] = {"NEW (descarta novos)", "OLD (descarta antigos)", "WAIT (espera limitada)"};
+
+    if (args != NULL) {
+        if (strcasecmp(args, "NEW") == 0)        CLI_Set_Tx_Overflow_Policy(CLI_TX_OVERFLOW_DROP_NEWEST);
+        else if (strcasecmp(args, "OLD") == 0)   CLI_Set_Tx_Overflow_Policy(CLI_TX_OVERFLOW_DROP_OLDEST);
+        else if (strcasecmp(args, "WAIT") == 0)  CLI_Set_Tx_Overflow_Policy(CLI_TX_OVERFLOW_WAIT);
+        else if (strcasecmp(args, "RESET") == 0) CLI_Reset_Tx_Stats();
+        else { printf("Uso: TXQ [NEW|OLD|WAIT|RESET]\r\n"); return; }
+    }
+
+    CliTxStats_t st;
+    CLI_Get_Tx_Stats(&st);
+    printf("TX console: politica=%s enf=%lu desc=%lu B (%lu escritas) pico=%u/%u\r\n",
+           nomes[CLI_Get_Tx_Overflow_Policy()], (unsigned long)st.bytes_enfileirados,
+           (unsigned long)st.bytes_descartados, (unsigned long)st.escritas_truncadas,
+           st.high_water, CLI_TX_FIFO_SIZE);
+}
+
+static void Cmd_Log(char* args) {
+    char mod[12];
+    char nivel[8];
+
+    if (args != NULL) {
+        if (sscanf(args, "%11s %7s", mod, nivel) != 2) {
+            printf("Uso: LOG [<modulo|ALL> <DEBUG|INFO|AVISO|ERRO|OFF>]\r\n");
+            return;
+        }
+
+        int n = -1;
+        for (int i = 0; i <= LOG_NIVEL_OFF; i++) {
+            if (strcasecmp(nivel, Log_Nome_Nivel((LogNivel_t)i)) == 0) n = i;
+        }
+        bool todos = (strcasecmp(mod, "ALL") == 0);
+        bool achou = todos;
+        for (int m = 0; m < LOG_NUM_MODULOS && n >= 0; m++) {
+            if (todos || strcasecmp(mod, Log_Nome_Modulo((LogModulo_t)m)) == 0) {
+                Log_Set_Nivel((LogModulo_t)m, (LogNivel_t)n);
+                achou = true;
+            }
+        }
+        if (n < 0 || !achou) {
+            printf("Erro: Modulo ou nivel desconhecido.\r\n");
+            return;
+        }
+    }
+
+    LogStats_t st;
+    Log_Get_Stats(&st);
+    printf("Log: reg=%lu env=%lu filtr=%lu perd=%lu (decodificar com Tools/log_decoder.py)\r\n",
+           (unsigned long)st.registrados, (unsigned long)st.enviados,
+           (unsigned long)st.filtrados, (unsigned long)st.perdidos);
+    for (int m = 0; m < LOG_NUM_MODULOS; m++) {
+        printf("  %-8s >= %s\r\n", Log_Nome_Modulo((LogModulo_t)m),
+               Log_Nome_Nivel(Log_Get_Nivel((LogModulo_t)m)));
+    }
+}
+
+static void Cmd_Modo(char* args) {
+    if (args != NULL) {
+        if (strcasecmp(args, "HUMANO") == 0)       CLI_Set_Modo(CLI_MODO_HUMANO);
+        else if (strcasecmp(args, "MAQUINA") == 0) CLI_Set_Modo(CLI_MODO_MAQUINA);
+        else { printf("Uso: MODO [HUMANO|MAQUINA]\r\n"); return; }
+    }
+
+    CliRxStats_t st;
+    CLI_Get_Rx_Stats(&st);
+    printf("Modo: %s | RX: bytes=%lu cmds=%lu perdidos=%lu linhas_desc=%lu erros=%lu\r\n",
+           (CLI_Get_Modo() == CLI_MODO_MAQUINA) ? "MAQUINA" : "HUMANO",
+           (unsigned long)st.bytes_recebidos, (unsigned long)st.comandos,
+           (unsigned long)st.bytes_perdidos, (unsigned long)st.linhas_descartadas,
+           (unsigned long)st.erros_uart);
+}
+
+static void Cmd_Telemetria(char* args) {
+    CliTelemetriaConfig_t cfg;
+    unsigned int periodo, mascara;
+
+    CLI_Telemetria_Get_Config(&cfg);
+    if (args != NULL) {
+        if (strcasecmp(args, "ON") == 0 || strcasecmp(args, "OFF") == 0) {
+            cfg.ativo = (strcasecmp(args, "ON") == 0);
+        } else if (sscanf(args, "%u %x", &periodo, &mascara) == 2 && periodo <= 60000u) {
+            cfg.periodo_ms = (uint16_t)periodo;
+            cfg.mascara = (uint16_t)mascara;
+        } else {
+            printf("Uso: TLM [ON|OFF] ou TLM <periodo_ms> <mascara_hex>\r\n");
+            return;
+        }
+        if (!CLI_Telemetria_Set_Config(&cfg)) {
+            printf("Erro: periodo >= %u ms e mascara entre 1 e %X.\r\n", CLI_TLM_PERIODO_MIN_MS, TLM_MASCARA_TODOS);
+            return;
+        }
+    }
+
+    CliTelemetriaStats_t st;
+    CLI_Telemetria_Get_Config(&cfg);
+    CLI_Telemetria_Get_Stats(&st);
+    printf("Telemetria: %s periodo=%u ms mascara=%02X env=%lu desc=%lu trans=%lu\r\n",
+           cfg.ativo ? "ON" : "OFF", cfg.periodo_ms, cfg.mascara,
+           (unsigned long)st.amostras_enviadas, (unsigned long)st.amostras_descartadas,
+           (unsigned long)st.transicoes_enviadas);
+}
+
+static void Cmd_Eventos(char* args) {
+    if (args != NULL && strcasecmp(args, "RESET") == 0) {
+        Eventos_Reset_Stats();
+        printf("Estatisticas de eventos zeradas.\r\n");
+        return;
+    }
+
+    EventosStats_t st;
+    Eventos_Get_Stats(&st);
+    printf("Eventos: pub=%lu desp=%lu desc_fila=%lu desc_pool=%lu prof=%u/%u lat_max=%lu us\r\n",
+           (unsigned long)st.publicados, (unsigned long)st.despachados,
+           (unsigned long)st.descartados_fila, (unsigned long)st.descartados_pool,
+           st.profundidade, st.profundidade_max, (unsigned long)st.latencia_max_us);
+
+    for (uint8_t i = 0; i < EV_NUM_TIPOS; i++) {
+        EventosTipoStats_t ts;
+        Eventos_Get_Stats_Tipo((Tipo_Evento_t)i, &ts);
+        if (ts.contagem == 0) continue;
+        printf("  %-12s n=%lu med=%lu us max=%lu us\r\n", Eventos_Nome((Tipo_Evento_t)i),
+               (unsigned long)ts.contagem, (unsigned long)(ts.exec_total_us / ts.contagem),
+               (unsigned long)ts.exec_max_us);
+    }
+}
+
+static void Cmd_Agendador(char* args) {
+    if (args != NULL && strcasecmp(args, "RESET") == 0) {
+        Agendador_Reset_Stats();
+        printf("Estatisticas do agendador zeradas.\r\n");
+        return;
+    }
+
+    AgendadorStats_t st;
+    Agendador_Get_Stats(&st);
+    uint32_t ocupado = (st.total_ms > st.ocioso_ms) ? (st.total_ms - st.ocioso_ms) : 0;
+    uint32_t carga_dec = (st.total_ms > 0) ? (uint32_t)(((uint64_t)ocupado * 1000u) / st.total_ms) : 0;
+    printf("Agendador: carga=%lu.%lu%% ocioso=%lu ms janela=%lu ms dormidas=%lu\r\n",
+           (unsigned long)(carga_dec / 10u), (unsigned long)(carga_dec % 10u),
+           (unsigned long)st.ocioso_ms, (unsigned long)st.total_ms, (unsigned long)st.dormidas);
+
+    for (uint8_t i = 0; i < Agendador_Num_Tarefas(); i++) {
+        TarefaStats_t ts;
+        Agendador_Get_Stats_Tarefa(i, &ts);
+        printf("  %-8s n=%lu med=%lu wcet=%lu lat_max=%lu us prazo_perdido=%lu lib_perdida=%lu\r\n",
+               Agendador_Nome(i), (unsigned long)ts.execucoes,
+               (unsigned long)((ts.execucoes > 0) ? (ts.exec_total_us / ts.execucoes) : 0),
+               (unsigned long)ts.wcet_us, (unsigned long)ts.latencia_max_us,
+               (unsigned long)ts.deadlines_perdidos, (unsigned long)ts.liberacoes_perdidas);
+    }
+}
+
+static void Cmd_Perf(char* args) {
+#if PERFIL_HABILITADO
+    if (args != NULL && strcasecmp(args, "RESET") == 0) {
+        Perfil_Reset();
+        printf("Estatisticas do perfil zeradas.\r\n");
+        return;
+    }
+
+    printf("Handlers:\r\n");
+    for (uint8_t i = 0; i < PERFIL_NUM_PONTOS; i++) {
+        PerfilPontoStats_t ps;
+        Perfil_Get_Ponto((PerfilPonto_t)i, &ps);
+        printf("  %-8s n=%lu med=%lu max=%lu us\r\n",
+               Perfil_Nome_Ponto((PerfilPonto_t)i), (unsigned long)ps.chamadas,
+               (unsigned long)((ps.chamadas > 0) ? (ps.total_us / ps.chamadas) : 0),
+               (unsigned long)ps.max_us);
+    }
+
+    PerfilLoopStats_t ls;
+    Perfil_Get_Loop(&ls);
+    printf("Loop: voltas=%lu periodo_max=%lu us\r\n  hist:",
+           (unsigned long)ls.voltas, (unsigned long)ls.periodo_max_us);
+    for (uint8_t i = 0; i < PERFIL_HIST_FAIXAS; i++) {
+        if (i < (PERFIL_HIST_FAIXAS - 1)) {
+            printf(" <%lu:%lu", (unsigned long)(16uL << i), (unsigned long)ls.histograma[i]);
+        } else {
+            printf(" resto:%lu", (unsigned long)ls.histograma[i]);
+        }
+    }
+    printf("\r\n");
+
+    printf("ISRs:\r\n");
+    for (uint8_t i = 0; i < PERFIL_NUM_ISR; i++) {
+        PerfilIsrStats_t is;
+        Perfil_Get_Isr((PerfilIsr_t)i, &is);
+        // USARTs no tm referncia de tempo do evento: s durao
+        if ((i == PERFIL_ISR_USART1) || (i == PERFIL_ISR_USART2)) {
+            printf("  %-8s n=%lu lat_med=- lat_max=- exec_max=%lu us\r\n",
+                   Perfil_Nome_Isr((PerfilIsr_t)i), (unsigned long)is.amostras,
+                   (unsigned long)is.exec_max_us);
+        } else {
+            printf("  %-8s n=%lu lat_med=%lu lat_max=%lu exec_max=%lu us\r\n",
+                   Perfil_Nome_Isr((PerfilIsr_t)i), (unsigned long)is.amostras,
+                   (unsigned long)((is.amostras > 0) ? (is.latencia_total_us / is.amostras) : 0),
+                   (unsigned long)is.latencia_max_us, (unsigned long)is.exec_max_us);
+        }
+    }
+#else
+    (void)args;
+    printf("Perfil desabilitado na compilacao.\r\n");
+#endif
+}
+
+static void Cmd_Memoria(char* args) {
+    (void)args;
+    MemoriaInfo_t mi;
+    Memoria_Get_Info(&mi);
+
+    uint32_t livre = (mi.ram_total > mi.ram_usada) ? (mi.ram_total - mi.ram_usada) : 0;
+    printf("RAM: usada=%lu livre=%lu total=%lu orcamento=%lu bytes (RW+ZI+pilha)\r\n",
+           (unsigned long)mi.ram_usada, (unsigned long)livre,
+           (unsigned long)mi.ram_total, (unsigned long)MEMORIA_ORCAMENTO_RAM_BYTES);
+    printf("Pilha: tamanho=%lu pico=%lu (%lu%%) folga_min=%lu bytes\r\n",
+           (unsigned long)mi.stack_total, (unsigned long)mi.stack_usada_max,
+           (unsigned long)((mi.stack_usada_max * 100u) / mi.stack_total),
+           (unsigned long)(mi.stack_total - mi.stack_usada_max));
+}
+
+static void Cmd_Diagnostico(char* args) {
+    if (args != NULL && strcasecmp(args, "RUN") == 0) {
+        if (!App_Manager_Run_Self_Diagnostics(PRINCIPAL)) {
+            printf("Autodiagnostico ja em andamento.\r\n");
+        }
+        return;
+    }
+    App_Manager_Imprimir_Diagnostico();
+}
+
+static void Cmd_Wake(char* args) {
+    (void)args;
+    App_Manager_Imprimir_Wake();
+}
+
+static void Cmd_Trend(char* args) {
+    TrendConfig_t cfg;
+    unsigned int amostra_ms, decimacao, envio_ms;
+
+    if (args != NULL) {
+        if (strcasecmp(args, "ON") == 0 || strcasecmp(args, "OFF") == 0) {
+            Trend_Set_Enabled(strcasecmp(args, "ON") == 0);
+        } else if (sscanf(args, "%u %u %u", &amostra_ms, &decimacao, &envio_ms) == 3 &&
+                   amostra_ms <= 60000u && decimacao <= 255u && envio_ms <= 60000u) {
+            cfg.periodo_amostra_ms = (uint16_t)amostra_ms;
+            cfg.decimacao = (uint8_t)decimacao;
+            cfg.periodo_envio_ms = (uint16_t)envio_ms;
+            if (!Trend_Set_Config(&cfg)) {
+                printf("Erro: Parametros invalidos (amostra >= 10 ms, dec >= 1, envio >= amostra).\r\n");
+                return;
+            }
+        } else {
+            printf("Uso: TREND [ON|OFF] ou TREND <amostra_ms> <decimacao> <envio_ms>\r\n");
+            return;
+        }
+    }
+
+    Trend_Get_Config(&cfg);
+    printf("Tendencia: amostra=%u ms, decimacao=%u, envio=%u ms, descartados=%lu\r\n",
+           cfg.periodo_amostra_ms, cfg.decimacao, cfg.periodo_envio_ms,
+           (unsigned long)Trend_Get_Pontos_Descartados());
+}
+
 //================================================================================
 // Implementao dos Handlers de Subcomando DWIN
 //================================================================================
@@ -415,6 +1437,26 @@ static void Handle_Dwin_RAW(char* sub_args) {
     DWIN_Driver_WriteRawBytes(raw_buffer, byte_count);
 }
 
+static void Handle_Dwin_STAT(char* sub_args) {
+    static const char* const nomes_lane[DWIN_TX_NUM_LANES] = {"CONTROLE", "DADOS"};
+
+    if (sub_args != NULL && strcasecmp(sub_args, "RESET") == 0) {
+        DWIN_Driver_ResetTxStats();
+        printf("Estatisticas TX DWIN zeradas.");
+        return;
+    }
+
+    for (uint8_t i = 0; i < DWIN_TX_NUM_LANES; i++) {
+        DWIN_TxLaneStats_t st;
+        DWIN_Driver_GetTxStats((DWIN_TxLane_t)i, &st);
+        printf("%-8s enf=%lu desc=%lu (%lu B) pico=%u/%u livre=%u\r\n",
+               nomes_lane[i], (unsigned long)st.enfileirados, (unsigned long)st.descartados,
+               (unsigned long)st.bytes_descartados, st.high_water, st.capacidade,
+               DWIN_Driver_GetTxFree((DWIN_TxLane_t)i));
+    }
+    printf("Pagina atual: %u", DWIN_Driver_GetCurrentPage());
+}
+
 //================================================================================
 // Funes Auxiliares e de Processamento
 //================================================================================
@@ -422,7 +1464,7 @@ static void Handle_Dwin_RAW(char* sub_args) {
 static void ProcessReceivedCommand(void) {
     char* command;
     char* args;
-    TokenizeCommand(s_cli_rx_buffer, &command, &args);
+    TokenizeCommand(s_cmd_atual, &command, &args);
 
     if (*command == '\0') return;
 
@@ -431,7 +1473,11 @@ static void ProcessReceivedCommand(void) {
 }
 
 static void ShowPrompt(void) {
-    printf("\r\n> ");
+    if (s_modo == CLI_MODO_MAQUINA) {
+        printf("OK\r\n"); // marca o fim da resposta para o host
+    } else {
+        printf("\r\n> ");
+    }
 }
 
 static uint8_t HexCharToValue(char c) {
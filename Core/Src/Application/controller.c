@@ -24,31 +24,67 @@ static void Handle_Escape_Navigation(void);
 //================================================================================
 
 /**
- * @brief (V8.3) Retorna a tela que o controlador acredita estar ativa.
+ * @brief Retorna a tela visvel. A fonte  a pgina rastreada pelo driver
+ *        (PIC_NOW); o valor local s  usado enquanto ela  desconhecida.
  */
 uint16_t Controller_GetCurrentScreen(void)
 {
-    return s_current_screen_id;
+    uint16_t pagina = DWIN_Driver_GetCurrentPage();
+    return (pagina != DWIN_PAGINA_DESCONHECIDA) ? pagina : s_current_screen_id;
 }
 
 /**
- * @brief Wrapper PBLICO para DWIN_Driver_SetScreen que rastreia a tela atual.
+ * @brief Informa a tela esperada aps uma navegao feita pelo prprio painel
+ *        e antecipa a confirmao por leitura.
  */
 void Controller_SetScreen(uint16_t screen_id)
 {
     s_current_screen_id = screen_id;
+    DWIN_Driver_RequestPageReadback();
+}
+
+/**
+ * @brief Callback de troca de pgina publicada pelo driver DWIN.
+ */
+void Controller_PageChangeCallback(uint16_t pagina)
+{
+    s_current_screen_id = pagina;
 }
 
 
 //================================================================================
 // Funo de Callback
 //================================================================================
+
+/**
+ * @brief Callback do driver DWIN: apenas copia o frame para a fila de eventos.
+ *        O despacho para os handlers ocorre em Controller_Handle_Frame_Event.
+ */
 void Controller_DwinCallback(const uint8_t* data, uint16_t len)
 {
-    if (len < 6 || data[0] != 0x5A || data[1] != 0xA5) {
+    if (len < 6 || len > EVENTO_FRAME_MAX || data[0] != 0x5A || data[1] != 0xA5) {
         return; 
     }
 
+    FramePayload_t frame;
+    frame.len = len;
+    memcpy(frame.data, data, len);
+
+    if (!Eventos_Post_Payload(EV_DWIN_FRAME_RECEIVED, &frame, (uint16_t)(offsetof(FramePayload_t, data) + len))) {
+        printf("CONTROLLER: Fila de eventos cheia, frame DWIN descartado.\r\n");
+    }
+}
+
+void Controller_Handle_Frame_Event(Evento_t evento)
+{
+    const FramePayload_t* frame = (const FramePayload_t*)evento.payload;
+    if (frame == NULL) {
+        return;
+    }
+
+    const uint8_t* data = frame->data;
+    uint16_t len = frame->len;
+
     if (data[3] == 0x83) { 
         uint16_t vp_address = (data[4] << 8) | data[5];
         
@@ -119,9 +155,10 @@ void Controller_DwinCallback(const uint8_t* data, uint16_t len)
 static void Handle_Escape_Navigation(void)
 {
 
-    if (s_current_screen_id != PRINCIPAL) 
+    uint16_t tela_atual = Controller_GetCurrentScreen();
+
+    if (tela_atual != PRINCIPAL && tela_atual != TELA_SERVICO) 
     {
-         Controller_SetScreen(PRINCIPAL); 
 				 DWIN_Driver_SetScreen(TELA_SERVICO);
          printf("CONTROLLER: Saindo do Monitor -> Tela de Servico.\r\n");
     }
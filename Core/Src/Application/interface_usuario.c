@@ -241,12 +241,12 @@ static void Atualizar_Display_Grao(void) {
     nome_grao[MAX_NOME_GRAO_LEN] = '\0';
     DWIN_Driver_WriteString(VP_NOME_GRAO, nome_grao);
 
-    Config_Grao_t dados_grao_eeprom;
-    if (Gerenciador_Config_Get_Dados_Grao(s_indice_grao_atual, &dados_grao_eeprom)) {
-        DWIN_Driver_WriteInt(VP_UMIDADE_MIN_GRAO, dados_grao_eeprom.umidade_min);
-        DWIN_Driver_WriteInt(VP_UMIDADE_MAX_GRAO, dados_grao_eeprom.umidade_max);
-        DWIN_Driver_WriteInt(VP_CURVA_GRAO, dados_grao_eeprom.id_curva);
-        DWIN_Driver_WriteString(VP_VALIDADE_GRAO, dados_grao_eeprom.validade);
+    const Config_Grao_t* dados_grao_eeprom = Gerenciador_Config_Get_Grao_View(s_indice_grao_atual);
+    if (dados_grao_eeprom != NULL) {
+        DWIN_Driver_WriteInt(VP_UMIDADE_MIN_GRAO, dados_grao_eeprom->umidade_min);
+        DWIN_Driver_WriteInt(VP_UMIDADE_MAX_GRAO, dados_grao_eeprom->umidade_max);
+        DWIN_Driver_WriteInt(VP_CURVA_GRAO, dados_grao_eeprom->id_curva);
+        DWIN_Driver_WriteString(VP_VALIDADE_GRAO, dados_grao_eeprom->validade);
     }
 }
 
@@ -1,18 +1,307 @@
-#include "relato.h"
-
-Config_Aplicacao_t config_snapshot;
-
+/*******************************************************************************
+ * @file        relato.c
+ * @brief       Identificao do equipamento e ticket de medio.
+ * @details     O ticket  descrito por um modelo compacto (tabela em flash):
+ * cada linha tem rtulo, campo, largura, casas decimais e sufixo. As linhas
+ * so renderizadas uma a uma num buffer duplo com formatao inteira/ponto
+ * fixo (sem printf de float) e transmitidas direto pelo DMA do console,
+ * com o canal reservado (CLI_Stream_*): logs e printf gerados durante a
+ * impresso ficam no FIFO e saem depois do ticket.
+ ******************************************************************************/
 
+#include "relato.h"
+#include "cli_driver.h"
 
 const char Ejeta[] = "================================\n\r" "\n\r"  "\n\r"  "\n\r ";
 const char Dupla[] = "\n\r================================\n\r";
 const char Linha[] = "--------------------------------\n\r";
 
+//================================================================================
+// Modelo do Ticket
+//================================================================================
+
+#define RELATO_LINHA_MAX     64
+#define RELATO_DEC_CONFIG    0xFF   // casas decimais vm de nr_decimals
+#define RELATO_DEC_MAX       4
+
+typedef enum {
+    CAMPO_NENHUM = 0,      // linha fixa: s o rtulo
+    CAMPO_FIRMWARE,
+    CAMPO_SERIAL,
+    CAMPO_PRODUTO,
+    CAMPO_CURVA,
+    CAMPO_VALIDADE,
+    CAMPO_AMOSTRA,
+    CAMPO_TEMP_AMOSTRA,
+    CAMPO_TEMP_INSTRU,
+    CAMPO_PESO,
+    CAMPO_DENSIDADE,
+    CAMPO_UMIDADE,
+    CAMPO_HORA,            // linha omitida se o RTC falhar
+    CAMPO_DATA
+} RelatoCampo_t;
+
+typedef struct {
+    const char* rotulo;
+    uint8_t     campo;
+    uint8_t     largura;   // valor alinhado  direita (como %Ns)
+    uint8_t     decimais;
+    const char* sufixo;
+} RelatoLinha_t;
+
+#define FIXA(texto)  { (texto), CAMPO_NENHUM, 0, 0, "" }
+
+static const RelatoLinha_t s_modelo_ticket[] = {
+    // Cabealho
+    FIXA("\n\r================================\n\r"),
+    FIXA("GEHAKA            G620_Teste_Gab\n\r"),
+    FIXA("--------------------------------\n\r"),
+    { "Versao Firmware= ", CAMPO_FIRMWARE,     15, 0, "\n\r" },
+    { "Numero de Serie= ", CAMPO_SERIAL,       15, 0, "\n\r" },
+    FIXA("--------------------------------\n\r"),
+    // Dados da medio
+    { "Produto       = ", CAMPO_PRODUTO,      16, 0, "\n\r" },
+    { "Versao Equacao= ", CAMPO_CURVA,        10, 0, "\n\r" },
+    { "Validade Curva= ", CAMPO_VALIDADE,     13, 0, "\n\r" },
+    { "Amostra Numero= ", CAMPO_AMOSTRA,       8, 0, "\n\r" },
+    { "Temp.Amostra .= ", CAMPO_TEMP_AMOSTRA,  8, 1, " 'C\n\r" },
+    { "Temp.Instru ..= ", CAMPO_TEMP_INSTRU,   8, 1, " 'C\n\r" },
+    { "Peso Amostra .= ", CAMPO_PESO,          8, 1, " g\n\r" },
+    { "Densidade ....= ", CAMPO_DENSIDADE,     8, 1, " Kg/hL\n\r" },
+    FIXA("--------------------------------\n\r"),
+    { "Umidade ......= ", CAMPO_UMIDADE,      14, RELATO_DEC_CONFIG, " %\n\r" },
+    FIXA("--------------------------------\n\r"),
+    // Assinatura
+    FIXA("\n\r\n\r--------------------------------\n\r"),
+    { "Assinatura              ", CAMPO_HORA,  0, 0, "\n\r" },
+    { "Responsavel             ", CAMPO_DATA,  0, 0, "\n\r" },
+    FIXA("\n\r\n\r\n\r\n\r"),
+};
+
+#define NUM_LINHAS_TICKET  (sizeof(s_modelo_ticket) / sizeof(s_modelo_ticket[0]))
+
+//================================================================================
+// Variveis Estticas
+//================================================================================
+
+// Trabalho de impresso: dados capturados no incio (ticket coerente) e
+// buffer duplo (uma linha no DMA, a prxima sendo renderizada).
+static struct {
+    bool            ativo;
+    uint8_t         proxima;          // prxima linha do modelo
+    DadosMedicao_t  medicao;
+    uint8_t         indice_grao;
+    uint8_t         decimais;
+    uint8_t         buf[2][RELATO_LINHA_MAX];
+    uint8_t         len_pronta;       // bytes renderizados em buf[pronto] (0 = nenhum)
+    uint8_t         pronto;
+} s_job;
+
+static const uint32_t s_pot10[RELATO_DEC_MAX + 1] = { 1u, 10u, 100u, 1000u, 10000u };
+
+//================================================================================
+// Formatao Inteira
+//================================================================================
+
+/**
+ * @brief Copia texto fixo do modelo. Cada '\n' sai como "\r\n", como o
+ *        printf faz em CLI_Printf_Transmit: o fluxo vai direto ao DMA e o
+ *        ticket tem que sair byte a byte igual ao impresso por printf.
+ */
+static uint8_t Fmt_Copiar(char* out, uint8_t pos, const char* txt)
+{
+    while ((*txt != '\0') && (pos < RELATO_LINHA_MAX)) {
+        if (*txt == '\n') {
+            if (pos >= (RELATO_LINHA_MAX - 1u)) break;
+            out[pos++] = '\r';
+        }
+        out[pos++] = *txt++;
+    }
+    return pos;
+}
+
+/**
+ * @brief Copia 'n' caracteres alinhados  direita em 'largura' (como %Ns).
+ */
+static uint8_t Fmt_Alinhar(char* out, uint8_t pos, const char* txt, uint8_t n, uint8_t largura)
+{
+    while ((largura > n) && (pos < RELATO_LINHA_MAX)) {
+        out[pos++] = ' ';
+        largura--;
+    }
+    for (uint8_t i = 0; (i < n) && (pos < RELATO_LINHA_MAX); i++) {
+        out[pos++] = txt[i];
+    }
+    return pos;
+}
+
+/**
+ * @brief Dgitos de v em ordem direta, com no mnimo 'min_digitos' (zeros  esquerda).
+ * @return Quantidade de caracteres escritos em 'dig' (at 10).
+ */
+static uint8_t Fmt_Digitos(char* dig, uint32_t v, uint8_t min_digitos)
+{
+    char tmp[10];
+    uint8_t n = 0;
+    do {
+        tmp[n++] = (char)('0' + (v % 10u));
+        v /= 10u;
+    } while ((v != 0u) && (n < sizeof(tmp)));
+    while ((n < min_digitos) && (n < sizeof(tmp))) {
+        tmp[n++] = '0';
+    }
+    for (uint8_t i = 0; i < n; i++) {
+        dig[i] = tmp[n - 1u - i];
+    }
+    return n;
+}
+
+/**
+ * @brief Ponto fixo exato, s com inteiros: o float  mantissa x 2^exp, ento
+ *        mantissa x 10^decimais cabe em 64 bits e o deslocamento d o valor
+ *        arredondado sem erro intermedirio. Empate exato vai para o par,
+ *        como o printf (18.185f = 18.18499... sai "18.18"; 0.125 sai "0.12").
+ */
+static uint8_t Fmt_Fixo(char* out, uint8_t pos, float valor, uint8_t decimais, uint8_t largura)
+{
+    char txt[24];
+    uint8_t n = 0;
+    uint32_t bits;
+    uint64_t q;
+
+    if (decimais > RELATO_DEC_MAX) decimais = RELATO_DEC_MAX;
+    uint32_t escala = s_pot10[decimais];
+    memcpy(&bits, &valor, sizeof(bits));
+
+    int16_t expoente = (int16_t)((bits >> 23) & 0xFFu);
+    uint64_t mantissa = bits & 0x7FFFFFu;
+    if (expoente == 0) {
+        expoente = 1;                 // subnormal
+    } else {
+        mantissa |= 0x800000u;
+    }
+    expoente = (int16_t)(expoente - 150); // valor = mantissa x 2^expoente
+
+    if (expoente >= 8) {
+        q = 0xFFFFFFFFuLL * escala;   // >= 2^31: fora da faixa do ticket, satura
+    } else {
+        uint64_t p = mantissa * escala;
+        if (expoente >= 0) {
+            q = p << expoente;
+        } else if (expoente > -63) {
+            uint8_t d = (uint8_t)-expoente;
+            uint64_t resto = p & ((1uLL << d) - 1u);
+            uint64_t meio = 1uLL << (d - 1u);
+            q = p >> d;
+            if ((resto > meio) || ((resto == meio) && ((q & 1u) != 0u))) {
+                q++;
+            }
+        } else {
+            q = 0;
+        }
+    }
+
+    if ((bits >> 31) != 0u) {
+        txt[n++] = '-'; // como o printf: -0.04 sai "-0.0"
+    }
+    n = (uint8_t)(n + Fmt_Digitos(&txt[n], (uint32_t)(q / escala), 1));
+    if (decimais > 0) {
+        txt[n++] = '.';
+        n = (uint8_t)(n + Fmt_Digitos(&txt[n], (uint32_t)(q % escala), decimais));
+    }
+    return Fmt_Alinhar(out, pos, txt, n, largura);
+}
+
+static uint8_t Fmt_Uint(char* out, uint8_t pos, uint32_t v, uint8_t largura)
+{
+    char txt[10];
+    uint8_t n = Fmt_Digitos(txt, v, 1);
+    return Fmt_Alinhar(out, pos, txt, n, largura);
+}
+
+static uint8_t Fmt_Texto(char* out, uint8_t pos, const char* txt, uint8_t largura)
+{
+    uint8_t n = 0;
+    while ((n < RELATO_LINHA_MAX) && (txt[n] != '\0')) {
+        n++;
+    }
+    return Fmt_Alinhar(out, pos, txt, n, largura);
+}
+
+/**
+ * @brief "aa:bb:cc" com dois dgitos cada (hora ou data).
+ */
+static uint8_t Fmt_Tripla(char* out, uint8_t pos, uint8_t a, uint8_t b, uint8_t c, char sep)
+{
+    char txt[8];
+    Fmt_Digitos(&txt[0], a % 100u, 2);
+    txt[2] = sep;
+    Fmt_Digitos(&txt[3], b % 100u, 2);
+    txt[5] = sep;
+    Fmt_Digitos(&txt[6], c % 100u, 2);
+    return Fmt_Alinhar(out, pos, txt, sizeof(txt), 0);
+}
+
+//================================================================================
+// Renderizao
+//================================================================================
+
+/**
+ * @brief Renderiza uma linha do modelo.
+ * @return Bytes gerados; 0 se a linha deve ser omitida.
+ */
+static uint8_t Renderizar_Linha(const RelatoLinha_t* l, char* out)
+{
+    const Config_Grao_t* grao = Gerenciador_Config_Get_Grao_View(s_job.indice_grao);
+    uint8_t dec = (l->decimais == RELATO_DEC_CONFIG) ? s_job.decimais : l->decimais;
+    uint8_t h, m, s;
+    uint8_t pos = Fmt_Copiar(out, 0, l->rotulo);
+
+    switch ((RelatoCampo_t)l->campo) {
+        case CAMPO_NENHUM:       break;
+        case CAMPO_FIRMWARE:     pos = Fmt_Texto(out, pos, FIRMWARE, l->largura); break;
+        case CAMPO_SERIAL:       pos = Fmt_Texto(out, pos, Gerenciador_Config_Get_View()->nr_serial, l->largura); break;
+        case CAMPO_PRODUTO:      pos = Fmt_Texto(out, pos, grao->nome, l->largura); break;
+        case CAMPO_CURVA:        pos = Fmt_Uint(out, pos, grao->id_curva, l->largura); break;
+        case CAMPO_VALIDADE:     pos = Fmt_Texto(out, pos, grao->validade, l->largura); break;
+        case CAMPO_AMOSTRA:      pos = Fmt_Uint(out, pos, 4u, l->largura); break;          // fixo (ainda sem contador de amostras)
+        case CAMPO_TEMP_AMOSTRA: pos = Fmt_Fixo(out, pos, 22.0f, dec, l->largura); break;  // fixo (sem sensor de amostra)
+        case CAMPO_TEMP_INSTRU:  pos = Fmt_Fixo(out, pos, s_job.medicao.Temp_Instru, dec, l->largura); break;
+        case CAMPO_PESO:         pos = Fmt_Fixo(out, pos, s_job.medicao.Peso_Amostra, dec, l->largura); break;
+        case CAMPO_DENSIDADE:    pos = Fmt_Fixo(out, pos, s_job.medicao.Densidade, dec, l->largura); break;
+        case CAMPO_UMIDADE:      pos = Fmt_Fixo(out, pos, s_job.medicao.Umidade, dec, l->largura); break;
+        case CAMPO_HORA:
+            if (!RTC_Driver_GetTime(&h, &m, &s)) return 0;
+            pos = Fmt_Tripla(out, pos, h, m, s, ':');
+            break;
+        case CAMPO_DATA:
+            if (!RTC_Driver_GetDate(&h, &m, &s)) return 0;
+            pos = Fmt_Tripla(out, pos, h, m, s, '/');
+            break;
+        default:                 return 0;
+    }
+    return Fmt_Copiar(out, pos, l->sufixo);
+}
+
+/**
+ * @brief Renderiza a prxima linha no omitida em buf[pronto].
+ */
+static void Renderizar_Proxima(void)
+{
+    s_job.len_pronta = 0;
+    while ((s_job.len_pronta == 0) && (s_job.proxima < NUM_LINHAS_TICKET)) {
+        s_job.len_pronta = Renderizar_Linha(&s_modelo_ticket[s_job.proxima++], (char*)s_job.buf[s_job.pronto]);
+    }
+}
+
+//================================================================================
+// Funes Pblicas
+//================================================================================
 
 void Who_am_i(void)
 {
-	Gerenciador_Config_Get_Config_Snapshot(&config_snapshot);
-	
+	const Config_Aplicacao_t* cfg = Gerenciador_Config_Get_View();
+
   printf(Dupla);
   printf("         G620_Teste_Gab\n\r");
   printf("     (c) GEHAKA, 2004-2025\n\r");
@@ -20,67 +309,53 @@ void Who_am_i(void)
   printf("CPU      =           STM32C071RB\n\r");
   printf("Firmware = %21s\r\n", FIRMWARE);
   printf("Hardware = %21s\r\n", HARDWARE);
-  printf("Serial   = %21s\r\n", config_snapshot.nr_serial);
+  printf("Serial   = %21s\r\n", cfg->nr_serial);
   printf(Linha);
   printf("Medidas  = %21d\n\r", 22);
   printf(Ejeta);
 }
 
-void Assinatura(void)
+bool Relatorio_Printer(void)
 {
-	uint8_t hours, minutes, seconds;
-	uint8_t day, month, year; 
-	
-	printf("\n\r");
-  printf("\n\r");
-  printf(Linha);
-	if (RTC_Driver_GetTime(&hours, &minutes, &seconds))
-	{
-		printf("Assinatura              %02d:%02d:%02d\n\r", hours, minutes, seconds);
-	}
-	if (RTC_Driver_GetDate(&day, &month, &year))
-	{
-		printf("Responsavel             %02d/%02d/%02d\n\r", day, month, year);
-	}
-	printf ("\n\r");
-  printf ("\n\r");
-  printf ("\n\r");
-  printf ("\n\r");
+    if (s_job.ativo || !CLI_Stream_Abrir()) {
+        return false;
+    }
+
+    Medicao_Get_UltimaMedicao(&s_job.medicao);
+    Gerenciador_Config_Get_Grao_Ativo(&s_job.indice_grao);
+    uint16_t dec = Gerenciador_Config_Get_NR_Decimals();
+    s_job.decimais = (dec > RELATO_DEC_MAX) ? RELATO_DEC_MAX : (uint8_t)dec;
+    s_job.proxima = 0;
+    s_job.pronto = 0;
+    s_job.ativo = true;
+
+    Renderizar_Proxima();
+    Relatorio_Process();
+    return true;
 }
 
-void Cabecalho(void)
+void Relatorio_Process(void)
 {
-	Gerenciador_Config_Get_Config_Snapshot(&config_snapshot);
-	
-  printf(Dupla);
- 	printf("GEHAKA            G620_Teste_Gab\n\r");
-  printf(Linha);
-	printf("Versao Firmware= %15s\n\r", FIRMWARE);
- 	printf("Numero de Serie= %15s\n\r", config_snapshot.nr_serial);
-  printf(Linha);
+    if (!s_job.ativo) return;
+
+    if (s_job.len_pronta > 0) {
+        // Controle de fluxo: a prxima linha s sai quando o DMA liberar
+        if (!CLI_Stream_Enviar(s_job.buf[s_job.pronto], s_job.len_pronta)) {
+            return;
+        }
+        s_job.pronto ^= 1u;
+        Renderizar_Proxima(); // adianta a linha seguinte enquanto esta transmite
+        return;
+    }
+
+    // Modelo esgotado: libera o canal depois do ltimo bloco
+    if (CLI_Stream_Livre()) {
+        CLI_Stream_Fechar();
+        s_job.ativo = false;
+    }
 }
 
-void Relatorio_Printer (void)
-{	
-		Gerenciador_Config_Get_Config_Snapshot(&config_snapshot);
-		DadosMedicao_t medicao_snapshot;
-		Medicao_Get_UltimaMedicao(&medicao_snapshot);
-		const Config_Grao_t* dados_grao_ativo = &config_snapshot.graos[config_snapshot.indice_grao_ativo];
-
-		
-    Cabecalho();
-  
-    printf("Produto       = %16s\n\r",  dados_grao_ativo->nome);
-  	printf("Versao Equacao= %10lu\n\r",   (unsigned long)dados_grao_ativo->id_curva);
-  	printf("Validade Curva= %13s\n\r", dados_grao_ativo->validade);
-  	printf("Amostra Numero= %8i\n\r",      4);
-  	printf("Temp.Amostra .= %8.1f 'C\n\r", 22.0);
-  	printf("Temp.Instru ..= %8.1f 'C\n\r", medicao_snapshot.Temp_Instru);
-  	printf("Peso Amostra .= %8.1f g\n\r", medicao_snapshot.Peso);
-  	printf("Densidade ....= %8.1f Kg/hL\n\r",  medicao_snapshot.Densidade);
-    printf(Linha);         
-  	printf("Umidade ......= %14.*f %%\n\r", (int)config_snapshot.nr_decimals, medicao_snapshot.Umidade);
-  	printf(Linha);
-
-  	Assinatura();
+bool Relatorio_Ocupado(void)
+{
+    return s_job.ativo;
 }
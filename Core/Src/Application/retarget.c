@@ -3,8 +3,8 @@
  * @brief       Redirecionamento (Retarget) da funo printf para UART (V8.1 - DMA).
  * @version     2.1 (Refatorado por Dev STM)
  * @details     Este mdulo redireciona o fputc (usado pelo printf) para o
- * driver CLI (CLI_Printf_Transmit), que gerencia um FIFO de TX assncrono
- * que alimenta a Bomba (Pump) de DMA.
+ * driver CLI (CLI_Printf_Transmit), que acumula a linha e a publica inteira
+ * no FIFO de TX assncrono que alimenta a Bomba (Pump) de DMA.
  ******************************************************************************/
 
 #include "retarget.h"
@@ -29,7 +29,8 @@ void Retarget_Init(UART_HandleTypeDef* debug_huart, UART_HandleTypeDef* dwin_hua
     s_debug_huart = debug_huart;
     s_dwin_huart = dwin_huart;
 
-    // Garante que a biblioteca C chame fputc para CADA caractere, imediatamente.
+    // A biblioteca C chama fputc por caractere; o buffer de linha fica no
+    // driver CLI (MicroLIB no oferece setvbuf/_write com buffer).
     setvbuf(stdout, NULL, _IONBF, 0);
 }
 
@@ -50,9 +51,7 @@ int fputc(int ch, FILE *f)
     {
         if (s_debug_huart != NULL)
         {
-            // Substitui o HAL_UART_Transmit(..., HAL_MAX_DELAY) por:
-            // Chama a funo atmica do driver CLI que enfileira o byte no FIFO
-            // e retorna imediatamente.
+            // Acumula no buffer de linha do driver CLI; sem mascarar IRQs.
             CLI_Printf_Transmit(c);
         }
     }
@@ -1,5 +1,7 @@
 #include "ads1232_driver.h"
 #include "main.h"
+#include "log_diferido.h"
+#include "gerenciador_configuracoes.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
@@ -17,9 +19,57 @@ CalPoint_t cal_points[NUM_CAL_POINTS] = {
     {200.0f, 1477409}
 };
 
+// --- Parmetros da tara (iguais para a verso bloqueante e a incremental) ---
+#define TARA_NUM_AMOSTRAS     32
+#define TARA_LIMIAR_ESTAVEL   300
+#define TARA_MAX_TENTATIVAS   10
+
+#if ADS1232_TEMP_INTERLEAVE
+// --- Canal de temperatura (pino TEMP): diodo interno do ADS1232 ---
+// Valores tpicos do datasheet, vlidos com ganho 1 durante a leitura
+#define ADS_TEMP_VREF_MV        3300.0f  // REFP - REFN da placa
+#define ADS_TEMP_GANHO          1.0f
+#define ADS_TEMP_MV_25C         111.7f
+#define ADS_TEMP_MV_POR_C       0.379f
+#define ADS_TEMP_MIN_C          (-40.0f)
+#define ADS_TEMP_MAX_C          125.0f
+#define ADS_TEMP_FILTRO_N       4.0f     // mdia exponencial, peso 1/N
+// Intercalao desligada por padro: com o ganho do PGA desta placa o diodo
+// satura e a leitura nunca  vlida. Ligar por BTEMP RAZAO aps confirmar.
+#define ADS_RAZAO_PADRAO        0u       // leituras de peso por leitura de temperatura
+#define ADS_TEMP_MAX_INVALIDAS  8u       // seguidas: desliga a intercalao
+#define ADS_DESCARTE_PADRAO     1u       // converses descartadas aps cada troca
+
+typedef enum {
+    FASE_PESO,
+    FASE_TEMP_ASSENTA,
+    FASE_TEMP,
+    FASE_PESO_ASSENTA
+} FaseIntercalacao_t;
+#endif
+
 // --- Variveis Estticas ---
 static int32_t adc_offset = 0;
 
+#if ADS1232_TEMP_INTERLEAVE
+static FaseIntercalacao_t s_fase = FASE_PESO;
+static uint16_t s_cont_fase = 0;
+static ADS1232_Intercalacao_t s_intercala = {.razao = ADS_RAZAO_PADRAO, .descarte = ADS_DESCARTE_PADRAO};
+static float s_temp_c = 0.0f;
+static bool s_temp_valida = false;
+static uint8_t s_invalidas_seguidas = 0;
+static float s_temp_tara_c = 25.0f;
+static ADS1232_CompTemp_t s_comp = {.t_ref_c = 25.0f, .zero_cont_por_c = 0.0f, .span_ppm_por_c = 0.0f, .ativo = false};
+#endif
+
+// Tara incremental: uma amostra por converso, sem HAL_Delay
+static ADS1232_TaraEstado_t s_tara_estado = ADS1232_TARA_OCIOSA;
+static int64_t s_tara_soma = 0;
+static int32_t s_tara_min = 0;
+static int32_t s_tara_max = 0;
+static uint8_t s_tara_amostras = 0;
+static uint8_t s_tara_tentativa = 0;
+
 // --- Funes Privadas ---
 static void delay_us(uint32_t us) {
     for(volatile uint32_t i = 0; i < us * 8; i++);
@@ -32,6 +82,46 @@ static void sort_three(int32_t *a, int32_t *b, int32_t *c) {
     if (*a > *b) { temp = *a; *a = *b; *b = temp; }
 }
 
+static void Selecionar_Temperatura(bool temperatura) {
+    HAL_GPIO_WritePin(PESO_TEMP_GPIO_Port, PESO_TEMP_Pin, temperatura ? GPIO_PIN_SET : GPIO_PIN_RESET);
+}
+
+// Tara nova: a deriva do zero passa a contar a partir da temperatura atual
+static void Registrar_Temp_Tara(void) {
+#if ADS1232_TEMP_INTERLEAVE
+    s_temp_tara_c = s_temp_valida ? s_temp_c : s_comp.t_ref_c;
+#endif
+}
+
+#if ADS1232_TEMP_INTERLEAVE
+
+// Tenso do diodo -> C, com mdia exponencial. Leitura saturada ou
+// implausvel no entra no filtro.
+static void Acumular_Temperatura(int32_t contagem) {
+    float mv = ((float)contagem * (0.5f * ADS_TEMP_VREF_MV / ADS_TEMP_GANHO)) / 8388608.0f;
+    float temp_c = 25.0f + ((mv - ADS_TEMP_MV_25C) / ADS_TEMP_MV_POR_C);
+
+    if ((temp_c < ADS_TEMP_MIN_C) || (temp_c > ADS_TEMP_MAX_C)) {
+        s_intercala.invalidas++;
+        // Caminho do diodo inutilizvel (ex.: saturado): para de perder pesos
+        if (++s_invalidas_seguidas >= ADS_TEMP_MAX_INVALIDAS) {
+            s_intercala.razao = 0u;
+            s_invalidas_seguidas = 0;
+            LOG1(BAL_TEMP_DESLIGADA, ADS_TEMP_MAX_INVALIDAS);
+        }
+        return;
+    }
+    s_invalidas_seguidas = 0;
+    s_intercala.temperatura++;
+    if (!s_temp_valida) {
+        s_temp_c = temp_c;
+        s_temp_valida = true;
+    } else {
+        s_temp_c += (temp_c - s_temp_c) / ADS_TEMP_FILTRO_N;
+    }
+}
+#endif
+
 // --- Implementao das Funes Pblicas ---
 
 void Drv_ADS1232_DRDY_Callback(void)
@@ -40,10 +130,26 @@ void Drv_ADS1232_DRDY_Callback(void)
 }
 
 void ADS1232_Init(void) {
+    Selecionar_Temperatura(false);
+#if ADS1232_TEMP_INTERLEAVE
+    s_fase = FASE_PESO;
+    s_cont_fase = 0;
+#endif
     HAL_GPIO_WritePin(AD_PDWN_BAL_GPIO_Port, AD_PDWN_BAL_Pin, GPIO_PIN_RESET);
     HAL_Delay(1); 
     HAL_GPIO_WritePin(AD_PDWN_BAL_GPIO_Port, AD_PDWN_BAL_Pin, GPIO_PIN_SET);
 		cal_zero_adc = cal_points[0].adc_value;
+
+#if ADS1232_TEMP_INTERLEAVE
+    // Compensao de temperatura gravada pelo BTEMP COMP (bloco de sensores)
+    Config_CompCelula_t salvo;
+    if (Gerenciador_Config_Get_Comp_Celula(&salvo)) {
+        s_comp.t_ref_c = salvo.t_ref_c;
+        s_comp.zero_cont_por_c = salvo.zero_cont_por_c;
+        s_comp.span_ppm_por_c = salvo.span_ppm_por_c;
+        s_comp.ativo = (salvo.ativo != 0u);
+    }
+#endif
 }
 
 int32_t ADS1232_Read(void) {
@@ -76,10 +182,10 @@ int32_t ADS1232_Read_Median_of_3(void) {
 }
 
 int32_t ADS1232_Tare(void) { 
-    printf("Tarando... Aguarde estabilidade.\r\n");
-    const int num_samples = 32;
-    const int32_t stability_threshold = 300;
-    int max_retries = 10;
+    LOG0(BAL_TARA_INICIO);
+    const int num_samples = TARA_NUM_AMOSTRAS;
+    const int32_t stability_threshold = TARA_LIMIAR_ESTAVEL;
+    int max_retries = TARA_MAX_TENTATIVAS;
     
     for (int retry = 0; retry < max_retries; retry++) {
         int64_t sum = 0;
@@ -93,15 +199,63 @@ int32_t ADS1232_Tare(void) {
         }
         if ((max_val - min_val) < stability_threshold) {
             adc_offset = (int32_t)(sum / num_samples);
-            printf("Tara estavel concluida! Offset = %d\r\n", (int)adc_offset);
+            Registrar_Temp_Tara();
+            LOG1(BAL_TARA_OK, adc_offset);
             return adc_offset; 
         }
-        printf("Leituras instaveis (diff: %d). Tentando novamente...\r\n", (int)(max_val - min_val));
+        LOG1(BAL_TARA_INSTAVEL, max_val - min_val);
     }
-    printf("AVISO: Balanca nao estabilizou.\r\n");
+    LOG0(BAL_TARA_FALHOU);
     return adc_offset; // Retorna o offset antigo se falhar
 }
 
+static void Tara_Nova_Tentativa(void) {
+    s_tara_soma = 0;
+    s_tara_min = 0x7FFFFFFF;
+    s_tara_max = (int32_t)0x80000000;
+    s_tara_amostras = 0;
+}
+
+void ADS1232_Tare_Start(void) {
+    LOG0(BAL_TARA_INICIO);
+    s_tara_tentativa = 0;
+    Tara_Nova_Tentativa();
+    s_tara_estado = ADS1232_TARA_EM_ANDAMENTO;
+}
+
+ADS1232_TaraEstado_t ADS1232_Tare_Feed(int32_t amostra) {
+    if (s_tara_estado != ADS1232_TARA_EM_ANDAMENTO) {
+        return s_tara_estado;
+    }
+
+    s_tara_soma += amostra;
+    if (amostra < s_tara_min) s_tara_min = amostra;
+    if (amostra > s_tara_max) s_tara_max = amostra;
+    if (++s_tara_amostras < TARA_NUM_AMOSTRAS) {
+        return s_tara_estado;
+    }
+
+    if ((s_tara_max - s_tara_min) < TARA_LIMIAR_ESTAVEL) {
+        adc_offset = (int32_t)(s_tara_soma / TARA_NUM_AMOSTRAS);
+        Registrar_Temp_Tara();
+        LOG1(BAL_TARA_OK, adc_offset);
+        s_tara_estado = ADS1232_TARA_OK;
+    } else if (++s_tara_tentativa >= TARA_MAX_TENTATIVAS) {
+        LOG0(BAL_TARA_FALHOU);
+        s_tara_estado = ADS1232_TARA_FALHOU;
+    } else {
+        LOG1(BAL_TARA_INSTAVEL, s_tara_max - s_tara_min);
+        Tara_Nova_Tentativa();
+    }
+    return s_tara_estado;
+}
+
+ADS1232_TaraEstado_t ADS1232_Tare_GetState(void) {
+    return s_tara_estado;
+}
+
+static float Converter_Sem_Comp(int32_t eff_adc);
+
 float ADS1232_ConvertToGrams(int32_t raw_value)
 {
     // 1) Leitura lquida: remove a tara medida (adc_offset)
@@ -109,6 +263,23 @@ float ADS1232_ConvertToGrams(int32_t raw_value)
     //    => efetivamente "move" a leitura atual para o mesmo referencial da calibrao
     int32_t eff_adc = (raw_value - adc_offset) + cal_zero_adc;
 
+#if ADS1232_TEMP_INTERLEAVE
+    // Compensao trmica: o zero deriva desde a tara, o ganho desde a calibrao
+    float fator_span = 1.0f;
+    if (s_comp.ativo && s_temp_valida) {
+        eff_adc -= (int32_t)(s_comp.zero_cont_por_c * (s_temp_c - s_temp_tara_c));
+        fator_span = 1.0f / (1.0f + (s_comp.span_ppm_por_c * 1e-6f * (s_temp_c - s_comp.t_ref_c)));
+    }
+    return fator_span * Converter_Sem_Comp(eff_adc);
+#else
+    return Converter_Sem_Comp(eff_adc);
+#endif
+}
+
+// Interpolao na tabela de calibrao (contagem j reancorada no zero da tabela)
+static float Converter_Sem_Comp(int32_t eff_adc)
+{
+
     // 3) Interpolao linear no segmento correspondente
     for (int i = 0; i < NUM_CAL_POINTS - 1; i++) {
         int32_t x1 = cal_points[i].adc_value;
@@ -152,4 +323,102 @@ int32_t ADS1232_GetOffset(void) {
 
 void ADS1232_SetOffset(int32_t new_offset) {
     adc_offset = new_offset;
-}
\ No newline at end of file
+    Registrar_Temp_Tara();
+}
+
+/**
+ * @brief Chamar a cada DRDY no lugar de ADS1232_Read_Median_of_3. A cada
+ * 'razao' leituras de peso o pino TEMP comuta para o diodo interno; as
+ * 'descarte' converses seguintes a cada troca (ida e volta) so lidas e
+ * jogadas fora enquanto o filtro digital do ADS1232 assenta.
+ * @param[out] contagem Mediana de 3 (s quando retorna ADS1232_AMOSTRA_PESO).
+ */
+ADS1232_Amostra_t ADS1232_Ler_Intercalado(int32_t* contagem) {
+#if !ADS1232_TEMP_INTERLEAVE
+    // Sem canal de temperatura: toda converso  de peso
+    *contagem = ADS1232_Read_Median_of_3();
+    return ADS1232_AMOSTRA_PESO;
+#else
+    switch (s_fase) {
+        case FASE_TEMP_ASSENTA:
+        case FASE_PESO_ASSENTA:
+            (void)ADS1232_Read();
+            s_intercala.descartadas++;
+            if (++s_cont_fase >= s_intercala.descarte) {
+                s_fase = (s_fase == FASE_TEMP_ASSENTA) ? FASE_TEMP : FASE_PESO;
+                s_cont_fase = 0;
+            }
+            return ADS1232_AMOSTRA_DESCARTADA;
+
+        case FASE_TEMP:
+            Acumular_Temperatura(ADS1232_Read());
+            Selecionar_Temperatura(false);
+            s_fase = (s_intercala.descarte > 0u) ? FASE_PESO_ASSENTA : FASE_PESO;
+            s_cont_fase = 0;
+            return ADS1232_AMOSTRA_TEMP;
+
+        case FASE_PESO:
+        default:
+            *contagem = ADS1232_Read_Median_of_3();
+            s_intercala.peso++;
+            if ((s_intercala.razao > 0u) && (++s_cont_fase >= s_intercala.razao)) {
+                Selecionar_Temperatura(true);
+                s_fase = (s_intercala.descarte > 0u) ? FASE_TEMP_ASSENTA : FASE_TEMP;
+                s_cont_fase = 0;
+            }
+            return ADS1232_AMOSTRA_PESO;
+    }
+#endif
+}
+
+#if ADS1232_TEMP_INTERLEAVE
+
+/**
+ * @brief razao = leituras de peso entre leituras de temperatura (0 desliga o
+ *        canal de temperatura); descarte = converses ignoradas aps cada troca.
+ */
+void ADS1232_Set_Intercalacao(uint16_t razao, uint8_t descarte) {
+    s_intercala.razao = razao;
+    s_intercala.descarte = descarte;
+    s_invalidas_seguidas = 0;
+    if (s_fase == FASE_PESO) {
+        s_cont_fase = 0;
+    }
+}
+
+void ADS1232_Get_Intercalacao(ADS1232_Intercalacao_t* out) {
+    if (out == NULL) return;
+
+    *out = s_intercala;
+    uint32_t perdidas = s_intercala.temperatura + s_intercala.invalidas + s_intercala.descartadas;
+    uint32_t total = s_intercala.peso + perdidas;
+    out->perda_peso_pm = (total > 0u) ? (uint16_t)((perdidas * 1000u) / total) : 0u;
+}
+
+bool ADS1232_Get_Temperatura(float* temp_c) {
+    if (s_temp_valida && (temp_c != NULL)) {
+        *temp_c = s_temp_c;
+    }
+    return s_temp_valida;
+}
+
+bool ADS1232_Set_Comp_Temp(const ADS1232_CompTemp_t* comp) {
+    if (comp == NULL) {
+        return false;
+    }
+    s_comp = *comp;
+
+    Config_CompCelula_t salvo = {0};
+    salvo.t_ref_c = comp->t_ref_c;
+    salvo.zero_cont_por_c = comp->zero_cont_por_c;
+    salvo.span_ppm_por_c = comp->span_ppm_por_c;
+    salvo.ativo = comp->ativo ? 1u : 0u;
+    return Gerenciador_Config_Set_Comp_Celula(&salvo);
+}
+
+void ADS1232_Get_Comp_Temp(ADS1232_CompTemp_t* out) {
+    if (out != NULL) {
+        *out = s_comp;
+    }
+}
+#endif // ADS1232_TEMP_INTERLEAVE
@@ -22,6 +22,16 @@
 #define DWIN_RX_PACKET_TIMEOUT_MS  20
 #define DWIN_RX_ERROR_COOLDOWN_MS 100
 
+// Leitura de pgina (registrador de sistema PIC_NOW)
+#define DWIN_VP_PIC_NOW           0x0014
+#define DWIN_PIC_POLL_MS             500  // leitura peridica
+#define DWIN_PIC_RESP_TIMEOUT_MS     200  // resposta no chegou: libera nova leitura
+#define DWIN_PIC_APOS_TOQUE_MS        80  // navegao local do painel aps um toque
+// A resposta do DWIN no traz identificador, mas repete o nmero de words
+// pedido: cada leitura pede de 1 a DWIN_PIC_TAGS words (PIC_NOW + registradores
+// seguintes), em rodzio, e s a resposta com o nmero da leitura em voo vale.
+#define DWIN_PIC_TAGS                  4
+
 // Variveis estticas privadas
 static UART_HandleTypeDef* s_huart = NULL;
 static dwin_rx_callback_t s_rx_callback = NULL;
@@ -31,19 +41,72 @@ static volatile bool s_rx_pending_data = false;
 static volatile uint16_t s_received_len = 0u;
 static volatile uint32_t s_last_rx_event_tick = 0u;
 
-static uint8_t s_tx_fifo[DWIN_TX_FIFO_SIZE];
-static volatile uint16_t s_tx_fifo_head = 0u;
-static volatile uint16_t s_tx_fifo_tail = 0u;
+// Descritor de um comando enfileirado (um frame DWIN completo)
+typedef struct
+{
+    uint16_t          len;
+    uint16_t          seq;
+    dwin_tx_done_cb_t cb;
+    void*             ctx;
+} DWIN_TxMsg_t;
+
+// Estado de uma lane: FIFO de bytes + fila de descritores.
+// Manipulado apenas no superloop; o ISR de TX s libera s_dma_tx_busy.
+typedef struct
+{
+    uint8_t*           fifo;
+    uint16_t           fifo_size;
+    uint16_t           head;
+    uint16_t           tail;
+    DWIN_TxMsg_t*      msgs;
+    uint8_t            msgs_size;
+    uint8_t            msg_head;
+    uint8_t            msg_tail;
+    uint16_t           seq_next;
+    uint16_t           seq_last;   // ltimo aceito (0 = nenhum)
+    uint16_t           seq_done;
+    DWIN_TxLaneStats_t stats;
+} DWIN_TxLaneCtx_t;
+
+static uint8_t s_tx_fifo_ctrl[DWIN_TX_CTRL_FIFO_SIZE];
+static uint8_t s_tx_fifo_dados[DWIN_TX_FIFO_SIZE];
+static DWIN_TxMsg_t s_tx_msgs_ctrl[DWIN_TX_CTRL_MAX_MSGS];
+static DWIN_TxMsg_t s_tx_msgs_dados[DWIN_TX_DADOS_MAX_MSGS];
+static DWIN_TxLaneCtx_t s_tx_lanes[DWIN_TX_NUM_LANES];
+
 static uint8_t s_tx_dma_buffer[DWIN_TX_DMA_BUFFER_SIZE];
 static volatile bool s_dma_tx_busy = false;
+static uint8_t  s_lote_lane = 0u;        // lane do lote em voo
+static uint8_t  s_lote_msgs = 0u;        // comandos do lote aguardando concluso
+static uint16_t s_lote_len = 0u;
+static bool     s_lote_retentar = false; // HAL recusou o DMA; reenviar o mesmo lote
+
+// Rastreamento da pgina visvel (atualizado s no superloop)
+static uint16_t s_pagina_atual = DWIN_PAGINA_DESCONHECIDA;
+static bool     s_pic_aguardando = false;
+static dwin_tx_token_t s_pic_token = DWIN_TX_TOKEN_INVALIDO;   // leitura de PIC_NOW em voo
+static dwin_tx_token_t s_troca_token = DWIN_TX_TOKEN_INVALIDO; // ltima troca de tela
+static uint32_t s_pic_enviado_tick = 0u;
+static uint8_t  s_pic_tag = 0u;          // words pedidas pela leitura em voo
+static uint32_t s_pic_proxima_tick = 0u;
+static dwin_page_cb_t s_page_callback = NULL;
 static volatile bool s_rx_needs_reset = false;
 static volatile uint32_t s_rx_error_cooldown_tick = 0u;
+static uint32_t s_frames_rx = 0u;        // frames vlidos recebidos (sinal de "display vivo")
 
 
 
 // Forward declaration
 static void DWIN_Start_Listening(void);
-static bool DWIN_TX_Queue_Send_Bytes(const uint8_t* data, uint16_t size) ;
+static void DWIN_TX_Reset_Lanes(void);
+static uint16_t DWIN_TX_Lane_Used(const DWIN_TxLaneCtx_t* lane);
+static void DWIN_TX_Concluir_Lote(void);
+static void DWIN_Despachar_Frame(const uint8_t* frame, uint16_t len);
+static void DWIN_Pagina_Publicar(uint16_t pagina);
+static void DWIN_Pagina_Poll(uint32_t now);
+static void DWIN_Pagina_Agendar_Leitura(uint32_t atraso_ms);
+static bool DWIN_Pagina_Leitura_Anterior_A_Troca(void);
+static void DWIN_SetScreen_Concluido(dwin_tx_token_t token, bool enviado, void* ctx);
 
 
 static void DWIN_Start_Listening(void)
@@ -65,14 +128,19 @@ void DWIN_Driver_Init(UART_HandleTypeDef *huart, dwin_rx_callback_t callback)
 
     s_dma_tx_busy = false;
     s_rx_pending_data = false;
-    s_tx_fifo_head = 0u;
-    s_tx_fifo_tail = 0u;
     s_rx_needs_reset = false;
     s_rx_error_cooldown_tick = 0u;
 
     memset(s_rx_dma_buffer, 0, sizeof(s_rx_dma_buffer));
-    memset(s_tx_fifo, 0, sizeof(s_tx_fifo));
     memset(s_tx_dma_buffer, 0, sizeof(s_tx_dma_buffer));
+    DWIN_TX_Reset_Lanes();
+
+    // Aps (re)inicializao a pgina  desconhecida at a primeira leitura
+    s_pagina_atual = DWIN_PAGINA_DESCONHECIDA;
+    s_pic_aguardando = false;
+    s_pic_token = DWIN_TX_TOKEN_INVALIDO;
+    s_troca_token = DWIN_TX_TOKEN_INVALIDO;
+    DWIN_Pagina_Agendar_Leitura(0u);
 
     DWIN_Start_Listening();
 }
@@ -81,6 +149,8 @@ void DWIN_Driver_Process(void)
 {
     const uint32_t now = HAL_GetTick();
 
+    DWIN_Pagina_Poll(now);
+
     if (s_rx_error_cooldown_tick != 0u)
     {
         if ((now - s_rx_error_cooldown_tick) < DWIN_RX_ERROR_COOLDOWN_MS)
@@ -133,122 +203,514 @@ void DWIN_Driver_Process(void)
     DWIN_LOG("\r\n");
 #endif
 
+    // O buffer pode conter mais de um frame (ex.: toque + resposta de leitura)
+    uint16_t pos = 0u;
+    uint16_t restante = local_len;
+    while (restante >= 3u)
+    {
+        const uint8_t* frame = &local_buffer[pos];
+
+        if ((frame[0] != 0x5A) || (frame[1] != 0xA5))
+        {
+            DWIN_LOG("[ERROR] Pacote invalido descartado (len=%u): ", (unsigned)restante);
+            for (uint16_t i = pos; i < local_len; i++)
+            {
+                DWIN_LOG("%02X ", local_buffer[i]);
+            }
+            DWIN_LOG("\r\n");
+            break;
+        }
+
+        uint16_t declared_len = (uint16_t)(3u + frame[2]);
+        if (restante < declared_len)
+        {
+            DWIN_LOG("[ERROR] Pacote truncado: recebido=%u, esperado=%u\r\n", (unsigned)restante, (unsigned)declared_len);
+            break;
+        }
+
+        DWIN_Despachar_Frame(frame, declared_len);
+        pos = (uint16_t)(pos + declared_len);
+        restante = (uint16_t)(restante - declared_len);
+    }
+}
+
+static void DWIN_Despachar_Frame(const uint8_t* frame, uint16_t len)
+{
+    s_frames_rx++;
+
     // Filtro rpido ACK padro "OK"
-    if ((local_len == 6u) &&
-        (local_buffer[0] == 0x5A) && (local_buffer[1] == 0xA5) &&
-        (local_buffer[2] == 0x03) && (local_buffer[3] == 0x82) &&
-        (local_buffer[4] == 0x4F) && (local_buffer[5] == 0x4B))
+    if ((len == 6u) && (frame[3] == 0x82) && (frame[4] == 0x4F) && (frame[5] == 0x4B))
     {
         DWIN_LOG("[DEBUG] ACK 'OK' descartado.\r\n");
         return;
     }
 
-    // Validao pacote bsico
-    if ((local_len >= 4u) &&
-        (local_buffer[0] == 0x5A) && (local_buffer[1] == 0xA5))
+    // Resposta da leitura de PIC_NOW: 5A A5 LL 83 00 14 NN HH LL [...], NN words
+    if ((len >= 9u) && (frame[3] == 0x83) &&
+        (frame[4] == (uint8_t)(DWIN_VP_PIC_NOW >> 8)) && (frame[5] == (uint8_t)(DWIN_VP_PIC_NOW & 0xFF)))
     {
-        uint8_t payload_len = local_buffer[2];
-        uint8_t declared_len = 3u + payload_len;
-
-        if (local_len >= declared_len)
+        // Resposta atrasada de uma leitura que expirou traz outro NN e no 
+        // creditada  leitura atual. A lane CONTROLE  FIFO: uma leitura
+        // enfileirada antes de uma troca j transmitida responde com a
+        // pgina anterior e tambm  descartada
+        if (s_pic_aguardando && (frame[6] == s_pic_tag) && (len == (uint16_t)(7u + (2u * frame[6]))))
         {
-            if (s_rx_callback != NULL)
+            s_pic_aguardando = false;
+            if (!DWIN_Pagina_Leitura_Anterior_A_Troca())
             {
-                s_rx_callback(local_buffer, declared_len);
+                s_troca_token = DWIN_TX_TOKEN_INVALIDO; // leitura j posterior  troca
+                DWIN_Pagina_Publicar((uint16_t)((frame[7] << 8) | frame[8]));
             }
         }
-        else
+        return;
+    }
+
+    if (len < 4u)
+    {
+        return;
+    }
+
+    if (s_rx_callback != NULL)
+    {
+        s_rx_callback(frame, len);
+    }
+
+    // Um toque pode ter trocado a pgina localmente no painel
+    if (frame[3] == 0x83)
+    {
+        DWIN_Pagina_Agendar_Leitura(DWIN_PIC_APOS_TOQUE_MS);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Rastreamento de pgina
+
+static void DWIN_Pagina_Publicar(uint16_t pagina)
+{
+    if (pagina == s_pagina_atual)
+    {
+        return;
+    }
+    s_pagina_atual = pagina;
+    DWIN_LOG("[DEBUG] DWIN pagina atual: %u\r\n", pagina);
+
+    if (s_page_callback != NULL)
+    {
+        s_page_callback(pagina);
+    }
+}
+
+static void DWIN_Pagina_Agendar_Leitura(uint32_t atraso_ms)
+{
+    uint32_t alvo = HAL_GetTick() + atraso_ms;
+    if ((int32_t)(alvo - s_pic_proxima_tick) < 0)
+    {
+        s_pic_proxima_tick = alvo;
+    }
+}
+
+static void DWIN_Pagina_Poll(uint32_t now)
+{
+    if (s_huart == NULL)
+    {
+        return;
+    }
+
+    if (s_pic_aguardando)
+    {
+        if ((now - s_pic_enviado_tick) < DWIN_PIC_RESP_TIMEOUT_MS)
         {
-            DWIN_LOG("[ERROR] Pacote truncado: recebido=%d, esperado=%d\r\n", local_len, declared_len);
+            return;
         }
+        s_pic_aguardando = false; // sem resposta: tenta de novo no prximo ciclo
     }
-    else
+
+    if ((int32_t)(now - s_pic_proxima_tick) < 0)
+    {
+        return;
+    }
+
+    uint8_t tag = (uint8_t)((s_pic_tag % DWIN_PIC_TAGS) + 1u);
+    const uint8_t cmd_ler_pic[] = {
+        0x5A, 0xA5, 0x04, 0x83,
+        (uint8_t)(DWIN_VP_PIC_NOW >> 8), (uint8_t)(DWIN_VP_PIC_NOW & 0xFF), tag
+    };
+
+    if (DWIN_Driver_Send(DWIN_TX_LANE_CONTROLE, cmd_ler_pic, sizeof(cmd_ler_pic), NULL, NULL))
+    {
+        s_pic_aguardando = true;
+        s_pic_tag = tag;
+        s_pic_token = DWIN_Driver_GetLastToken(DWIN_TX_LANE_CONTROLE);
+        s_pic_enviado_tick = now;
+    }
+    s_pic_proxima_tick = now + DWIN_PIC_POLL_MS;
+}
+
+/**
+ * @brief true se a leitura em voo foi enfileirada antes da ltima troca de
+ *        tela e essa troca j foi transmitida (a resposta  da pgina antiga).
+ *        Com a troca ainda na fila, a pgina lida continua sendo a visvel.
+ */
+static bool DWIN_Pagina_Leitura_Anterior_A_Troca(void)
+{
+    if ((s_troca_token == DWIN_TX_TOKEN_INVALIDO) || (s_pic_token == DWIN_TX_TOKEN_INVALIDO))
+    {
+        return false;
+    }
+    // Mesma lane: comparao circular das sequncias (como em IsTokenDone)
+    int16_t delta = (int16_t)((uint16_t)(s_pic_token & 0xFFFFu) - (uint16_t)(s_troca_token & 0xFFFFu));
+    return (delta < 0) && DWIN_Driver_IsTokenDone(s_troca_token);
+}
+
+/**
+ * @brief Concluso do TX de uma troca de tela: publica a pgina de forma
+ *        otimista e agenda a confirmao por leitura.
+ */
+static void DWIN_SetScreen_Concluido(dwin_tx_token_t token, bool enviado, void* ctx)
+{
+    (void)token;
+    if (!enviado)
+    {
+        return; // troca descartada: a pgina continua a que o PIC_NOW informar
+    }
+    DWIN_Pagina_Publicar((uint16_t)(uintptr_t)ctx);
+    DWIN_Pagina_Agendar_Leitura(DWIN_PIC_APOS_TOQUE_MS);
+}
+
+void DWIN_Driver_Resume(void)
+{
+    // Registradores da USART e do DMA so retidos em STOP: s rearma a
+    // recepo se ela tiver sido interrompida (ex.: erro durante o desligamento)
+    if (s_huart->RxState != HAL_UART_STATE_BUSY_RX)
+    {
+        s_rx_needs_reset = true;
+    }
+
+    // O display foi desligado: a pgina volta a ser desconhecida
+    s_pagina_atual = DWIN_PAGINA_DESCONHECIDA;
+    s_pic_aguardando = false;
+    s_troca_token = DWIN_TX_TOKEN_INVALIDO;
+    DWIN_Pagina_Agendar_Leitura(0u);
+}
+
+uint32_t DWIN_Driver_GetRxFrameCount(void)
+{
+    return s_frames_rx;
+}
+
+uint16_t DWIN_Driver_GetCurrentPage(void)
+{
+    return s_pagina_atual;
+}
+
+void DWIN_Driver_SetPageChangeCallback(dwin_page_cb_t callback)
+{
+    s_page_callback = callback;
+}
+
+void DWIN_Driver_RequestPageReadback(void)
+{
+    DWIN_Pagina_Agendar_Leitura(0u);
+}
+
+//------------------------------------------------------------------------------
+// Fila de TX com lanes de prioridade
+
+static void DWIN_TX_Reset_Lanes(void)
+{
+    // Comandos ainda na fila no sero transmitidos: quem aguardava a
+    // concluso  avisado (enviado = false) para poder rearmar depois
+    for (uint8_t i = 0u; i < DWIN_TX_NUM_LANES; i++)
+    {
+        DWIN_TxLaneCtx_t* lane = &s_tx_lanes[i];
+        if (lane->msgs == NULL)
+        {
+            continue; // primeira inicializao
+        }
+        while (lane->msg_tail != lane->msg_head)
+        {
+            DWIN_TxMsg_t msg = lane->msgs[lane->msg_tail];
+            lane->msg_tail = (uint8_t)((lane->msg_tail + 1u) % lane->msgs_size);
+            if (msg.cb != NULL)
+            {
+                msg.cb(((dwin_tx_token_t)i << 16) | msg.seq, false, msg.ctx);
+            }
+        }
+    }
+
+    memset(s_tx_lanes, 0, sizeof(s_tx_lanes));
+
+    s_tx_lanes[DWIN_TX_LANE_CONTROLE].fifo      = s_tx_fifo_ctrl;
+    s_tx_lanes[DWIN_TX_LANE_CONTROLE].fifo_size = DWIN_TX_CTRL_FIFO_SIZE;
+    s_tx_lanes[DWIN_TX_LANE_CONTROLE].msgs      = s_tx_msgs_ctrl;
+    s_tx_lanes[DWIN_TX_LANE_CONTROLE].msgs_size = DWIN_TX_CTRL_MAX_MSGS;
+
+    s_tx_lanes[DWIN_TX_LANE_DADOS].fifo         = s_tx_fifo_dados;
+    s_tx_lanes[DWIN_TX_LANE_DADOS].fifo_size    = DWIN_TX_FIFO_SIZE;
+    s_tx_lanes[DWIN_TX_LANE_DADOS].msgs         = s_tx_msgs_dados;
+    s_tx_lanes[DWIN_TX_LANE_DADOS].msgs_size    = DWIN_TX_DADOS_MAX_MSGS;
+
+    for (uint8_t i = 0u; i < DWIN_TX_NUM_LANES; i++)
+    {
+        s_tx_lanes[i].seq_next         = 1u;
+        s_tx_lanes[i].stats.capacidade = (uint16_t)(s_tx_lanes[i].fifo_size - 1u);
+    }
+
+    s_lote_msgs = 0u;
+    s_lote_len = 0u;
+    s_lote_retentar = false;
+}
+
+static uint16_t DWIN_TX_Lane_Used(const DWIN_TxLaneCtx_t* lane)
+{
+    return (uint16_t)((lane->head + lane->fifo_size - lane->tail) % lane->fifo_size);
+}
+
+static uint8_t DWIN_TX_Lane_Msgs(const DWIN_TxLaneCtx_t* lane)
+{
+    return (uint8_t)((lane->msg_head + lane->msgs_size - lane->msg_tail) % lane->msgs_size);
+}
+
+/**
+ * @brief Retira da fila os comandos do lote transmitido e executa os callbacks.
+ *        Chamado apenas pelo superloop, depois que o ISR liberou o DMA.
+ */
+static void DWIN_TX_Concluir_Lote(void)
+{
+    DWIN_TxLaneCtx_t* lane = &s_tx_lanes[s_lote_lane];
+    uint8_t n = s_lote_msgs;
+
+    s_lote_msgs = 0u;
+    s_lote_len = 0u;
+
+    while (n-- > 0u)
     {
-        DWIN_LOG("[ERROR] Pacote invalido descartado (len=%d): ", local_len);
-        for (uint16_t i = 0u; i < local_len; i++)
+        DWIN_TxMsg_t msg = lane->msgs[lane->msg_tail];
+        lane->msg_tail = (uint8_t)((lane->msg_tail + 1u) % lane->msgs_size);
+        lane->seq_done = msg.seq;
+
+        if (msg.cb != NULL)
         {
-            DWIN_LOG("%02X ", local_buffer[i]);
+            msg.cb(((dwin_tx_token_t)s_lote_lane << 16) | msg.seq, true, msg.ctx);
         }
-        DWIN_LOG("\r\n");
     }
 }
 
 void DWIN_TX_Pump(void)
 {
-    if (s_dma_tx_busy || (s_tx_fifo_head == s_tx_fifo_tail))
+    if (s_dma_tx_busy)
     {
         return;
     }
 
-    HAL_NVIC_DisableIRQ(USART2_IRQn);
-    HAL_NVIC_DisableIRQ(DMAMUX1_DMA1_CH4_5_IRQn);
-
-    if (s_dma_tx_busy)
+    if (s_lote_retentar)
     {
-        HAL_NVIC_EnableIRQ(USART2_IRQn);
-        HAL_NVIC_EnableIRQ(DMAMUX1_DMA1_CH4_5_IRQn);
+        s_dma_tx_busy = true;
+        if (HAL_UART_Transmit_DMA(s_huart, s_tx_dma_buffer, s_lote_len) != HAL_OK)
+        {
+            s_dma_tx_busy = false;
+            return;
+        }
+        s_lote_retentar = false;
         return;
     }
 
-    s_dma_tx_busy = true;
+    if (s_lote_msgs > 0u)
+    {
+        DWIN_TX_Concluir_Lote();
+    }
 
+    // CONTROLE tem prioridade; DADOS s  servido com CONTROLE vazio
+    uint8_t lane_id;
+    if (DWIN_TX_Lane_Msgs(&s_tx_lanes[DWIN_TX_LANE_CONTROLE]) > 0u)
+    {
+        lane_id = DWIN_TX_LANE_CONTROLE;
+    }
+    else if (DWIN_TX_Lane_Msgs(&s_tx_lanes[DWIN_TX_LANE_DADOS]) > 0u)
+    {
+        lane_id = DWIN_TX_LANE_DADOS;
+    }
+    else
+    {
+        return;
+    }
+
+    // Empacota apenas frames inteiros, para que cada concluso de DMA
+    // corresponda a um conjunto exato de tokens.
+    DWIN_TxLaneCtx_t* lane = &s_tx_lanes[lane_id];
+    uint8_t pendentes = DWIN_TX_Lane_Msgs(lane);
+    uint8_t idx = lane->msg_tail;
     uint16_t bytes_to_send = 0u;
-    while ((s_tx_fifo_tail != s_tx_fifo_head) && (bytes_to_send < DWIN_TX_DMA_BUFFER_SIZE))
+    uint8_t n = 0u;
+
+    while ((n < pendentes) &&
+           ((bytes_to_send + lane->msgs[idx].len) <= DWIN_TX_DMA_BUFFER_SIZE))
     {
-        s_tx_dma_buffer[bytes_to_send] = s_tx_fifo[s_tx_fifo_tail];
-        s_tx_fifo_tail = (uint16_t)((s_tx_fifo_tail + 1u) % DWIN_TX_FIFO_SIZE);
-        bytes_to_send++;
+        for (uint16_t i = 0u; i < lane->msgs[idx].len; i++)
+        {
+            s_tx_dma_buffer[bytes_to_send++] = lane->fifo[lane->tail];
+            lane->tail = (uint16_t)((lane->tail + 1u) % lane->fifo_size);
+        }
+        idx = (uint8_t)((idx + 1u) % lane->msgs_size);
+        n++;
     }
 
-    HAL_NVIC_EnableIRQ(USART2_IRQn);
-    HAL_NVIC_EnableIRQ(DMAMUX1_DMA1_CH4_5_IRQn);
+    s_lote_lane = lane_id;
+    s_lote_msgs = n;
+    s_lote_len = bytes_to_send;
 
+    s_dma_tx_busy = true;
     if (HAL_UART_Transmit_DMA(s_huart, s_tx_dma_buffer, bytes_to_send) != HAL_OK)
     {
         s_dma_tx_busy = false;
+        s_lote_retentar = true;
     }
 }
 
-static bool DWIN_TX_Queue_Send_Bytes(const uint8_t* data, uint16_t size)
+bool DWIN_Driver_Send(DWIN_TxLane_t lane_id, const uint8_t* data, uint16_t size,
+                      dwin_tx_done_cb_t cb, void* ctx)
 {
-    if ((data == NULL) || (size == 0u)) { return false; }
+    if ((data == NULL) || (size == 0u) || (lane_id >= DWIN_TX_NUM_LANES))
+    {
+        return false;
+    }
 
-    HAL_NVIC_DisableIRQ(USART2_IRQn);
-    HAL_NVIC_DisableIRQ(DMAMUX1_DMA1_CH4_5_IRQn);
+    DWIN_TxLaneCtx_t* lane = &s_tx_lanes[lane_id];
+    uint16_t free_space = (uint16_t)(lane->fifo_size - 1u - DWIN_TX_Lane_Used(lane));
 
-    uint16_t free_space;
-    if (s_tx_fifo_head >= s_tx_fifo_tail)
+    if ((size > DWIN_TX_DMA_BUFFER_SIZE) || (size > free_space) ||
+        (DWIN_TX_Lane_Msgs(lane) >= (uint8_t)(lane->msgs_size - 1u)))
     {
-        free_space = DWIN_TX_FIFO_SIZE - (s_tx_fifo_head - s_tx_fifo_tail) - 1u;
+        lane->stats.descartados++;
+        lane->stats.bytes_descartados += size;
+        return false;
     }
-    else
+
+    for (uint16_t i = 0u; i < size; i++)
+    {
+        lane->fifo[lane->head] = data[i];
+        lane->head = (uint16_t)((lane->head + 1u) % lane->fifo_size);
+    }
+
+    DWIN_TxMsg_t* msg = &lane->msgs[lane->msg_head];
+    msg->len = size;
+    msg->seq = lane->seq_next;
+    msg->cb  = cb;
+    msg->ctx = ctx;
+    lane->seq_last = msg->seq;
+    lane->msg_head = (uint8_t)((lane->msg_head + 1u) % lane->msgs_size);
+
+    // Sequncia 0  reservada (token invlido)
+    lane->seq_next++;
+    if (lane->seq_next == 0u)
+    {
+        lane->seq_next = 1u;
+    }
+
+    lane->stats.enfileirados++;
+    uint16_t usado = DWIN_TX_Lane_Used(lane);
+    if (usado > lane->stats.high_water)
     {
-        free_space = (s_tx_fifo_tail - s_tx_fifo_head) - 1u;
+        lane->stats.high_water = usado;
     }
 
-    if (size > free_space)
+    return true;
+}
+
+dwin_tx_token_t DWIN_Driver_GetLastToken(DWIN_TxLane_t lane_id)
+{
+    if (lane_id >= DWIN_TX_NUM_LANES)
+    {
+        return DWIN_TX_TOKEN_INVALIDO;
+    }
+
+    if (s_tx_lanes[lane_id].seq_last == 0u)
+    {
+        return DWIN_TX_TOKEN_INVALIDO;
+    }
+    return ((dwin_tx_token_t)lane_id << 16) | s_tx_lanes[lane_id].seq_last;
+}
+
+bool DWIN_Driver_IsTokenDone(dwin_tx_token_t token)
+{
+    uint32_t lane_id = token >> 16;
+    uint16_t seq = (uint16_t)(token & 0xFFFFu);
+
+    if ((token == DWIN_TX_TOKEN_INVALIDO) || (lane_id >= DWIN_TX_NUM_LANES))
+    {
+        return true;
+    }
+
+    // Comparao circular: a fila nunca tem 32768 comandos pendentes
+    return ((int16_t)(s_tx_lanes[lane_id].seq_done - seq) >= 0);
+}
+
+bool DWIN_Driver_NotifyWhenDone(dwin_tx_token_t token, dwin_tx_done_cb_t cb, void* ctx)
+{
+    if ((cb == NULL) || DWIN_Driver_IsTokenDone(token))
     {
-        HAL_NVIC_EnableIRQ(USART2_IRQn);
-        HAL_NVIC_EnableIRQ(DMAMUX1_DMA1_CH4_5_IRQn);
-        // Aqui pode se implementar contador de comandos descartados
         return false;
     }
 
-    for (uint16_t i = 0u; i < size; i++)
+    DWIN_TxLaneCtx_t* lane = &s_tx_lanes[token >> 16];
+    uint16_t seq = (uint16_t)(token & 0xFFFFu);
+
+    for (uint8_t idx = lane->msg_tail; idx != lane->msg_head;
+         idx = (uint8_t)((idx + 1u) % lane->msgs_size))
     {
-        s_tx_fifo[s_tx_fifo_head] = data[i];
-        s_tx_fifo_head = (uint16_t)((s_tx_fifo_head + 1u) % DWIN_TX_FIFO_SIZE);
+        if (lane->msgs[idx].seq == seq)
+        {
+            if (lane->msgs[idx].cb != NULL)
+            {
+                return false;
+            }
+            lane->msgs[idx].cb  = cb;
+            lane->msgs[idx].ctx = ctx;
+            return true;
+        }
     }
+    return false;
+}
 
-    HAL_NVIC_EnableIRQ(USART2_IRQn);
-    HAL_NVIC_EnableIRQ(DMAMUX1_DMA1_CH4_5_IRQn);
+uint16_t DWIN_Driver_GetTxFree(DWIN_TxLane_t lane_id)
+{
+    if (lane_id >= DWIN_TX_NUM_LANES)
+    {
+        return 0u;
+    }
+    const DWIN_TxLaneCtx_t* lane = &s_tx_lanes[lane_id];
+    if (DWIN_TX_Lane_Msgs(lane) >= (uint8_t)(lane->msgs_size - 1u))
+    {
+        return 0u;
+    }
+    return (uint16_t)(lane->fifo_size - 1u - DWIN_TX_Lane_Used(lane));
+}
 
-    return true;
+void DWIN_Driver_GetTxStats(DWIN_TxLane_t lane_id, DWIN_TxLaneStats_t* out)
+{
+    if ((out == NULL) || (lane_id >= DWIN_TX_NUM_LANES))
+    {
+        return;
+    }
+    *out = s_tx_lanes[lane_id].stats;
+}
+
+void DWIN_Driver_ResetTxStats(void)
+{
+    for (uint8_t i = 0u; i < DWIN_TX_NUM_LANES; i++)
+    {
+        s_tx_lanes[i].stats.enfileirados      = 0u;
+        s_tx_lanes[i].stats.descartados       = 0u;
+        s_tx_lanes[i].stats.bytes_descartados = 0u;
+        s_tx_lanes[i].stats.high_water        = DWIN_TX_Lane_Used(&s_tx_lanes[i]);
+    }
 }
 
 bool DWIN_Driver_IsTxBusy(void)
 {
-    return (s_dma_tx_busy || (s_tx_fifo_head != s_tx_fifo_tail));
+    return (s_dma_tx_busy || s_lote_retentar ||
+            (DWIN_TX_Lane_Msgs(&s_tx_lanes[DWIN_TX_LANE_CONTROLE]) > 0u) ||
+            (DWIN_TX_Lane_Msgs(&s_tx_lanes[DWIN_TX_LANE_DADOS]) > 0u));
 }
 
 bool DWIN_Driver_SetScreen(uint16_t screen_id)
@@ -259,7 +721,15 @@ bool DWIN_Driver_SetScreen(uint16_t screen_id)
         0x5A, 0x01,
         (uint8_t)(screen_id >> 8), (uint8_t)(screen_id & 0xFF)
     };
-    return DWIN_TX_Queue_Send_Bytes(cmd_buffer, sizeof(cmd_buffer));
+    if (!DWIN_Driver_Send(DWIN_TX_LANE_CONTROLE, cmd_buffer, sizeof(cmd_buffer),
+                          DWIN_SetScreen_Concluido, (void*)(uintptr_t)screen_id))
+    {
+        return false;
+    }
+    // Uma leitura de PIC_NOW j na fila continua pendente; a resposta dela 
+    // descartada se chegar depois desta troca (ver DWIN_Despachar_Frame)
+    s_troca_token = DWIN_Driver_GetLastToken(DWIN_TX_LANE_CONTROLE);
+    return true;
 }
 
 bool DWIN_Driver_WriteInt(uint16_t vp_address, int16_t value)
@@ -269,7 +739,7 @@ bool DWIN_Driver_WriteInt(uint16_t vp_address, int16_t value)
         (uint8_t)(vp_address >> 8), (uint8_t)(vp_address & 0xFF),
         (uint8_t)(value >> 8), (uint8_t)(value & 0xFF)
     };
-    return DWIN_TX_Queue_Send_Bytes(cmd_buffer, sizeof(cmd_buffer));
+    return DWIN_Driver_Send(DWIN_TX_LANE_DADOS, cmd_buffer, sizeof(cmd_buffer), NULL, NULL);
 }
 
 bool DWIN_Driver_WriteInt32(uint16_t vp_address, int32_t value)
@@ -280,7 +750,7 @@ bool DWIN_Driver_WriteInt32(uint16_t vp_address, int32_t value)
         (uint8_t)((value >> 24) & 0xFF), (uint8_t)((value >> 16) & 0xFF),
         (uint8_t)((value >> 8) & 0xFF), (uint8_t)(value & 0xFF)
     };
-    return DWIN_TX_Queue_Send_Bytes(cmd_buffer, sizeof(cmd_buffer));
+    return DWIN_Driver_Send(DWIN_TX_LANE_DADOS, cmd_buffer, sizeof(cmd_buffer), NULL, NULL);
 }
 
 bool DWIN_Driver_WriteString(uint16_t vp_address, const char* text, uint16_t max_len)
@@ -327,7 +797,7 @@ bool DWIN_Driver_WriteString(uint16_t vp_address, const char* text, uint16_t max
     temp_frame_buffer[6 + text_len + 1] = 0xFF;
 
     // 6. Enviar o frame completo (total_frame_size j est correto)
-    return DWIN_TX_Queue_Send_Bytes(temp_frame_buffer, total_frame_size);
+    return DWIN_Driver_Send(DWIN_TX_LANE_DADOS, temp_frame_buffer, total_frame_size, NULL, NULL);
 }
 bool DWIN_Driver_WriteRawBytes(const uint8_t* data, uint16_t size)
 {
@@ -335,7 +805,7 @@ bool DWIN_Driver_WriteRawBytes(const uint8_t* data, uint16_t size)
     {
         return false;
     }
-    return DWIN_TX_Queue_Send_Bytes(data, size);
+    return DWIN_Driver_Send(DWIN_TX_LANE_DADOS, data, size, NULL, NULL);
 }
 
 
@@ -348,6 +818,7 @@ bool DWIN_Driver_WriteRawBytes(const uint8_t* data, uint16_t size)
 void DWIN_Driver_HandleTxCplt(UART_HandleTypeDef *huart)
 {
     (void)huart;
+    // Concluso dos tokens  processada no superloop (DWIN_TX_Pump)
     s_dma_tx_busy = false;
 }
 
@@ -1,6 +1,16 @@
 #include "pcb_frequency.h"
 #include "tim.h"  // Garante acesso ao handle htim2
 
+// O TIM2 conta livre (32 bits); cada janela  a diferena entre duas
+// capturas, ento no h pulsos perdidos entre ler e zerar o contador.
+static volatile uint16_t s_janela_ms = FREQ_JANELA_PADRAO_MS;
+static volatile uint16_t s_restante_ms = FREQ_JANELA_PADRAO_MS;
+static volatile uint32_t s_contagem_inicio = 0;
+static volatile uint32_t s_pulsos_ultima = 0;
+static volatile uint16_t s_janela_ultima = FREQ_JANELA_PADRAO_MS;
+static volatile uint32_t s_seq_janela = 0;
+static Frequency_Aviso_t s_aviso = NULL;
+
 /**
  * @brief Inicia o Timer 2 no modo de contagem de pulsos.
  */
@@ -8,14 +18,7 @@ void Frequency_Init(void)
 {
   // Inicia o timer 2. Ele vai contar os pulsos em background.
   HAL_TIM_Base_Start(&htim2);
-}
-
-/**
- * @brief Zera o contador de pulsos do timer.
- */
-void Frequency_Reset(void)
-{
-  __HAL_TIM_SET_COUNTER(&htim2, 0);
+  Frequency_Set_Janela_ms(FREQ_JANELA_PADRAO_MS);
 }
 
 /**
@@ -24,4 +27,46 @@ void Frequency_Reset(void)
 uint32_t Frequency_Get_Pulse_Count(void)
 {
   return __HAL_TIM_GET_COUNTER(&htim2);
-}
\ No newline at end of file
+}
+
+void Frequency_Set_Janela_ms(uint16_t janela_ms)
+{
+  if (janela_ms == 0) janela_ms = FREQ_JANELA_PADRAO_MS;
+
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  s_janela_ms = janela_ms;
+  s_restante_ms = janela_ms;
+  s_contagem_inicio = __HAL_TIM_GET_COUNTER(&htim2);
+  __set_PRIMASK(primask);
+}
+
+void Frequency_Set_Aviso_Janela(Frequency_Aviso_t aviso)
+{
+  s_aviso = aviso;
+}
+
+void Frequency_Tick_ms(void)
+{
+  if (--s_restante_ms > 0) return;
+
+  uint32_t contagem = __HAL_TIM_GET_COUNTER(&htim2);
+  s_pulsos_ultima = contagem - s_contagem_inicio;
+  s_contagem_inicio = contagem;
+  s_janela_ultima = s_janela_ms;
+  s_restante_ms = s_janela_ms;
+  s_seq_janela++;
+
+  if (s_aviso != NULL) s_aviso();
+}
+
+uint32_t Frequency_Get_Janela(uint32_t* pulsos, uint16_t* janela_ms)
+{
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  uint32_t seq = s_seq_janela;
+  if (pulsos != NULL) *pulsos = s_pulsos_ultima;
+  if (janela_ms != NULL) *janela_ms = s_janela_ultima;
+  __set_PRIMASK(primask);
+  return seq;
+}
@@ -62,11 +62,49 @@ void PWM_Servo_SetAngle(Servo_t *servo, float angle)
     }
 
     // Converte o ngulo desejado para o valor bruto do registrador CCR.
-    uint32_t ccr_value = map_angle_to_ccr(servo, angle);
+    PWM_Servo_Set_Pulso_us(servo, (uint16_t)map_angle_to_ccr(servo, angle));
+}
+
+// Converte um ngulo inteiro para a largura de pulso (s aritmtica inteira).
+uint16_t PWM_Servo_Graus_Para_Pulso(const Servo_t *servo, uint8_t graus)
+{
+    if (servo == NULL)
+    {
+        return 0;
+    }
+    if (graus > 180u)
+    {
+        graus = 180u;
+    }
+
+    uint32_t pulse_range_us = (uint32_t)(servo->max_pulse_us - servo->min_pulse_us);
+    return (uint16_t)(servo->min_pulse_us + ((pulse_range_us * graus) + 90u) / 180u);
+}
+
+// Escreve a largura do pulso no CCR, apenas se mudou.
+void PWM_Servo_Set_Pulso_us(Servo_t *servo, uint16_t pulso_us)
+{
+    if (servo == NULL || servo->htim == NULL)
+    {
+        return;
+    }
+
+    if (pulso_us < servo->min_pulse_us)
+    {
+        pulso_us = servo->min_pulse_us;
+    }
+    if (pulso_us > servo->max_pulse_us)
+    {
+        pulso_us = servo->max_pulse_us;
+    }
 
     // Define o valor de comparao do timer, o que altera a largura do pulso
     // e, consequentemente, move o servo para a posio desejada.
-    __HAL_TIM_SET_COMPARE(servo->htim, servo->channel, ccr_value);
+    if (pulso_us != servo->pulso_atual_us)
+    {
+        __HAL_TIM_SET_COMPARE(servo->htim, servo->channel, pulso_us);
+        servo->pulso_atual_us = pulso_us;
+    }
 }
 
 // Para a gerao de PWM para um servo especfico.
@@ -1,15 +1,19 @@
 /*******************************************************************************
  * @file        temp_sensor.c
  * @brief       Mdulo para leitura do sensor de temperatura interno do MCU.
- * @details     Esta implementao estvel utiliza o dado de calibrao de
- * fbrica de ponto nico (`TS_CAL1`) para fornecer uma leitura de
- * temperatura confivel e mais precisa do que os valores genricos
- * do datasheet. O resultado  a temperatura interna do chip.
+ * @details     O ADC roda em modo contnuo na sequncia fixa (canal 9 =
+ * sensor de temperatura, canal 10 = VREFINT), com sobreamostragem de 64x e
+ * deslocamento de 2 bits (resultado de 16 bits = 12 bits x 16). O DMA1 Ch5
+ * escreve num buffer circular de TEMP_ADC_VARREDURAS pares sem gerar
+ * interrupo. A leitura faz a mdia do buffer, mede a VDDA real pelo
+ * VREFINT_CAL e aplica a calibrao de fbrica de ponto nico (TS_CAL1)
+ * referida aos mesmos 3,0 V em que ela foi gravada.
  ******************************************************************************/
 
 #include "temp_sensor.h"
 #include "adc.h"
-#include "stm32c0xx_ll_adc.h" // Inclui o header da ST que contm a definio para TEMPSENSOR_CAL1_ADDR
+#include "stm32c0xx_ll_adc.h" // TEMPSENSOR_CAL1_ADDR, VREFINT_CAL_ADDR
+#include <stddef.h>
 
 extern ADC_HandleTypeDef hadc1;
 
@@ -17,63 +21,136 @@ extern ADC_HandleTypeDef hadc1;
 // Constantes de Calibrao (Especficas do Datasheet do STM32C0)
 //==============================================================================
 
-#define TEMP_CAL_P1_TEMP   15.0f // Temperatura de referncia para o ponto de calibrao 1 (em C).
+#define TEMP_CAL_P1_CENTI    1500   // Temperatura do ponto de calibrao 1 (centsimos de C).
 
-#define AVG_SLOPE_TYP       0.00161f // Slope (inclinao) da curva do sensor, em Volts/C (1.61mV/C).
+#define AVG_SLOPE_UV         1610   // Slope (inclinao) da curva do sensor, em V/C (1.61mV/C).
 
-#define VDDA_CALIBRATION_VOLTAGE 3.0f // Tenso de referncia usada durante a calibrao de fbrica.
+#define VDDA_CAL_MV          3000u  // Tenso de referncia usada durante a calibrao de fbrica.
 
-#define ADC_MAX_VALUE       4095.0f // Resoluo mxima de um ADC de 12 bits (2^12 - 1).
+#define ADC_FUNDO_ESCALA_12B 4095u  // Resoluo mxima de um ADC de 12 bits (2^12 - 1).
+#define ADC_FATOR_OVS        16u    // 64 amostras >> 2: resultado = 12 bits x 16
+
+// Pares (temperatura, VREFINT) no buffer circular. 8 varreduras = 512
+// converses por canal na mdia, renovadas a cada ~15 ms.
+#define TEMP_ADC_VARREDURAS  8u
+#define TEMP_ADC_CANAIS      2u
+
+static volatile uint16_t s_amostras[TEMP_ADC_VARREDURAS * TEMP_ADC_CANAIS];
+static bool s_ativo = false;
 
 //==============================================================================
-// Implementao da Funo Pblica
+// Funes Privadas
 //==============================================================================
 
-//L a temperatura do sensor interno do MCU usando calibrao de fbrica.
-float TempSensor_GetTemperature(void)
+static void Iniciar_Varredura(void)
 {
-    uint32_t raw_temp_sensor = 0;
-
-    // Configura o ADC para ler o canal do sensor de temperatura
-    ADC_ChannelConfTypeDef sConfig = {0};
-    sConfig.Channel = ADC_CHANNEL_TEMPSENSOR;
-    sConfig.Rank = ADC_REGULAR_RANK_1;
-    sConfig.SamplingTime = ADC_SAMPLETIME_160CYCLES_5;
-		
-    if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
-    {
-        return -273.0f;
+    if (HAL_ADC_Start_DMA(&hadc1, (uint32_t*)s_amostras, TEMP_ADC_VARREDURAS * TEMP_ADC_CANAIS) != HAL_OK) {
+        return;
     }
-
-    if (HAL_ADC_Start(&hadc1) != HAL_OK)
-    {
-        return -273.0f;
+    // Ningum espera pelo fim do buffer: s a interrupo de erro fica ativa
+    __HAL_DMA_DISABLE_IT(hadc1.DMA_Handle, DMA_IT_HT | DMA_IT_TC);
+    s_ativo = true;
+}
+
+/**
+ * @brief Soma as varreduras do buffer. Uma posio ainda em zero indica que
+ *        o DMA no completou a primeira volta.
+ */
+static bool Somar_Buffer(uint32_t* soma_ts, uint32_t* soma_vref)
+{
+    uint32_t ts = 0, vref = 0;
+
+    for (uint32_t i = 0; i < TEMP_ADC_VARREDURAS; i++) {
+        uint16_t a = s_amostras[(i * TEMP_ADC_CANAIS) + 0u];
+        uint16_t b = s_amostras[(i * TEMP_ADC_CANAIS) + 1u];
+        if ((a == 0u) || (b == 0u)) {
+            return false;
+        }
+        ts += a;
+        vref += b;
     }
-    if (HAL_ADC_PollForConversion(&hadc1, 100) == HAL_OK)
-    {
-        raw_temp_sensor = HAL_ADC_GetValue(&hadc1);
+    *soma_ts = ts;
+    *soma_vref = vref;
+    return true;
+}
+
+/**
+ * @brief VDDA (mV) = VDDA_CAL * VREFINT_CAL / VREFINT medido.
+ */
+static uint32_t Calcular_VDDA_mV(uint32_t soma_vref)
+{
+    uint32_t cal = *VREFINT_CAL_ADDR;
+    return (VDDA_CAL_MV * cal * ADC_FATOR_OVS * TEMP_ADC_VARREDURAS) / soma_vref;
+}
+
+//==============================================================================
+// Implementao das Funes Pblicas
+//==============================================================================
+
+void TempSensor_Init(void)
+{
+    HAL_ADCEx_Calibration_Start(&hadc1);
+    Iniciar_Varredura();
+}
+
+void TempSensor_Suspender(void)
+{
+    if (s_ativo) {
+        HAL_ADC_Stop_DMA(&hadc1);
+        s_ativo = false;
     }
-    HAL_ADC_Stop(&hadc1);
+}
 
-    if (raw_temp_sensor == 0)
-    {
-        return -273.0f;
+void TempSensor_Retomar(void)
+{
+    if (!s_ativo) {
+        Iniciar_Varredura();
     }
+}
 
-    // --- Incio do Clculo de Preciso Final ---
+bool TempSensor_Pronto(void)
+{
+    uint32_t ts, vref;
+    return Somar_Buffer(&ts, &vref);
+}
+
+uint16_t TempSensor_Get_VDDA_mV(void)
+{
+    uint32_t soma_ts, soma_vref;
+    if (!Somar_Buffer(&soma_ts, &soma_vref)) {
+        return 0;
+    }
+    return (uint16_t)Calcular_VDDA_mV(soma_vref);
+}
 
-    uint16_t temp_cal1_raw = *TEMPSENSOR_CAL1_ADDR;
+int32_t TempSensor_Get_Centi(void)
+{
+    uint32_t soma_ts, soma_vref;
+    if (!Somar_Buffer(&soma_ts, &soma_vref)) {
+        return TEMP_SENSOR_INVALIDO;
+    }
 
-    // 2. Converte a contagem de calibrao para a tenso correspondente (V30)
-    //    usando a tenso de referncia da calibrao (3.0V).
-    float v30_calibrated = VDDA_CALIBRATION_VOLTAGE * (float)temp_cal1_raw / ADC_MAX_VALUE;
+    // 1. Leitura do sensor referida a 3,0 V (mesma escala do TS_CAL1),
+    //    em unidades de 1/16 LSB de 12 bits.
+    uint32_t vdda_mv = Calcular_VDDA_mV(soma_vref);
+    int32_t ts_3v0 = (int32_t)((soma_ts * vdda_mv) / (TEMP_ADC_VARREDURAS * VDDA_CAL_MV));
 
-    // 3. Converte a leitura atual do sensor para tenso (Vsense) usando a mesma
-    //    tenso de referncia para manter a consistncia.
-    float vsense_voltage = VDDA_CALIBRATION_VOLTAGE * (float)raw_temp_sensor / ADC_MAX_VALUE;
+    // 2. Diferena para o ponto de calibrao, na mesma escala.
+    int32_t delta = ts_3v0 - ((int32_t)*TEMPSENSOR_CAL1_ADDR * (int32_t)ADC_FATOR_OVS);
 
-    // 4. Aplica a frmula de ponto nico usando a tenso de calibrao REAL do chip.
-    float temperature_celsius = ((vsense_voltage - v30_calibrated) / AVG_SLOPE_TYP) + TEMP_CAL_P1_TEMP;
+    // 3. Converte para tenso e aplica a inclinao:
+    //    T = delta * (3,0 V / 4095 / 16) / slope + T_cal
+    int64_t num = (int64_t)delta * ((int64_t)VDDA_CAL_MV * 1000 * 100);   // V x 100
+    int64_t den = (int64_t)ADC_FUNDO_ESCALA_12B * ADC_FATOR_OVS * AVG_SLOPE_UV;
+    return (int32_t)(num / den) + TEMP_CAL_P1_CENTI;
+}
 
-    return temperature_celsius;
-}
\ No newline at end of file
+//L a temperatura do sensor interno do MCU usando calibrao de fbrica.
+float TempSensor_GetTemperature(void)
+{
+    int32_t centi = TempSensor_Get_Centi();
+    if (centi == TEMP_SENSOR_INVALIDO) {
+        return -273.0f;
+    }
+    return (float)centi / 100.0f;
+}
@@ -16,6 +16,15 @@
 
 #include "GXXX_Equacoes.h"
 
+// Receitas de medio (ver GXXX_Equacoes.h). A PADRAO  conservadora:
+// funil 75, raspador 90 com duas varreduras e a janela de 1 s de antes.
+const struct Receita_ROM Receita[NR_RECEITAS]={
+    /*               Enche_ms  Degrau  Faixa  Funil  Scrap  Passadas  Res  Janela_ms */
+    [RECEITA_PADRAO] = { 10000 ,   20 ,     5 ,   75 ,   90 ,      2 ,  0 ,  1000 },
+    [RECEITA_MEDIO]  = {  6000 ,   20 ,     5 ,   75 ,   90 ,      1 ,  0 ,   750 },
+    [RECEITA_GRAUDO] = {  4000 ,   30 ,    10 ,   60 ,   90 ,      1 ,  0 ,   500 },
+};
+
 // CORREO: A palavra-chave 'code' foi substituda por 'const' para garantir
 // que a tabela seja alocada na memria Flash (ROM) de forma padronizada.
 /*const struct Produtos_ROM Produto[]={
@@ -42,139 +51,139 @@
 
 
 const struct Produtos_ROM Produto[]={
-    { "Amaranto        " , "Amaranto        " , "Amaranth        " , "Amarante        " , "Amaranto        " , "Amarant         " ,  13853 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   9 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Amendoa Nat 100g" , "Almendra Natural" , "Almond Natural  " , "Amande Naturelle" , "Mandorla Natur." , "Mandel Naturlich" ,  13820 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   3 ,  30 ,  100 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Amendoa Nat Aus " , "Almendra Nat Aus" , "Almond Nat Aus  " , "Amande Nat Aus  " , "Mandorla N. Aus " , "Mandel Nat Aus  " ,   1217 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   3 ,  30 ,  100 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Amendoim        " , "Mani            " , "Runner Peanuts  " , "Cacahuetes      " , "Arachidi        " , "Erdneusse Gesch " ,  13817 ,    3.0600E-6 ,   -1.1300E-3 ,    1.9200E-1 ,    9.6000E-1 ,   1 ,  30 ,  142 ,    0.0000E+0 ,   -1.0000E-1 },
-    { "Amendoim Torrado" , "Mani Tostado    " , "Roasted Peanuts " , "Cacahuetes Gril." , "Arachidi Tostate" , "Gerostete Erdnu." ,  13773 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   0 ,  10 ,  150 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Arroz Bene Inte " , "Arroz Integral  " , "Brown Rice      " , "Riz Complet     " , "Riso Integrale  " , "Brauner Reis    " ,  13886 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Arroz Bene Parb " , "Arroz Parboiled " , "Parboiled Rice  " , "Riz Etuve       " , "Riso Parboiled  " , "Parboiled Reis  " ,  13869 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Arroz Bene Poli " , "Arroz Pulido    " , "Rice Polished Na" , "Riz Poli Nat    " , "Riso Brillato Na" , "Reis Geschael   " ,  13887 ,    0.0000E+0 ,    0.0000E+0 ,    2.6371E-1 ,   -1.0159E+1 ,   5 ,  30 ,  142 ,    2.9700E-18 ,   -1.0300E-1 },
-    { "Arroz Beneficiad" , "Arroz Benefic.  " , "Processed Rice  " , "Riz Traite      " , "Riso Lavorato   " , "Verarbeit. Reis " ,     68 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Arroz Br Agulha " , "Arroz Bl Aguja  " , "White Needle Rice" , "Riz Blanc Aigu." , "Riso Bianco Ago " , "Weiber Nadelreis" ,    176 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Arroz Br Agulhin" , "Arroz Bl Agujin " , "Wh Needle Rice S" , "Riz Blanc Aig S " , "Riso Bianco Ag S" , "Weiber Nadel. S " ,    175 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Arroz Br Redondo" , "Arroz Bl Redondo" , "White Round Rice" , "Riz Blanc Rond  " , "Riso Bianco Tond" , "Weiber Rundreis " ,    174 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Arroz Cas Agulha" , "Arroz Cas Aguja " , "Needle Paddy Rice" , "Riz Paddy Aigu. " , "Risone Ago      " , "Nadel Rohreis   " ,    179 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Arroz Casc Agulh" , "Arroz Cas Agujin" , "Needle Paddy R S" , "Riz Paddy Aig S " , "Risone Ago S    " , "Nadel Rohreis S " ,    178 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Arroz Casc Redon" , "Arroz Cas Redond" , "Round Paddy Rice" , "Riz Paddy Rond  " , "Risone Tondo    " , "Rund Rohreis    " ,    177 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Arroz Casca Long" , "Arroz Cascara Lg" , "Long Paddy Rice " , "Riz Paddy Long  " , "Risone Lungo    " , "Langer Rohreis  " ,   1789 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Arroz Casca Natu" , "Arroz Cascara   " , "Rice Rough      " , "Riz Paddy       " , "Riso Paddy      " , "Reis Roh        " ,  13882 ,    1.2274E-5 ,   -4.9907E-3 ,    7.3407E-1 ,   -1.7561E+1 ,   7 ,  30 ,  142 ,   -7.1218E-5 ,   -7.0377E-2 },
-    { "Arroz Casca Parb" , "Arroz Casc Parb " , "Parboiled Paddy " , "Riz Paddy Etuve " , "Risone Parboiled" , "Parboiled Rohreis" ,  13790 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Arroz Cateto BEN" , "Arroz Cateto    " , "Cateto Rice     " , "Riz Cateto      " , "Riso Cateto     " , "Cateto Reis     " ,  13854 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   9 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Arroz Inte Parb " , "Arroz Int Parb  " , "Brown Parb. Rice" , "Riz Complet Etuv" , "Riso Int. Parb. " , "Brauner Parb Reis" ,  13870 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,  10 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Arroz Quirera   " , "Arroz Quebrado  " , "Broken Rice     " , "Brisures de Riz " , "Riso Spezzato   " , "Bruchreis       " ,  13880 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Aveia           " , "Avena           " , "Oats            " , "Avoine          " , "Avena           " , "Hafer           " ,  13782 ,    0.0000E+0 ,    0.0000E+0 ,    2.1000E-1 ,   -1.7400E+0 ,   6 ,  22 ,  142 ,    1.1900E-18 ,   -9.8800E-2 },
-    { "Aveia Casca     " , "Avena c/Cascara " , "Oats with Husk  " , "Avoine c/Envel. " , "Avena c/Bucce   " , "Hafer mit Schale" ,    121 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  35 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Aveia Casca 85g " , "Avena c/Casc 85g" , "Oats w/Husk 85g " , "Avoine c/Env 85g" , "Avena c/Buc 85g " , "Hafer m/Sch 85g " ,  13840 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  35 ,   85 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Aveia Casca Negr" , "Avena Casc Negra" , "Black Oats Husk " , "Avoine Noire Env" , "Avena Nera Bucce" , "Schwarzer Hafer " ,  13841 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  35 ,   85 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Aveia Cortada   " , "Avena Cortada   " , "Steel Cut Oats  " , "Avoine Concassee" , "Avena Tagliata  " , "Geschnitt. Hafer" ,  13848 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  150 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Aveia Floco Gros" , "Avena Hojuela Gr" , "Rolled Oats Thk " , "Flocons d'Avoine" , "Fiocchi d'Avena " , "Haferflocken Gr." ,  13800 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  15 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Aveia Flocos Fin" , "Avena Hojuela Fn" , "Rolled Oats Thn " , "Flocons Avoine F" , "Fiocchi Avena F " , "Haferflocken Fn." ,  13849 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  100 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Aveia Flocos Reg" , "Avena Hojuela Rg" , "Rolled Oats Reg " , "Flocons Avoine R" , "Fiocchi Avena R " , "Haferflocken Rg." ,  13850 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,   90 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Aveia Laminada  " , "Avena Laminada  " , "Flaked Oats     " , "Avoine Laminee  " , "Avena Laminata  " , "Gewalzte Hafer  " ,  13801 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  15 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Azevem          " , "Ryegrass        " , "Ryegrass        " , "Ray-grass       " , "Loietto         " , "Weidelgras      " ,  13864 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  25 ,   57 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Cacau 100g      " , "Cacao 100g      " , "Cocoa 100g      " , "Cacao 100g      " , "Cacao 100g      " , "Kakao 100g      " ,  13871 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   4 ,  22 ,  100 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Cacau 142g      " , "Cacao 142g      " , "Cocoa 142g      " , "Cacao 142g      " , "Cacao 142g      " , "Kakao 142g      " ,  12745 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   8 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Cafe            " , "Cafe            " , "Coffee          " , "Cafe            " , "Caffe           " , "Kaffee          " ,   9731 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   9 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Cafe em Coco    " , "Cafe en Coco    " , "Coffee Cherry   " , "Cafe en Cerise  " , "Caffe Ciliegia  " , "Kaffeekirsche   " ,  13873 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,  20 ,  50 ,  113 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Cafe ISO6673    " , "Cafe ISO6673    " , "Coffee ISO6673  " , "Cafe ISO6673    " , "Caffe ISO6673   " , "Kaffee ISO6673  " ,  13774 ,    6.7850E-6 ,   -2.3010E-3 ,    3.2860E-1 ,   -1.8190E+0 ,   7 ,  25 ,  142 ,   -1.3916E-2 ,    3.8932E-2 },
-    { "Cafe Oro        " , "Cafe Oro        " , "Green Coffee    " , "Cafe Vert       " , "Caffe Verde     " , "Rohkaffee       " ,  13802 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  35 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Cafe Pergamino  " , "Cafe Pergamino  " , "Parchment Coffee" , "Cafe Parchemin  " , "Caffe Pergamena " , "Pergamentkaffee " ,  13876 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  55 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Cafe Torrado 85g" , "Cafe Tostado 85g" , "Roasted Coffee  " , "Cafe Torrefie   " , "Caffe Tostato   " , "Gerosteter Kaffe" ,  13845 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  15 ,   85 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Canola          " , "Canola          " , "Canola          " , "Canola          " , "Canola          " , "Raps            " ,  13844 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Capim Ruziziensi" , "Pasto Ruziziensi" , "Ruziziensis Grass" , "Herbe Ruziziensi" , "Erba Ruziziensis" , "Ruziziensis Gras" ,  13866 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  25 ,   57 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Casca De Cafe   " , "Cascara de Cafe " , "Coffee Husk     " , "Coque de Cafe   " , "Bucce di Caffe  " , "Kaffeeschale    " ,  13863 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   3 ,  30 ,   57 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Cast Caju Benef " , "Anacardo Proces." , "Processed Cashew" , "Noix Cajou Trai." , "Anacardio Lav.  " , "Verarb. Cashew  " ,  13836 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   1 ,  15 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Castanha Para   " , "Nuez de Brasil  " , "Brazil Nut      " , "Noix du Bresil  " , "Noce del Brasile" , "Paranuss        " ,  13821 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  15 ,  120 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Centeio         " , "Centeno         " , "Rye             " , "Seigle          " , "Segale          " , "Roggen          " ,  13803 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  40 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Centeio Flocos  " , "Centeno Hojuelas" , "Rye Flakes      " , "Flocons de Seigle" , "Fiocchi Segale  " , "Roggenflocken   " ,  13804 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  15 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Cevada          " , "Cebada          " , "Barley          " , "Orge            " , "Orzo            " , "Gerste          " ,  13884 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   9 ,  35 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Cevada Seca Esp " , "Cebada Seca Esp " , "Dried Barley Sp " , "Orge Sechee Sp  " , "Orzo Secco Sp   " , "Getr. Gerste Sp " ,   6982 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  22 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Chia            " , "Chia            " , "Chia            " , "Chia            " , "Chia            " , "Chia            " ,  13805 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  15 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Coentro 75g     " , "Cilantro 75g    " , "Coriander 75g   " , "Coriandre 75g   " , "Coriandolo 75g  " , "Koriander 75g   " ,  13822 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  20 ,   75 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Colza           " , "Colza           " , "Rapeseed        " , "Colza           " , "Colza           " , "Raps            " ,   7879 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Colza           " , "Colza           " , "Rapeseed        " , "Colza           " , "Colza           " , "Raps            " ,  13806 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  17 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Crambe          " , "Crambe          " , "Crambe          " , "Crambe          " , "Crambe          " , "Crambe          " ,  13832 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   4 ,  20 ,  113 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Cravo da India  " , "Clavo de Olor   " , "Clove           " , "Clou de Girofle " , "Chiodo Garofano " , "Nelke           " ,  13819 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,  10 ,  25 ,   80 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Crotalaria      " , "Crotalaria      " , "Crotalaria      " , "Crotalaria      " , "Crotalaria      " , "Crotalaria      " ,  13843 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  20 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "DDG Dried Grain " , "DDG             " , "DDG             " , "DDG             " , "DDG             " , "DDG             " ,  13881 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  15 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Ervilha         " , "Guisante        " , "Pea             " , "Pois            " , "Pisello         " , "Erbse           " ,  13783 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  20 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Farelo Amendoim " , "Harina de Mani  " , "Peanut Meal     " , "Farine d'Arachi." , "Farina Arachidi " , "Erdnussmehl     " ,  13778 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   1 ,  15 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Farelo Canola   " , "Harina de Canola" , "Canola Meal     " , "Farine de Canola" , "Farina di Canola" , "Rapsmehl        " ,  13838 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   8 ,  18 ,  105 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Farelo de Citrus" , "Harina de Citric" , "Citrus Pulp     " , "Pulpe d'Agrumes " , "Polpa di Agrumi " , "Zitrustrester   " ,  13780 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   8 ,  16 ,   80 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Farelo de Soja  " , "Harina de Soja  " , "Soybeans Meal   " , "Soja Miette     " , "Farina de Soya  " , "Soja Mehl       " ,  13888 ,    3.1217E-6 ,   -1.1030E-3 ,    1.9666E-1 ,    3.6993E+0 ,   6 ,  24 ,  142 ,   -3.8160E-2 ,    3.5947E-1 },
-    { "Farelo Girassol " , "Harina Girasol  " , "Sunflower Meal  " , "Farine Tournesol" , "Farina Girasole " , "Sonnenblumenmehl" ,  13837 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  19 ,   72 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Farelo Soja Intg" , "Harina Soja Intg" , "Soybean Meal Int" , "Soja Miette Int " , "Farina Soya Int " , "Soja Mehl Int   " ,  13889 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  24 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Farelo Sorgo    " , "Harina de Sorgo " , "Sorghum Meal    " , "Farine de Sorgho" , "Farina di Sorgo " , "Sorghummehl     " ,  13779 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   8 ,  20 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Feijao Anao     " , "Frijol Enano    " , "Dwarf Bean      " , "Haricot Nain    " , "Fagiolo Nano    " , "Zwergbohne      " ,  13823 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,  10 ,  25 ,  165 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Feijao Azuki    " , "Frijol Azuki    " , "Azuki Bean      " , "Haricot Azuki   " , "Fagiolo Azuki   " , "Azukibohne      " ,  13855 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   8 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Feijao Bolinha  " , "Frijol Bola     " , "Ball Bean       " , "Haricot Boule   " , "Fagiolo Palla   " , "Kugelbohne      " ,  13792 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  35 ,  184 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Feijao Branco   " , "Frijol Blanco   " , "White Bean      " , "Haricot Blanc   " , "Fagiolo Bianco  " , "Weibe Bohne     " ,  13793 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  35 ,  175 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Feijao Carioca  " , "Frijol Pinto    " , "Beans Pinto     " , "Haricot Pinto   " , "Fagioli Borlotti" , "Pinto Bohnen    " ,  13868 ,    5.1768E-6 ,   -1.7355E-3 ,    2.7117E-1 ,   -1.8416E+0 ,   5 ,  35 ,  170 ,   -1.4880E-3 ,   -7.5168E-2 },
-    { "Feijao Coruja   " , "Frijol Coruja   " , "Owl Bean        " , "Haricot Chouette" , "Fagiolo Gufo    " , "Eulenbohne      " ,  13784 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Feijao Fradinho " , "Frijol Fradinho " , "Black-eyed Pea  " , "Pois a Vache    " , "Fagiolo dall'Oc." , "Augenbohne      " ,  13794 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  35 ,  165 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Feijao Guandu   " , "Frijol Guandul  " , "Pigeon Pea      " , "Pois d'Angole   " , "Cajanus cajan   " , "Straucherbse    " ,  14071 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  20 ,  165 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Feijao Jalo     " , "Frijol Jalo     " , "Jalo Bean       " , "Haricot Jalo    " , "Fagiolo Jalo    " , "Jalo-Bohne      " ,  13795 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  25 ,  165 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Feijao Macassar " , "Frijol Macassar " , "Macassar Bean   " , "Haricot Macassar" , "Fagiolo Macassar" , "Macassar-Bohne  " ,  13796 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,  10 ,  25 ,  161 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Feijao Mungo Ver" , "Frijol Mungo    " , "Mung Bean       " , "Haricot Mungo   " , "Fagiolo Mungo   " , "Mungbohne       " ,  13877 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   8 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Feijao Perola   " , "Frijol Perla    " , "Pearl Bean      " , "Haricot Perle   " , "Fagiolo Perla   " , "Perlbohne       " ,  13842 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   9 ,  40 ,  157 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Feijao PingoOuro" , "Frijol Gota de O" , "Gold Drop Bean  " , "Haricot Goutte O" , "Fagiolo Goccia O" , "Goldtropfenbohne" ,  13785 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Feijao Preto    " , "Frijol Negro    " , "Black Bean      " , "Haricot Noir    " , "Fagiolo Nero    " , "Schwarze Bohne  " ,  13890 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   8 ,  35 ,  165 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Feijao Rajado   " , "Frijol Rayado   " , "Striped Bean    " , "Haricot Raye    " , "Fagiolo Striato " , "Gestreifte Bohne" ,  13833 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  35 ,  170 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Feijao Rosinha  " , "Frijol Rosado   " , "Pink Bean       " , "Haricot Rose    " , "Fagiolo Rosa    " , "Rosa Bohne      " ,  13797 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  30 ,  183 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Feijao Roxo     " , "Frijol Rojo     " , "Purple Bean     " , "Haricot Violet  " , "Fagiolo Viola   " , "Lila Bohne      " ,  13798 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  30 ,  180 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Fermento Instant" , "Levadura Instant" , "Instant Yeast   " , "Levure Instant. " , "Lievito Istant. " , "Instant-Hefe    " ,  13835 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  16 ,  117 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Gergelim Branco " , "Sesamo Blanco   " , "White Sesame    " , "Sesame Blanc    " , "Sesamo Bianco   " , "Weiber Sesam    " ,  13856 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  16 ,  117 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Gergelim Despel." , "Sesamo sin Piel " , "Hulled Sesame   " , "Sesame Decortiq." , "Sesamo Decortic." , "Geschalter Sesam" ,  13857 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  15 ,  117 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Gergelim Preto  " , "Sesamo Negro    " , "Black Sesame    " , "Sesame Noir     " , "Sesamo Nero     " , "Schwarzer Sesam " ,  13846 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  15 ,  117 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Gergelim Tostado" , "Sesamo Tostado  " , "Toasted Sesame  " , "Sesame Grille   " , "Sesamo Tostato  " , "Gerosteter Sesam" ,   1826 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  15 ,  117 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Girassol        " , "Girasol         " , "Sunflower       " , "Tournesol       " , "Girasole        " , "Sonnenblume     " ,  13824 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  25 ,   75 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Girassol Descas." , "Girasol s/Casc. " , "Hulled Sunflower" , "Tournesol Decort" , "Girasole Sgusci." , "Geschalte Sonnen" ,  13847 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   3 ,  15 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Grao de Bico    " , "Garbanzo        " , "Chickpea        " , "Pois Chiche     " , "Cece            " , "Kichererbse     " ,  13867 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  35 ,  175 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Guarana Descasc." , "Guarana s/Casc. " , "Hulled Guarana  " , "Guarana Decort. " , "Guarana Sgusci. " , "Geschalte Guaran" ,  13807 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Lentilha        " , "Lenteja         " , "Lentil          " , "Lentille        " , "Lenticchia      " , "Linse           " ,  13808 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Linhaca Marrom  " , "Linaza Marron   " , "Brown Flaxseed  " , "Graines Lin Brun" , "Semi Lino Marro." , "Brauner Leinsam." ,  13809 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  18 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Linho           " , "Lino            " , "Flax            " , "Lin             " , "Lino            " , "Flachs          " ,  13786 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  17 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Macadamia       " , "Macadamia       " , "Macadamia       " , "Macadamia       " , "Macadamia       " , "Macadamia       " ,  13810 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   1 ,  40 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Malte Cevada    " , "Malta de Cebada " , "Barley Malt     " , "Malt d'Orge     " , "Malto d'Orzo    " , "Gerstenmalz     " ,  13885 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  20 ,  120 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Mamona          " , "Ricino          " , "Castor Bean     " , "Ricin           " , "Ricino          " , "Rizinus         " ,  13811 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   4 ,  18 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Milheto         " , "Mijo Perla      " , "Pearl Millet    " , "Mil Perle       " , "Miglio Perlato  " , "Perlhirse       " ,  13825 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  40 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Milho           " , "Maiz            " , "Corn            " , "Mais            " , "Mais            " , "Mais            " ,  13891 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  45 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Milho Alta      " , "Maiz Alta       " , "High Moist Corn " , "Mais Humide     " , "Mais Umido      " , "Feuchtmais      " ,  13781 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,  40 ,  70 ,  100 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Milho Canjica   " , "Maiz Canjica    " , "Hominy Corn     " , "Mais Hominy     " , "Mais Hominy     " , "Hominy-Mais     " ,  13826 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  50 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Milho Flocos    " , "Maiz Hojuelas   " , "Corn Flakes     " , "Flocons de Mais " , "Fiocchi di Mais " , "Cornflakes      " ,  13874 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   9 ,  20 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Milho Gritz     " , "Maiz Gritz      " , "Corn Grits      " , "Gruau de Mais   " , "Grana di Mais   " , "Maisgrieb       " ,  13818 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   4 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Milho Milharina " , "Maiz Harina     " , "Corn Flour      " , "Farine de Mais  " , "Farina di Mais  " , "Maismehl        " ,  13851 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Milho Pipoca    " , "Maiz Pisingallo " , "Popcorn         " , "Mais a Eclater  " , "Mais da Popcorn " , "Popcorn-Mais    " ,  13812 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  35 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Milho Polentina " , "Maiz Polenta    " , "Polenta Corn    " , "Mais Polenta    " , "Mais Polenta    " , "Polenta-Mais    " ,  13852 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  22 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Milho Semente   " , "Maiz Semilla    " , "Seed Corn       " , "Semence de Mais " , "Seme di Mais    " , "Saatmais        " ,  13776 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  45 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Mostarda Amarela" , "Mostaza Amarilla" , "Yellow Mustard  " , "Moutarde Jaune  " , "Senape Gialla   " , "Gelbsenf        " ,  13791 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Pellt Casca Soja" , "Pellet Casc Soja" , "Soybean Hulls Pl" , "Pellet Coq Soja " , "Pellet Bucce Soi" , "Sojaschalenpell." ,  13879 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  24 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Pimenta do Reino" , "Pimienta Negra  " , "Black Pepper    " , "Poivre Noir     " , "Pepe Nero       " , "Schwarzer Pfeffe" ,  13865 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Pinhao Manso    " , "Pinon Manso     " , "Physic Nut      " , "Pignon d'Inde   " , "Jatropha curcas " , "Purgiernuss     " ,  13813 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  35 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Quinoa Branca   " , "Quinoa Blanca   " , "White Quinoa    " , "Quinoa Blanc    " , "Quinoa Bianca   " , "Weibe Quinoa    " ,  13862 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  21 ,  170 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Quinoa Preta    " , "Quinoa Negra    " , "Black Quinoa    " , "Quinoa Noir     " , "Quinoa Nera     " , "Schwarze Quinoa " ,  13860 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  21 ,  170 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Quinoa Vermelha " , "Quinoa Roja     " , "Red Quinoa      " , "Quinoa Rouge    " , "Quinoa Rossa    " , "Rote Quinoa     " ,  13861 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  21 ,  170 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Sem. Algodao Des" , "Sem. Algodon Des" , "Cottonseed Delin" , "Graine Coton Del" , "Seme Cotone Del " , "Baumwollsamen D " ,  13827 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  22 ,  128 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Sem. Alpiste    " , "Semilla Alpiste " , "Canary Seed     " , "Graine d'Alpiste" , "Seme di Scagliol" , "Kanariensaat    " ,  13828 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  50 ,  160 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Sem. Cebola     " , "Semilla Cebolla " , "Onion Seed      " , "Graine d'Oignon " , "Seme di Cipolla " , "Zwiebelsamen    " ,  13872 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   3 ,  15 ,  113 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Sem. Cumaru     " , "Semilla Cumaru  " , "Tonka Bean      " , "Feve de Tonka   " , "Fava di Tonka   " , "Tonkabohne      " ,  13875 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   4 ,  32 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Sem. Nabo Forra." , "Sem. Nabo Forraj" , "Forage Turnip Sd" , "Graine Navet Fou" , "Seme Rapa Forag." , "Futterrubensamen" ,  13815 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  15 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Sem. Niger      " , "Semilla Niger   " , "Niger Seed      " , "Graine de Niger " , "Seme di Niger   " , "Nigersaat       " ,  13829 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  50 ,  124 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Sem. Painco     " , "Semilla Mijo    " , "Millet Seed     " , "Graine de Millet" , "Seme di Miglio  " , "Hirse Samen     " ,  13830 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  50 ,  151 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Sem. Pe Galinha " , "Sem. Pata Gallin" , "Goosegrass Seed " , "Graine Eleusine " , "Seme Eleusine   " , "Eleusine Samen  " ,  13831 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  50 ,  166 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Sem. Senha      " , "Sem. Senha      " , "Barnyard Grass  " , "Graine Panicum  " , "Seme Giavone    " , "Huhnerhirse     " ,  13814 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   9 ,  20 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Soja            " , "Soja            " , "Soybean         " , "Soja            " , "Soia            " , "Sojabohne       " ,  13892 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  50 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Soja Massa Expad" , "Soja Masa Exp.  " , "Expanded Soy    " , "Soja Expanse    " , "Soia Espansa    " , "Expandiertes Soj" ,  13955 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  15 ,  113 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Soja Semente    " , "Soja Semilla    " , "Soybean Seed    " , "Semence de Soja " , "Seme di Soia    " , "Sojasaatgut     " ,  13859 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  15 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Sorgo           " , "Sorgo           " , "Sorghum         " , "Sorgho          " , "Sorgo           " , "Sorghum         " ,  13834 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  40 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Trigo           " , "Trigo           " , "Wheat           " , "Ble             " , "Grano           " , "Weizen          " ,  13883 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  40 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Trigo Branco    " , "Trigo Blanco    " , "White Wheat     " , "Ble Blanc       " , "Grano Bianco    " , "Weiber Weizen   " ,  13787 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  40 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Trigo Duro      " , "Trigo Duro      " , "Durum Wheat     " , "Ble Dur         " , "Grano Duro      " , "Hartweizen      " ,  13878 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  40 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Trigo Flocos    " , "Trigo Hojuelas  " , "Wheat Flakes    " , "Flocons de Ble  " , "Fiocchi di Grano" , "Weizenflocken   " ,  13799 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Trigo Sarraceno " , "Trigo Sarraceno " , "Buckwheat       " , "Sarrasin        " , "Grano Saraceno  " , "Buchweizen      " ,  13839 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,  10 ,  35 ,  100 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Trigo Vermelho  " , "Trigo Rojo      " , "Red Wheat       " , "Ble Rouge       " , "Grano Rosso     " , "Roter Weizen    " ,  13788 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  40 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Triticale       " , "Triticale       " , "Triticale       " , "Triticale       " , "Triticale       " , "Triticale       " ,  13789 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  33 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "Urucum          " , "Achiote         " , "Annatto         " , "Roucou          " , "Annatto         " , "Annatto         " ,  13816 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
-    { "WAXY            " , "WAXY            " , "WAXY            " , "WAXY            " , "WAXY            " , "WAXY            " ,   9946 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  40 ,  142 ,    0.0000E+0 ,    0.0000E+0 },
+    { "Amaranto        " , "Amaranto        " , "Amaranth        " , "Amarante        " , "Amaranto        " , "Amarant         " ,  13853 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   9 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Amendoa Nat 100g" , "Almendra Natural" , "Almond Natural  " , "Amande Naturelle" , "Mandorla Natur." , "Mandel Naturlich" ,  13820 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   3 ,  30 ,  100 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Amendoa Nat Aus " , "Almendra Nat Aus" , "Almond Nat Aus  " , "Amande Nat Aus  " , "Mandorla N. Aus " , "Mandel Nat Aus  " ,   1217 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   3 ,  30 ,  100 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Amendoim        " , "Mani            " , "Runner Peanuts  " , "Cacahuetes      " , "Arachidi        " , "Erdneusse Gesch " ,  13817 ,    3.0600E-6 ,   -1.1300E-3 ,    1.9200E-1 ,    9.6000E-1 ,   1 ,  30 ,  142 ,    0.0000E+0 ,   -1.0000E-1 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Amendoim Torrado" , "Mani Tostado    " , "Roasted Peanuts " , "Cacahuetes Gril." , "Arachidi Tostate" , "Gerostete Erdnu." ,  13773 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   0 ,  10 ,  150 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Arroz Bene Inte " , "Arroz Integral  " , "Brown Rice      " , "Riz Complet     " , "Riso Integrale  " , "Brauner Reis    " ,  13886 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Arroz Bene Parb " , "Arroz Parboiled " , "Parboiled Rice  " , "Riz Etuve       " , "Riso Parboiled  " , "Parboiled Reis  " ,  13869 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Arroz Bene Poli " , "Arroz Pulido    " , "Rice Polished Na" , "Riz Poli Nat    " , "Riso Brillato Na" , "Reis Geschael   " ,  13887 ,    0.0000E+0 ,    0.0000E+0 ,    2.6371E-1 ,   -1.0159E+1 ,   5 ,  30 ,  142 ,    2.9700E-18 ,   -1.0300E-1 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Arroz Beneficiad" , "Arroz Benefic.  " , "Processed Rice  " , "Riz Traite      " , "Riso Lavorato   " , "Verarbeit. Reis " ,     68 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Arroz Br Agulha " , "Arroz Bl Aguja  " , "White Needle Rice" , "Riz Blanc Aigu." , "Riso Bianco Ago " , "Weiber Nadelreis" ,    176 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Arroz Br Agulhin" , "Arroz Bl Agujin " , "Wh Needle Rice S" , "Riz Blanc Aig S " , "Riso Bianco Ag S" , "Weiber Nadel. S " ,    175 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Arroz Br Redondo" , "Arroz Bl Redondo" , "White Round Rice" , "Riz Blanc Rond  " , "Riso Bianco Tond" , "Weiber Rundreis " ,    174 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Arroz Cas Agulha" , "Arroz Cas Aguja " , "Needle Paddy Rice" , "Riz Paddy Aigu. " , "Risone Ago      " , "Nadel Rohreis   " ,    179 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Arroz Casc Agulh" , "Arroz Cas Agujin" , "Needle Paddy R S" , "Riz Paddy Aig S " , "Risone Ago S    " , "Nadel Rohreis S " ,    178 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Arroz Casc Redon" , "Arroz Cas Redond" , "Round Paddy Rice" , "Riz Paddy Rond  " , "Risone Tondo    " , "Rund Rohreis    " ,    177 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Arroz Casca Long" , "Arroz Cascara Lg" , "Long Paddy Rice " , "Riz Paddy Long  " , "Risone Lungo    " , "Langer Rohreis  " ,   1789 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Arroz Casca Natu" , "Arroz Cascara   " , "Rice Rough      " , "Riz Paddy       " , "Riso Paddy      " , "Reis Roh        " ,  13882 ,    1.2274E-5 ,   -4.9907E-3 ,    7.3407E-1 ,   -1.7561E+1 ,   7 ,  30 ,  142 ,   -7.1218E-5 ,   -7.0377E-2 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Arroz Casca Parb" , "Arroz Casc Parb " , "Parboiled Paddy " , "Riz Paddy Etuve " , "Risone Parboiled" , "Parboiled Rohreis" ,  13790 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Arroz Cateto BEN" , "Arroz Cateto    " , "Cateto Rice     " , "Riz Cateto      " , "Riso Cateto     " , "Cateto Reis     " ,  13854 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   9 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Arroz Inte Parb " , "Arroz Int Parb  " , "Brown Parb. Rice" , "Riz Complet Etuv" , "Riso Int. Parb. " , "Brauner Parb Reis" ,  13870 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,  10 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Arroz Quirera   " , "Arroz Quebrado  " , "Broken Rice     " , "Brisures de Riz " , "Riso Spezzato   " , "Bruchreis       " ,  13880 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Aveia           " , "Avena           " , "Oats            " , "Avoine          " , "Avena           " , "Hafer           " ,  13782 ,    0.0000E+0 ,    0.0000E+0 ,    2.1000E-1 ,   -1.7400E+0 ,   6 ,  22 ,  142 ,    1.1900E-18 ,   -9.8800E-2 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Aveia Casca     " , "Avena c/Cascara " , "Oats with Husk  " , "Avoine c/Envel. " , "Avena c/Bucce   " , "Hafer mit Schale" ,    121 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  35 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Aveia Casca 85g " , "Avena c/Casc 85g" , "Oats w/Husk 85g " , "Avoine c/Env 85g" , "Avena c/Buc 85g " , "Hafer m/Sch 85g " ,  13840 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  35 ,   85 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Aveia Casca Negr" , "Avena Casc Negra" , "Black Oats Husk " , "Avoine Noire Env" , "Avena Nera Bucce" , "Schwarzer Hafer " ,  13841 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  35 ,   85 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Aveia Cortada   " , "Avena Cortada   " , "Steel Cut Oats  " , "Avoine Concassee" , "Avena Tagliata  " , "Geschnitt. Hafer" ,  13848 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  150 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Aveia Floco Gros" , "Avena Hojuela Gr" , "Rolled Oats Thk " , "Flocons d'Avoine" , "Fiocchi d'Avena " , "Haferflocken Gr." ,  13800 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  15 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Aveia Flocos Fin" , "Avena Hojuela Fn" , "Rolled Oats Thn " , "Flocons Avoine F" , "Fiocchi Avena F " , "Haferflocken Fn." ,  13849 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  100 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Aveia Flocos Reg" , "Avena Hojuela Rg" , "Rolled Oats Reg " , "Flocons Avoine R" , "Fiocchi Avena R " , "Haferflocken Rg." ,  13850 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,   90 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Aveia Laminada  " , "Avena Laminada  " , "Flaked Oats     " , "Avoine Laminee  " , "Avena Laminata  " , "Gewalzte Hafer  " ,  13801 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  15 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Azevem          " , "Ryegrass        " , "Ryegrass        " , "Ray-grass       " , "Loietto         " , "Weidelgras      " ,  13864 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  25 ,   57 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Cacau 100g      " , "Cacao 100g      " , "Cocoa 100g      " , "Cacao 100g      " , "Cacao 100g      " , "Kakao 100g      " ,  13871 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   4 ,  22 ,  100 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Cacau 142g      " , "Cacao 142g      " , "Cocoa 142g      " , "Cacao 142g      " , "Cacao 142g      " , "Kakao 142g      " ,  12745 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   8 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Cafe            " , "Cafe            " , "Coffee          " , "Cafe            " , "Caffe           " , "Kaffee          " ,   9731 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   9 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Cafe em Coco    " , "Cafe en Coco    " , "Coffee Cherry   " , "Cafe en Cerise  " , "Caffe Ciliegia  " , "Kaffeekirsche   " ,  13873 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,  20 ,  50 ,  113 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Cafe ISO6673    " , "Cafe ISO6673    " , "Coffee ISO6673  " , "Cafe ISO6673    " , "Caffe ISO6673   " , "Kaffee ISO6673  " ,  13774 ,    6.7850E-6 ,   -2.3010E-3 ,    3.2860E-1 ,   -1.8190E+0 ,   7 ,  25 ,  142 ,   -1.3916E-2 ,    3.8932E-2 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Cafe Oro        " , "Cafe Oro        " , "Green Coffee    " , "Cafe Vert       " , "Caffe Verde     " , "Rohkaffee       " ,  13802 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  35 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Cafe Pergamino  " , "Cafe Pergamino  " , "Parchment Coffee" , "Cafe Parchemin  " , "Caffe Pergamena " , "Pergamentkaffee " ,  13876 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  55 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Cafe Torrado 85g" , "Cafe Tostado 85g" , "Roasted Coffee  " , "Cafe Torrefie   " , "Caffe Tostato   " , "Gerosteter Kaffe" ,  13845 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  15 ,   85 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Canola          " , "Canola          " , "Canola          " , "Canola          " , "Canola          " , "Raps            " ,  13844 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Capim Ruziziensi" , "Pasto Ruziziensi" , "Ruziziensis Grass" , "Herbe Ruziziensi" , "Erba Ruziziensis" , "Ruziziensis Gras" ,  13866 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  25 ,   57 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Casca De Cafe   " , "Cascara de Cafe " , "Coffee Husk     " , "Coque de Cafe   " , "Bucce di Caffe  " , "Kaffeeschale    " ,  13863 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   3 ,  30 ,   57 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Cast Caju Benef " , "Anacardo Proces." , "Processed Cashew" , "Noix Cajou Trai." , "Anacardio Lav.  " , "Verarb. Cashew  " ,  13836 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   1 ,  15 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Castanha Para   " , "Nuez de Brasil  " , "Brazil Nut      " , "Noix du Bresil  " , "Noce del Brasile" , "Paranuss        " ,  13821 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  15 ,  120 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Centeio         " , "Centeno         " , "Rye             " , "Seigle          " , "Segale          " , "Roggen          " ,  13803 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  40 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Centeio Flocos  " , "Centeno Hojuelas" , "Rye Flakes      " , "Flocons de Seigle" , "Fiocchi Segale  " , "Roggenflocken   " ,  13804 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  15 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Cevada          " , "Cebada          " , "Barley          " , "Orge            " , "Orzo            " , "Gerste          " ,  13884 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   9 ,  35 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Cevada Seca Esp " , "Cebada Seca Esp " , "Dried Barley Sp " , "Orge Sechee Sp  " , "Orzo Secco Sp   " , "Getr. Gerste Sp " ,   6982 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  22 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Chia            " , "Chia            " , "Chia            " , "Chia            " , "Chia            " , "Chia            " ,  13805 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  15 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Coentro 75g     " , "Cilantro 75g    " , "Coriander 75g   " , "Coriandre 75g   " , "Coriandolo 75g  " , "Koriander 75g   " ,  13822 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  20 ,   75 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Colza           " , "Colza           " , "Rapeseed        " , "Colza           " , "Colza           " , "Raps            " ,   7879 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Colza           " , "Colza           " , "Rapeseed        " , "Colza           " , "Colza           " , "Raps            " ,  13806 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  17 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Crambe          " , "Crambe          " , "Crambe          " , "Crambe          " , "Crambe          " , "Crambe          " ,  13832 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   4 ,  20 ,  113 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Cravo da India  " , "Clavo de Olor   " , "Clove           " , "Clou de Girofle " , "Chiodo Garofano " , "Nelke           " ,  13819 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,  10 ,  25 ,   80 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Crotalaria      " , "Crotalaria      " , "Crotalaria      " , "Crotalaria      " , "Crotalaria      " , "Crotalaria      " ,  13843 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  20 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "DDG Dried Grain " , "DDG             " , "DDG             " , "DDG             " , "DDG             " , "DDG             " ,  13881 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  15 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Ervilha         " , "Guisante        " , "Pea             " , "Pois            " , "Pisello         " , "Erbse           " ,  13783 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  20 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Farelo Amendoim " , "Harina de Mani  " , "Peanut Meal     " , "Farine d'Arachi." , "Farina Arachidi " , "Erdnussmehl     " ,  13778 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   1 ,  15 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Farelo Canola   " , "Harina de Canola" , "Canola Meal     " , "Farine de Canola" , "Farina di Canola" , "Rapsmehl        " ,  13838 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   8 ,  18 ,  105 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Farelo de Citrus" , "Harina de Citric" , "Citrus Pulp     " , "Pulpe d'Agrumes " , "Polpa di Agrumi " , "Zitrustrester   " ,  13780 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   8 ,  16 ,   80 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Farelo de Soja  " , "Harina de Soja  " , "Soybeans Meal   " , "Soja Miette     " , "Farina de Soya  " , "Soja Mehl       " ,  13888 ,    3.1217E-6 ,   -1.1030E-3 ,    1.9666E-1 ,    3.6993E+0 ,   6 ,  24 ,  142 ,   -3.8160E-2 ,    3.5947E-1 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Farelo Girassol " , "Harina Girasol  " , "Sunflower Meal  " , "Farine Tournesol" , "Farina Girasole " , "Sonnenblumenmehl" ,  13837 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  19 ,   72 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Farelo Soja Intg" , "Harina Soja Intg" , "Soybean Meal Int" , "Soja Miette Int " , "Farina Soya Int " , "Soja Mehl Int   " ,  13889 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  24 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Farelo Sorgo    " , "Harina de Sorgo " , "Sorghum Meal    " , "Farine de Sorgho" , "Farina di Sorgo " , "Sorghummehl     " ,  13779 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   8 ,  20 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Feijao Anao     " , "Frijol Enano    " , "Dwarf Bean      " , "Haricot Nain    " , "Fagiolo Nano    " , "Zwergbohne      " ,  13823 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,  10 ,  25 ,  165 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Feijao Azuki    " , "Frijol Azuki    " , "Azuki Bean      " , "Haricot Azuki   " , "Fagiolo Azuki   " , "Azukibohne      " ,  13855 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   8 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Feijao Bolinha  " , "Frijol Bola     " , "Ball Bean       " , "Haricot Boule   " , "Fagiolo Palla   " , "Kugelbohne      " ,  13792 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  35 ,  184 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Feijao Branco   " , "Frijol Blanco   " , "White Bean      " , "Haricot Blanc   " , "Fagiolo Bianco  " , "Weibe Bohne     " ,  13793 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  35 ,  175 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Feijao Carioca  " , "Frijol Pinto    " , "Beans Pinto     " , "Haricot Pinto   " , "Fagioli Borlotti" , "Pinto Bohnen    " ,  13868 ,    5.1768E-6 ,   -1.7355E-3 ,    2.7117E-1 ,   -1.8416E+0 ,   5 ,  35 ,  170 ,   -1.4880E-3 ,   -7.5168E-2 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Feijao Coruja   " , "Frijol Coruja   " , "Owl Bean        " , "Haricot Chouette" , "Fagiolo Gufo    " , "Eulenbohne      " ,  13784 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Feijao Fradinho " , "Frijol Fradinho " , "Black-eyed Pea  " , "Pois a Vache    " , "Fagiolo dall'Oc." , "Augenbohne      " ,  13794 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  35 ,  165 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Feijao Guandu   " , "Frijol Guandul  " , "Pigeon Pea      " , "Pois d'Angole   " , "Cajanus cajan   " , "Straucherbse    " ,  14071 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  20 ,  165 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Feijao Jalo     " , "Frijol Jalo     " , "Jalo Bean       " , "Haricot Jalo    " , "Fagiolo Jalo    " , "Jalo-Bohne      " ,  13795 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  25 ,  165 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Feijao Macassar " , "Frijol Macassar " , "Macassar Bean   " , "Haricot Macassar" , "Fagiolo Macassar" , "Macassar-Bohne  " ,  13796 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,  10 ,  25 ,  161 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Feijao Mungo Ver" , "Frijol Mungo    " , "Mung Bean       " , "Haricot Mungo   " , "Fagiolo Mungo   " , "Mungbohne       " ,  13877 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   8 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Feijao Perola   " , "Frijol Perla    " , "Pearl Bean      " , "Haricot Perle   " , "Fagiolo Perla   " , "Perlbohne       " ,  13842 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   9 ,  40 ,  157 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Feijao PingoOuro" , "Frijol Gota de O" , "Gold Drop Bean  " , "Haricot Goutte O" , "Fagiolo Goccia O" , "Goldtropfenbohne" ,  13785 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Feijao Preto    " , "Frijol Negro    " , "Black Bean      " , "Haricot Noir    " , "Fagiolo Nero    " , "Schwarze Bohne  " ,  13890 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   8 ,  35 ,  165 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Feijao Rajado   " , "Frijol Rayado   " , "Striped Bean    " , "Haricot Raye    " , "Fagiolo Striato " , "Gestreifte Bohne" ,  13833 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  35 ,  170 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Feijao Rosinha  " , "Frijol Rosado   " , "Pink Bean       " , "Haricot Rose    " , "Fagiolo Rosa    " , "Rosa Bohne      " ,  13797 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  30 ,  183 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Feijao Roxo     " , "Frijol Rojo     " , "Purple Bean     " , "Haricot Violet  " , "Fagiolo Viola   " , "Lila Bohne      " ,  13798 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  30 ,  180 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Fermento Instant" , "Levadura Instant" , "Instant Yeast   " , "Levure Instant. " , "Lievito Istant. " , "Instant-Hefe    " ,  13835 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  16 ,  117 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Gergelim Branco " , "Sesamo Blanco   " , "White Sesame    " , "Sesame Blanc    " , "Sesamo Bianco   " , "Weiber Sesam    " ,  13856 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  16 ,  117 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Gergelim Despel." , "Sesamo sin Piel " , "Hulled Sesame   " , "Sesame Decortiq." , "Sesamo Decortic." , "Geschalter Sesam" ,  13857 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  15 ,  117 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Gergelim Preto  " , "Sesamo Negro    " , "Black Sesame    " , "Sesame Noir     " , "Sesamo Nero     " , "Schwarzer Sesam " ,  13846 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  15 ,  117 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Gergelim Tostado" , "Sesamo Tostado  " , "Toasted Sesame  " , "Sesame Grille   " , "Sesamo Tostato  " , "Gerosteter Sesam" ,   1826 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  15 ,  117 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Girassol        " , "Girasol         " , "Sunflower       " , "Tournesol       " , "Girasole        " , "Sonnenblume     " ,  13824 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  25 ,   75 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Girassol Descas." , "Girasol s/Casc. " , "Hulled Sunflower" , "Tournesol Decort" , "Girasole Sgusci." , "Geschalte Sonnen" ,  13847 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   3 ,  15 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Grao de Bico    " , "Garbanzo        " , "Chickpea        " , "Pois Chiche     " , "Cece            " , "Kichererbse     " ,  13867 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  35 ,  175 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Guarana Descasc." , "Guarana s/Casc. " , "Hulled Guarana  " , "Guarana Decort. " , "Guarana Sgusci. " , "Geschalte Guaran" ,  13807 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Lentilha        " , "Lenteja         " , "Lentil          " , "Lentille        " , "Lenticchia      " , "Linse           " ,  13808 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Linhaca Marrom  " , "Linaza Marron   " , "Brown Flaxseed  " , "Graines Lin Brun" , "Semi Lino Marro." , "Brauner Leinsam." ,  13809 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  18 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Linho           " , "Lino            " , "Flax            " , "Lin             " , "Lino            " , "Flachs          " ,  13786 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  17 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Macadamia       " , "Macadamia       " , "Macadamia       " , "Macadamia       " , "Macadamia       " , "Macadamia       " ,  13810 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   1 ,  40 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Malte Cevada    " , "Malta de Cebada " , "Barley Malt     " , "Malt d'Orge     " , "Malto d'Orzo    " , "Gerstenmalz     " ,  13885 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  20 ,  120 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Mamona          " , "Ricino          " , "Castor Bean     " , "Ricin           " , "Ricino          " , "Rizinus         " ,  13811 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   4 ,  18 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Milheto         " , "Mijo Perla      " , "Pearl Millet    " , "Mil Perle       " , "Miglio Perlato  " , "Perlhirse       " ,  13825 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  40 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Milho           " , "Maiz            " , "Corn            " , "Mais            " , "Mais            " , "Mais            " ,  13891 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  45 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Milho Alta      " , "Maiz Alta       " , "High Moist Corn " , "Mais Humide     " , "Mais Umido      " , "Feuchtmais      " ,  13781 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,  40 ,  70 ,  100 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Milho Canjica   " , "Maiz Canjica    " , "Hominy Corn     " , "Mais Hominy     " , "Mais Hominy     " , "Hominy-Mais     " ,  13826 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  50 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Milho Flocos    " , "Maiz Hojuelas   " , "Corn Flakes     " , "Flocons de Mais " , "Fiocchi di Mais " , "Cornflakes      " ,  13874 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   9 ,  20 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Milho Gritz     " , "Maiz Gritz      " , "Corn Grits      " , "Gruau de Mais   " , "Grana di Mais   " , "Maisgrieb       " ,  13818 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   4 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Milho Milharina " , "Maiz Harina     " , "Corn Flour      " , "Farine de Mais  " , "Farina di Mais  " , "Maismehl        " ,  13851 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Milho Pipoca    " , "Maiz Pisingallo " , "Popcorn         " , "Mais a Eclater  " , "Mais da Popcorn " , "Popcorn-Mais    " ,  13812 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  35 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Milho Polentina " , "Maiz Polenta    " , "Polenta Corn    " , "Mais Polenta    " , "Mais Polenta    " , "Polenta-Mais    " ,  13852 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  22 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Milho Semente   " , "Maiz Semilla    " , "Seed Corn       " , "Semence de Mais " , "Seme di Mais    " , "Saatmais        " ,  13776 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  45 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Mostarda Amarela" , "Mostaza Amarilla" , "Yellow Mustard  " , "Moutarde Jaune  " , "Senape Gialla   " , "Gelbsenf        " ,  13791 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Pellt Casca Soja" , "Pellet Casc Soja" , "Soybean Hulls Pl" , "Pellet Coq Soja " , "Pellet Bucce Soi" , "Sojaschalenpell." ,  13879 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  24 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Pimenta do Reino" , "Pimienta Negra  " , "Black Pepper    " , "Poivre Noir     " , "Pepe Nero       " , "Schwarzer Pfeffe" ,  13865 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Pinhao Manso    " , "Pinon Manso     " , "Physic Nut      " , "Pignon d'Inde   " , "Jatropha curcas " , "Purgiernuss     " ,  13813 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  35 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Quinoa Branca   " , "Quinoa Blanca   " , "White Quinoa    " , "Quinoa Blanc    " , "Quinoa Bianca   " , "Weibe Quinoa    " ,  13862 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  21 ,  170 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Quinoa Preta    " , "Quinoa Negra    " , "Black Quinoa    " , "Quinoa Noir     " , "Quinoa Nera     " , "Schwarze Quinoa " ,  13860 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  21 ,  170 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Quinoa Vermelha " , "Quinoa Roja     " , "Red Quinoa      " , "Quinoa Rouge    " , "Quinoa Rossa    " , "Rote Quinoa     " ,  13861 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  21 ,  170 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Sem. Algodao Des" , "Sem. Algodon Des" , "Cottonseed Delin" , "Graine Coton Del" , "Seme Cotone Del " , "Baumwollsamen D " ,  13827 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   6 ,  22 ,  128 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Sem. Alpiste    " , "Semilla Alpiste " , "Canary Seed     " , "Graine d'Alpiste" , "Seme di Scagliol" , "Kanariensaat    " ,  13828 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  50 ,  160 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Sem. Cebola     " , "Semilla Cebolla " , "Onion Seed      " , "Graine d'Oignon " , "Seme di Cipolla " , "Zwiebelsamen    " ,  13872 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   3 ,  15 ,  113 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Sem. Cumaru     " , "Semilla Cumaru  " , "Tonka Bean      " , "Feve de Tonka   " , "Fava di Tonka   " , "Tonkabohne      " ,  13875 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   4 ,  32 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Sem. Nabo Forra." , "Sem. Nabo Forraj" , "Forage Turnip Sd" , "Graine Navet Fou" , "Seme Rapa Forag." , "Futterrubensamen" ,  13815 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  15 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Sem. Niger      " , "Semilla Niger   " , "Niger Seed      " , "Graine de Niger " , "Seme di Niger   " , "Nigersaat       " ,  13829 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  50 ,  124 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Sem. Painco     " , "Semilla Mijo    " , "Millet Seed     " , "Graine de Millet" , "Seme di Miglio  " , "Hirse Samen     " ,  13830 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  50 ,  151 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Sem. Pe Galinha " , "Sem. Pata Gallin" , "Goosegrass Seed " , "Graine Eleusine " , "Seme Eleusine   " , "Eleusine Samen  " ,  13831 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   2 ,  50 ,  166 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Sem. Senha      " , "Sem. Senha      " , "Barnyard Grass  " , "Graine Panicum  " , "Seme Giavone    " , "Huhnerhirse     " ,  13814 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   9 ,  20 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Soja            " , "Soja            " , "Soybean         " , "Soja            " , "Soia            " , "Sojabohne       " ,  13892 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  50 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Soja Massa Expad" , "Soja Masa Exp.  " , "Expanded Soy    " , "Soja Expanse    " , "Soia Espansa    " , "Expandiertes Soj" ,  13955 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  15 ,  113 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Soja Semente    " , "Soja Semilla    " , "Soybean Seed    " , "Semence de Soja " , "Seme di Soia    " , "Sojasaatgut     " ,  13859 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  15 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_GRAUDO },
+    { "Sorgo           " , "Sorgo           " , "Sorghum         " , "Sorgho          " , "Sorgo           " , "Sorghum         " ,  13834 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  40 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_MEDIO },
+    { "Trigo           " , "Trigo           " , "Wheat           " , "Ble             " , "Grano           " , "Weizen          " ,  13883 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  40 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_MEDIO },
+    { "Trigo Branco    " , "Trigo Blanco    " , "White Wheat     " , "Ble Blanc       " , "Grano Bianco    " , "Weiber Weizen   " ,  13787 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  40 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_MEDIO },
+    { "Trigo Duro      " , "Trigo Duro      " , "Durum Wheat     " , "Ble Dur         " , "Grano Duro      " , "Hartweizen      " ,  13878 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  40 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_MEDIO },
+    { "Trigo Flocos    " , "Trigo Hojuelas  " , "Wheat Flakes    " , "Flocons de Ble  " , "Fiocchi di Grano" , "Weizenflocken   " ,  13799 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  25 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Trigo Sarraceno " , "Trigo Sarraceno " , "Buckwheat       " , "Sarrasin        " , "Grano Saraceno  " , "Buchweizen      " ,  13839 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,  10 ,  35 ,  100 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_MEDIO },
+    { "Trigo Vermelho  " , "Trigo Rojo      " , "Red Wheat       " , "Ble Rouge       " , "Grano Rosso     " , "Roter Weizen    " ,  13788 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  40 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_MEDIO },
+    { "Triticale       " , "Triticale       " , "Triticale       " , "Triticale       " , "Triticale       " , "Triticale       " ,  13789 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   5 ,  33 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "Urucum          " , "Achiote         " , "Annatto         " , "Roucou          " , "Annatto         " , "Annatto         " ,  13816 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  30 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
+    { "WAXY            " , "WAXY            " , "WAXY            " , "WAXY            " , "WAXY            " , "WAXY            " ,   9946 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 ,   7 ,  40 ,  142 ,    0.0000E+0 ,    0.0000E+0 ,    0.0000E+0 , RECEITA_PADRAO },
 };
\ No newline at end of file
@@ -0,0 +1,238 @@
+/*******************************************************************************
+ * @file        deriva_termica.c
+ * @brief       Mnimos quadrados recursivos da deriva trmica da frequncia.
+ * @details     Regressor x = [1, T - T_ref], parmetros [a, b] e covarincia
+ * P (simtrica, guardada como P11, P12, P22). Esquecimento exponencial
+ * (DERIVA_LAMBDA) deixa o termo a acompanhar o envelhecimento lento do
+ * sensor; com a temperatura parada, porm, o esquecimento s faria P22
+ * crescer sem informao nova (windup), ento ele  suspenso quando P22
+ * chega a DERIVA_P22_MAX. A EEPROM s  gravada a cada DERIVA_SALVAR_MS,
+ * quando o modelo passa a ser confivel e antes do STOP (Deriva_Salvar).
+ ******************************************************************************/
+
+#include "deriva_termica.h"
+#include "gerenciador_configuracoes.h"
+#include "main.h" // Para HAL_GetTick
+#include <math.h>
+#include <stddef.h>
+
+//================================================================================
+// Definies e Variveis Internas
+//================================================================================
+
+#define DERIVA_LAMBDA              0.998f  // memria de ~500 janelas
+#define DERIVA_P11_INICIAL         1.0e8f  // a desconhecido (~10 kHz)
+#define DERIVA_P22_INICIAL         1.0e4f  // b desconhecido (~100 Hz/C)
+// P22 ~ 1/soma((T - T_med)): a correo s entra depois de ~100 C de
+// disperso de temperatura nas janelas aprendidas
+#define DERIVA_P22_CONFIAVEL       0.01f
+#define DERIVA_P22_MAX             0.005f
+#define DERIVA_MIN_AMOSTRAS        30u
+
+// Rejeio pelo resduo, depois de DERIVA_MIN_SESSAO janelas nesta sesso.
+// Um degrau real (sensor trocado, cmara suja) seria rejeitado para sempre:
+// depois de DERIVA_MAX_REJ_SEGUIDAS seguidas a janela entra assim mesmo.
+#define DERIVA_MIN_SESSAO          8u
+#define DERIVA_K_REJEICAO          4.0f
+#define DERIVA_RUIDO_MIN_HZ        2.0f   // quantizao de 1 pulso em janela de 1 s
+#define DERIVA_RUIDO_EMA_N         32.0f
+#define DERIVA_MAX_REJ_SEGUIDAS    10u
+
+#define DERIVA_TEMP_MIN_C          (-40.0f)  // abaixo disso o sensor no tem leitura
+#define DERIVA_SALVAR_MS           (30uL * 60uL * 1000uL)
+
+static Config_Deriva_t s_modelo;
+static float    s_ruido2 = DERIVA_RUIDO_MIN_HZ * DERIVA_RUIDO_MIN_HZ;
+static uint32_t s_aceitas_sessao = 0;
+static uint32_t s_rejeitadas = 0;
+static uint8_t  s_rej_seguidas = 0;
+static bool     s_alterado = false;
+static uint32_t s_ultimo_salvamento_ms = 0;
+
+static void Modelo_Vazio(void);
+static bool Confiavel(void);
+static bool Modelo_Valido(const Config_Deriva_t* m);
+
+//================================================================================
+// Implementao das Funes Pblicas
+//================================================================================
+
+void Deriva_Init(void)
+{
+    Gerenciador_Config_Get_Deriva(&s_modelo);
+    if (!Modelo_Valido(&s_modelo)) {
+        s_modelo.t_ref_c = 25.0f;
+        s_modelo.ativa = 1;
+        Modelo_Vazio();
+    }
+    s_ruido2 = DERIVA_RUIDO_MIN_HZ * DERIVA_RUIDO_MIN_HZ;
+    s_aceitas_sessao = 0;
+    s_rejeitadas = 0;
+    s_rej_seguidas = 0;
+    s_alterado = false;
+    s_ultimo_salvamento_ms = HAL_GetTick();
+}
+
+void Deriva_Aprender(float frequencia_hz, float temp_c)
+{
+    if (!s_modelo.ativa || (temp_c < DERIVA_TEMP_MIN_C) || (frequencia_hz <= 0.0f)) {
+        return;
+    }
+
+    float d = temp_c - s_modelo.t_ref_c;
+    float* p = s_modelo.p;
+
+    if (s_modelo.amostras == 0u) {
+        // Primeira janela: a sai direto dela, P fica com a incerteza inicial
+        s_modelo.coef[0] = frequencia_hz - (s_modelo.coef[1] * d);
+        s_modelo.amostras = 1u;
+        s_alterado = true;
+        return;
+    }
+
+    float e = frequencia_hz - (s_modelo.coef[0] + (s_modelo.coef[1] * d));
+
+    if (s_aceitas_sessao >= DERIVA_MIN_SESSAO) {
+        float limite2 = DERIVA_K_REJEICAO * DERIVA_K_REJEICAO * s_ruido2;
+        if (((e * e) > limite2) && (s_rej_seguidas < DERIVA_MAX_REJ_SEGUIDAS)) {
+            s_rejeitadas++;
+            s_rej_seguidas++;
+            return;
+        }
+    }
+    s_rej_seguidas = 0;
+
+    bool era_confiavel = Confiavel();
+
+    // P*x e ganho K = P*x / (lambda + x'*P*x)
+    float lambda = ((p[2] / DERIVA_LAMBDA) > DERIVA_P22_MAX) ? 1.0f : DERIVA_LAMBDA;
+    float px0 = p[0] + (p[1] * d);
+    float px1 = p[1] + (p[2] * d);
+    float den = lambda + px0 + (d * px1);
+    float k0 = px0 / den;
+    float k1 = px1 / den;
+
+    s_modelo.coef[0] += k0 * e;
+    s_modelo.coef[1] += k1 * e;
+
+    // P = (P - K*x'*P) / lambda
+    p[0] = (p[0] - (k0 * px0)) / lambda;
+    p[1] = (p[1] - (k0 * px1)) / lambda;
+    p[2] = (p[2] - (k1 * px1)) / lambda;
+
+    s_ruido2 += ((e * e) - s_ruido2) / DERIVA_RUIDO_EMA_N;
+    if (s_ruido2 < (DERIVA_RUIDO_MIN_HZ * DERIVA_RUIDO_MIN_HZ)) {
+        s_ruido2 = DERIVA_RUIDO_MIN_HZ * DERIVA_RUIDO_MIN_HZ;
+    }
+    s_modelo.amostras++;
+    s_aceitas_sessao++;
+    s_alterado = true;
+
+    // Grava j quando o modelo passa a valer, para o prximo despertar
+    if ((Confiavel() && !era_confiavel) ||
+        ((HAL_GetTick() - s_ultimo_salvamento_ms) >= DERIVA_SALVAR_MS)) {
+        Deriva_Salvar();
+    }
+}
+
+float Deriva_Corrigir(float frequencia_hz, float temp_c)
+{
+    if (!s_modelo.ativa || (temp_c < DERIVA_TEMP_MIN_C) || !Confiavel()) {
+        return frequencia_hz;
+    }
+    return frequencia_hz - (s_modelo.coef[1] * (temp_c - s_modelo.t_ref_c));
+}
+
+bool Deriva_Salvar(void)
+{
+    if (!s_alterado) {
+        return true;
+    }
+    if (!Gerenciador_Config_Set_Deriva(&s_modelo)) {
+        return false;
+    }
+    s_alterado = false;
+    s_ultimo_salvamento_ms = HAL_GetTick();
+    return true;
+}
+
+void Deriva_Reset(void)
+{
+    Modelo_Vazio();
+    s_ruido2 = DERIVA_RUIDO_MIN_HZ * DERIVA_RUIDO_MIN_HZ;
+    s_aceitas_sessao = 0;
+    s_rejeitadas = 0;
+    s_rej_seguidas = 0;
+    s_alterado = true;
+    Deriva_Salvar();
+}
+
+void Deriva_Set_Ativa(bool ativa)
+{
+    s_modelo.ativa = ativa ? 1u : 0u;
+    s_alterado = true;
+    Deriva_Salvar();
+}
+
+void Deriva_Set_Referencia(float t_ref_c)
+{
+    // a' = a + b*D e P' = M*P*M' com M = [1 D; 0 1], D = T_ref novo - antigo
+    float dt = t_ref_c - s_modelo.t_ref_c;
+    float* p = s_modelo.p;
+
+    s_modelo.coef[0] += s_modelo.coef[1] * dt;
+    p[0] += (2.0f * dt * p[1]) + (dt * dt * p[2]);
+    p[1] += dt * p[2];
+    s_modelo.t_ref_c = t_ref_c;
+    s_alterado = true;
+    Deriva_Salvar();
+}
+
+void Deriva_Get_Info(DerivaInfo_t* info)
+{
+    if (info == NULL) return;
+
+    info->a_hz = s_modelo.coef[0];
+    info->b_hz_por_c = s_modelo.coef[1];
+    info->t_ref_c = s_modelo.t_ref_c;
+    info->desvio_b = sqrtf(s_modelo.p[2] * s_ruido2);
+    info->ruido_hz = sqrtf(s_ruido2);
+    info->amostras = s_modelo.amostras;
+    info->rejeitadas = s_rejeitadas;
+    info->ativa = (s_modelo.ativa != 0u);
+    info->confiavel = Confiavel();
+}
+
+//================================================================================
+// Implementao das Funes Privadas
+//================================================================================
+
+static void Modelo_Vazio(void)
+{
+    s_modelo.coef[0] = 0.0f;
+    s_modelo.coef[1] = 0.0f;
+    s_modelo.p[0] = DERIVA_P11_INICIAL;
+    s_modelo.p[1] = 0.0f;
+    s_modelo.p[2] = DERIVA_P22_INICIAL;
+    s_modelo.amostras = 0;
+}
+
+static bool Confiavel(void)
+{
+    return (s_modelo.amostras >= DERIVA_MIN_AMOSTRAS) && (s_modelo.p[2] <= DERIVA_P22_CONFIAVEL);
+}
+
+/**
+ * @brief Rejeita um modelo vindo da EEPROM com nmeros invlidos ou com a
+ *        covarincia que s a configurao de fbrica (zerada) teria.
+ */
+static bool Modelo_Valido(const Config_Deriva_t* m)
+{
+    if (!isfinite(m->coef[0]) || !isfinite(m->coef[1]) || !isfinite(m->t_ref_c)) {
+        return false;
+    }
+    if (!isfinite(m->p[0]) || !isfinite(m->p[1]) || !isfinite(m->p[2])) {
+        return false;
+    }
+    return (m->p[0] > 0.0f) && (m->p[2] > 0.0f);
+}
@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * @file        estatistica.c
+ * @brief       Implementao do acumulador de Welford.
+ * @details     A atualizao  numericamente estvel mesmo com leituras
+ * grandes e prximas entre si (caso da umidade repetida sobre a mesma
+ * amostra), ao contrrio da soma de x e x em float.
+ ******************************************************************************/
+
+#include "estatistica.h"
+#include <math.h>
+#include <stddef.h>
+
+//================================================================================
+// Definies e Variveis Internas
+//================================================================================
+
+// t de Student bicaudal 95 % para gl = 1..ESTATISTICA_MAX_AMOSTRAS-1
+static const float s_t95[ESTATISTICA_MAX_AMOSTRAS - 1u] = {
+    12.706f, 4.303f, 3.182f, 2.776f, 2.571f, 2.447f, 2.365f, 2.306f, 2.262f, 2.228f,
+     2.201f, 2.179f, 2.160f, 2.145f, 2.131f, 2.120f, 2.110f, 2.101f, 2.093f,
+};
+
+//================================================================================
+// Funes Pblicas
+//================================================================================
+
+void Estatistica_Reset(Estatistica_t* est)
+{
+    if (est == NULL) return;
+    est->n = 0;
+    est->rejeitadas = 0;
+    est->media = 0.0f;
+    est->m2 = 0.0f;
+}
+
+bool Estatistica_Adicionar(Estatistica_t* est, float x, float piso)
+{
+    if (est == NULL) return false;
+
+    if (est->n >= ESTATISTICA_MIN_REJEICAO) {
+        float s = Estatistica_Desvio(est);
+        if (s < piso) {
+            s = piso;
+        }
+        if (fabsf(x - est->media) > (ESTATISTICA_K_REJEICAO * s)) {
+            est->rejeitadas++;
+            return false;
+        }
+    }
+
+    est->n++;
+    float delta = x - est->media;
+    est->media += delta / (float)est->n;
+    est->m2 += delta * (x - est->media);
+    return true;
+}
+
+float Estatistica_Desvio(const Estatistica_t* est)
+{
+    if ((est == NULL) || (est->n < 2u)) return 0.0f;
+    return sqrtf(est->m2 / (float)(est->n - 1u));
+}
+
+float Estatistica_Semi_IC95(const Estatistica_t* est)
+{
+    if ((est == NULL) || (est->n < 2u)) return INFINITY;
+
+    uint16_t gl = est->n - 1u;
+    if (gl > (ESTATISTICA_MAX_AMOSTRAS - 1u)) {
+        gl = ESTATISTICA_MAX_AMOSTRAS - 1u;
+    }
+    return s_t95[gl - 1u] * Estatistica_Desvio(est) / sqrtf((float)est->n);
+}
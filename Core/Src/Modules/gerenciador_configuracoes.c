@@ -13,6 +13,7 @@
 #include "eeprom_driver.h" 
 #include "GXXX_Equacoes.h"
 #include "retarget.h"
+#include "log_diferido.h"
 #include <string.h>
 #include <stdio.h>
 #include <stddef.h>
@@ -33,6 +34,16 @@ static CRC_HandleTypeDef *s_crc_handle = NULL;
  */
 static Config_Aplicacao_t s_config_cache;
 
+/**
+ * @brief Cache do bloco de sensores (mesma lgica, gravao independente).
+ */
+static Config_Sensores_t s_sensores_cache;
+
+/**
+ * @brief Verso da tabela de gros do cache (ver Gerenciador_Config_Get_Versao_Graos).
+ */
+static uint32_t s_versao_graos = 0;
+
 /**
  * @brief Mquina de Estados (FSM) de Armazenamento.
  * Gerencia o processo de escrita assncrona em 3 cpias.
@@ -45,6 +56,10 @@ typedef enum {
     FSM_STORE_WAIT_WRITE_BKP1,
     FSM_STORE_START_WRITE_BKP2,
     FSM_STORE_WAIT_WRITE_BKP2,
+    FSM_STORE_START_WRITE_SENSORES,
+    FSM_STORE_WAIT_WRITE_SENSORES,
+    FSM_STORE_START_WRITE_SENSORES_BKP,
+    FSM_STORE_WAIT_WRITE_SENSORES_BKP,
     FSM_STORE_ERROR
 } StorageFsmState_t;
 
@@ -55,17 +70,25 @@ static struct {
     volatile bool dirty;
     bool          is_saving;
     uint32_t      error_retry_tick; 
-} s_storage_fsm = { FSM_STORE_IDLE, false, false, 0 }; 
+    bool          dirty_sensores;     // bloco de sensores alterado
+    bool          salvando_sensores;  // gravao em curso  a do bloco de sensores
+} s_storage_fsm = { FSM_STORE_IDLE, false, false, 0, false, false }; 
 ;
 
 
+_Static_assert(sizeof(Config_Sensores_t) <= SENSORES_BLOCK_SIZE, "Config_Sensores_t maior que a fatia reservada na EEPROM");
+
 //================================================================================
 // Prottipos Privados
 //================================================================================
 
 static void Recalcular_E_Atualizar_CRC_Cache(void);
+static void Cache_Alterado(void);
 static bool Tentar_Carregar_De_Endereco(uint16_t address, Config_Aplicacao_t* config);
 static bool Carregar_Primeira_Config_Valida(Config_Aplicacao_t* config_out);
+static void Restaurar_Sensores(void);
+static bool Tentar_Carregar_Sensores(uint16_t address);
+static void Carregar_Sensores_Padrao(void);
 
 
 //================================================================================
@@ -78,6 +101,9 @@ void Gerenciador_Config_Init(CRC_HandleTypeDef* hcrc)
     s_storage_fsm.state = FSM_STORE_IDLE;
     s_storage_fsm.dirty = false;
     s_storage_fsm.is_saving = false;
+    s_storage_fsm.dirty_sensores = false;
+    s_storage_fsm.salvando_sensores = false;
+    Carregar_Sensores_Padrao(); // at Validar_e_Restaurar ler a EEPROM
 }
 
 /**
@@ -87,7 +113,7 @@ void Gerenciador_Config_Init(CRC_HandleTypeDef* hcrc)
 void Gerenciador_Config_Run_FSM(void)
 {
     // A FSM s  executada se o flag 'dirty' for definido E no estivermos j no meio de um ciclo de salvamento.
-    if (s_storage_fsm.state == FSM_STORE_IDLE && s_storage_fsm.dirty)
+    if (s_storage_fsm.state == FSM_STORE_IDLE && (s_storage_fsm.dirty || s_storage_fsm.dirty_sensores))
     {
         if (EEPROM_Driver_IsBusy())
         {
@@ -102,18 +128,30 @@ void Gerenciador_Config_Run_FSM(void)
         }
         // **** FIM DA CORREO ****
 
-        // Marca como ocupado e limpa o flag 'dirty' (inicia o processo)
-        s_storage_fsm.is_saving = true;
-        s_storage_fsm.dirty = false; 
+        if (s_storage_fsm.dirty)
+        {
+            // Marca como ocupado e limpa o flag 'dirty' (inicia o processo)
+            s_storage_fsm.is_saving = true;
+            s_storage_fsm.dirty = false; 
 
-        // Recalcula o CRC sobre o cache da RAM antes de iniciar a escrita
-        Recalcular_E_Atualizar_CRC_Cache(); 
+            // Recalcula o CRC sobre o cache da RAM antes de iniciar a escrita
+            Recalcular_E_Atualizar_CRC_Cache(); 
 
-        printf("Storage FSM: Flag 'dirty' detectado. Iniciando salvamento assincrono das 3 copias...\r\n");
-        s_storage_fsm.state = FSM_STORE_START_WRITE_PRIMARY;
+            LOG0(CFG_SALVAR_INICIO);
+            s_storage_fsm.state = FSM_STORE_START_WRITE_PRIMARY;
+        }
+        else
+        {
+            // Bloco de sensores: 2 cpias pequenas, sem tocar na configurao
+            s_storage_fsm.salvando_sensores = true;
+            s_storage_fsm.dirty_sensores = false;
+            s_sensores_cache.crc = HAL_CRC_Calculate(s_crc_handle, (uint32_t*)&s_sensores_cache,
+                                                     offsetof(Config_Sensores_t, crc) / 4);
+            s_storage_fsm.state = FSM_STORE_START_WRITE_SENSORES;
+        }
     }
 
-    if (!s_storage_fsm.is_saving)
+    if (!s_storage_fsm.is_saving && !s_storage_fsm.salvando_sensores)
     {
         return; // Nada a fazer.
     }
@@ -130,7 +168,7 @@ void Gerenciador_Config_Run_FSM(void)
             // **** INCIO DA CORREO ****
             if (!EEPROM_Driver_Write_Async_Start(ADDR_CONFIG_PRIMARY, (const uint8_t*)&s_config_cache, sizeof(Config_Aplicacao_t)))
             {
-                printf("Storage FSM: Falha ao INICIAR escrita primaria!\r\n");
+                LOG1(CFG_FALHA_INICIAR_ESCRITA, 0);
                 s_storage_fsm.state = FSM_STORE_ERROR; // Vai para o estado de erro
             }
             else
@@ -146,12 +184,12 @@ void Gerenciador_Config_Run_FSM(void)
                 // **** INCIO DA CORREO ****
                 if (EEPROM_Driver_GetAndClearErrorFlag())
                 {
-                    printf("Storage FSM: Erro de driver ao escrever Bloco Primario.\r\n");
+                    LOG1(CFG_ERRO_DRIVER_ESCRITA, 0);
                     s_storage_fsm.state = FSM_STORE_ERROR;
                 }
                 else
                 {
-                    printf("Storage FSM: Bloco Primario OK.\r\n");
+                    LOG1(CFG_BLOCO_OK, 0);
                     s_storage_fsm.state = FSM_STORE_START_WRITE_BKP1; // Sucesso, vai para o BKP1
                 }
                 // **** FIM DA CORREO ****
@@ -161,7 +199,7 @@ void Gerenciador_Config_Run_FSM(void)
         case FSM_STORE_START_WRITE_BKP1:
             if (!EEPROM_Driver_Write_Async_Start(ADDR_CONFIG_BACKUP1, (const uint8_t*)&s_config_cache, sizeof(Config_Aplicacao_t)))
             {
-                printf("Storage FSM: Falha ao INICIAR escrita BKP1!\r\n");
+                LOG1(CFG_FALHA_INICIAR_ESCRITA, 1);
                 s_storage_fsm.state = FSM_STORE_ERROR;
             }
             else
@@ -175,12 +213,12 @@ void Gerenciador_Config_Run_FSM(void)
             {
                 if (EEPROM_Driver_GetAndClearErrorFlag())
                 {
-                    printf("Storage FSM: Erro de driver ao escrever Bloco BKP1.\r\n");
+                    LOG1(CFG_ERRO_DRIVER_ESCRITA, 1);
                     s_storage_fsm.state = FSM_STORE_ERROR;
                 }
                 else
                 {
-                    printf("Storage FSM: Bloco BKP1 OK.\r\n");
+                    LOG1(CFG_BLOCO_OK, 1);
                     s_storage_fsm.state = FSM_STORE_START_WRITE_BKP2; // Sucesso, vai para o BKP2
                 }
             }
@@ -189,7 +227,7 @@ void Gerenciador_Config_Run_FSM(void)
         case FSM_STORE_START_WRITE_BKP2:
             if (!EEPROM_Driver_Write_Async_Start(ADDR_CONFIG_BACKUP2, (const uint8_t*)&s_config_cache, sizeof(Config_Aplicacao_t)))
             {
-                printf("Storage FSM: Falha ao INICIAR escrita BKP2!\r\n");
+                LOG1(CFG_FALHA_INICIAR_ESCRITA, 2);
                 s_storage_fsm.state = FSM_STORE_ERROR;
             }
             else
@@ -203,31 +241,104 @@ void Gerenciador_Config_Run_FSM(void)
             {
                 if (EEPROM_Driver_GetAndClearErrorFlag())
                 {
-                    printf("Storage FSM: Erro de driver ao escrever Bloco BKP2.\r\n");
+                    LOG1(CFG_ERRO_DRIVER_ESCRITA, 2);
                     s_storage_fsm.state = FSM_STORE_ERROR;
                 }
                 else
                 {
-                    printf("Storage FSM: Bloco BKP2 OK. Salvamento completo.\r\n");
+                    LOG1(CFG_BLOCO_OK, 2);
+                    LOG0(CFG_SALVAMENTO_COMPLETO);
                     s_storage_fsm.is_saving = false;
                     s_storage_fsm.state = FSM_STORE_IDLE;
                 }
             }
             break;
 
+        case FSM_STORE_START_WRITE_SENSORES:
+            if (!EEPROM_Driver_Write_Async_Start(ADDR_SENSORES_PRIMARY, (const uint8_t*)&s_sensores_cache, sizeof(Config_Sensores_t)))
+            {
+                LOG1(CFG_FALHA_INICIAR_ESCRITA, 3);
+                s_storage_fsm.state = FSM_STORE_ERROR;
+            }
+            else
+            {
+                s_storage_fsm.state = FSM_STORE_WAIT_WRITE_SENSORES;
+            }
+            break;
+
+        case FSM_STORE_WAIT_WRITE_SENSORES:
+            if (EEPROM_Driver_Write_Async_Poll())
+            {
+                if (EEPROM_Driver_GetAndClearErrorFlag())
+                {
+                    LOG1(CFG_ERRO_DRIVER_ESCRITA, 3);
+                    s_storage_fsm.state = FSM_STORE_ERROR;
+                }
+                else
+                {
+                    LOG1(CFG_BLOCO_OK, 3);
+                    s_storage_fsm.state = FSM_STORE_START_WRITE_SENSORES_BKP;
+                }
+            }
+            break;
+
+        case FSM_STORE_START_WRITE_SENSORES_BKP:
+            if (!EEPROM_Driver_Write_Async_Start(ADDR_SENSORES_BACKUP, (const uint8_t*)&s_sensores_cache, sizeof(Config_Sensores_t)))
+            {
+                LOG1(CFG_FALHA_INICIAR_ESCRITA, 4);
+                s_storage_fsm.state = FSM_STORE_ERROR;
+            }
+            else
+            {
+                s_storage_fsm.state = FSM_STORE_WAIT_WRITE_SENSORES_BKP;
+            }
+            break;
+
+        case FSM_STORE_WAIT_WRITE_SENSORES_BKP:
+            if (EEPROM_Driver_Write_Async_Poll())
+            {
+                if (EEPROM_Driver_GetAndClearErrorFlag())
+                {
+                    LOG1(CFG_ERRO_DRIVER_ESCRITA, 4);
+                    s_storage_fsm.state = FSM_STORE_ERROR;
+                }
+                else
+                {
+                    LOG1(CFG_BLOCO_OK, 4);
+                    s_storage_fsm.salvando_sensores = false;
+                    s_storage_fsm.state = FSM_STORE_IDLE;
+                }
+            }
+            break;
+
         case FSM_STORE_IDLE:
         case FSM_STORE_ERROR:
         default:
             // Se entrarmos em um estado de erro (ex: falha no DMA I2C), paramos a FSM
+            // e marca como dirty novamente o bloco que estava sendo salvo
+            if (s_storage_fsm.salvando_sensores)
+            {
+                s_storage_fsm.dirty_sensores = true;
+            }
+            else
+            {
+                s_storage_fsm.dirty = true;
+            }
             s_storage_fsm.is_saving = false; 
-            s_storage_fsm.dirty = true; // Marca como dirty novamente para tentar salvar
+            s_storage_fsm.salvando_sensores = false;
             s_storage_fsm.state = FSM_STORE_IDLE;
             s_storage_fsm.error_retry_tick = HAL_GetTick();
-            printf("Storage FSM: ERRO DURANTE ESCRITA ASYNC! Tentando novamente em %dms...\r\n", FSM_ERROR_COOLDOWN_MS);
+            LOG1(CFG_ERRO_ASYNC_RETRY, FSM_ERROR_COOLDOWN_MS);
             break;
     }
 }
 
+bool Gerenciador_Config_Salvamento_Pendente(void)
+{
+    return s_storage_fsm.dirty || s_storage_fsm.is_saving ||
+           s_storage_fsm.dirty_sensores || s_storage_fsm.salvando_sensores;
+}
+
 /**
  * @brief Valida os 3 slots da EEPROM e carrega o melhor para o cache s_config_cache.
  * Se todos falharem, carrega os padres de fbrica para o cache.
@@ -236,29 +347,31 @@ bool Gerenciador_Config_Validar_e_Restaurar(void)
 {
     if (s_crc_handle == NULL) return false;
 
-    printf("EEPROM Manager: Verificando integridade dos dados...\n");
+    LOG0(EEP_VERIFICANDO);
+    s_versao_graos++; // a tabela de gros ser substituda
+    Restaurar_Sensores(); // independente do resultado da configurao principal
 
     if (Tentar_Carregar_De_Endereco(ADDR_CONFIG_PRIMARY, &s_config_cache))
     {
-        printf("EEPROM Manager: Integridade dos dados OK (Primario)!\n\r");
+        LOG0(EEP_PRIMARIO_OK);
         return true; 
     }
-    printf("EEPROM Manager: Primario corrompido. Tentando Backup 1...\n");
+    LOG1(EEP_COPIA_CORROMPIDA, 0);
     if (Tentar_Carregar_De_Endereco(ADDR_CONFIG_BACKUP1, &s_config_cache))
     {
-        printf("EEPROM Manager: Restaurado do Backup 1. Marcando para ressalvar...\n");
+        LOG1(EEP_RESTAURADO_BACKUP, 1);
         s_storage_fsm.dirty = true; // Marca para reescrever todos os slots
         return true;
     }
-     printf("EEPROM Manager: Backup 1 corrompido. Tentando Backup 2...\n");
+    LOG1(EEP_COPIA_CORROMPIDA, 1);
     if (Tentar_Carregar_De_Endereco(ADDR_CONFIG_BACKUP2, &s_config_cache))
     {
-        printf("EEPROM Manager: Restaurado do Backup 2. Marcando para ressalvar...\n");
+        LOG1(EEP_RESTAURADO_BACKUP, 2);
         s_storage_fsm.dirty = true; // Marca para reescrever todos os slots
         return true;
     }
 
-    printf("EEPROM Manager: ERRO FATAL! Todas as copias corrompidas. Carregando Fabrica.\n");
+    LOG0(EEP_TODAS_CORROMPIDAS);
     Carregar_Configuracao_Padrao(); // Carrega padres na s_config_cache RAM
     s_storage_fsm.dirty = true;   // Marca para salvar os padres na EEPROM
     return false; // Retorna falso para sinalizar  App que os padres foram carregados
@@ -290,7 +403,8 @@ void Carregar_Configuracao_Padrao(void)
         s_config_cache.graos[i].umidade_min = Produto[i].Um_Min;
         s_config_cache.graos[i].umidade_max = Produto[i].Um_Max;
     }
-    s_storage_fsm.dirty = true;
+    s_versao_graos++;
+    Cache_Alterado();
 }
 
 
@@ -299,11 +413,19 @@ void Carregar_Configuracao_Padrao(void)
 // Elas apenas atualizam o cache da RAM e definem o flag 'dirty'. A FSM faz o resto.
 //================================================================================
 
+/**
+ * @brief Toda alterao do cache passa por aqui: agenda a gravao.
+ */
+static void Cache_Alterado(void)
+{
+    s_storage_fsm.dirty = true;
+}
+
 bool Gerenciador_Config_Set_Indice_Idioma(uint8_t novo_indice)
 {
     if (s_storage_fsm.is_saving) return false; // Rejeita se j estiver salvando
     s_config_cache.indice_idioma_selecionado = novo_indice;
-    s_storage_fsm.dirty = true;
+    Cache_Alterado();
     return true;
 }
 
@@ -314,7 +436,7 @@ bool Gerenciador_Config_Set_Senha(const char* nova_senha)
     
     strncpy(s_config_cache.senha_sistema, nova_senha, MAX_SENHA_LEN);
     s_config_cache.senha_sistema[MAX_SENHA_LEN] = '\0';
-    s_storage_fsm.dirty = true;
+    Cache_Alterado();
     return true;
 }
 
@@ -324,7 +446,7 @@ bool Gerenciador_Config_Set_Grao_Ativo(uint8_t novo_indice)
     if (s_storage_fsm.is_saving) return false; 
 
     s_config_cache.indice_grao_ativo = novo_indice;
-    s_storage_fsm.dirty = true;
+    Cache_Alterado();
     return true;
 }
 
@@ -334,16 +456,38 @@ bool Gerenciador_Config_Set_Cal_A(float gain, float zero)
     
     s_config_cache.fat_cal_a_gain = gain;
     s_config_cache.fat_cal_a_zero = zero;
-    s_storage_fsm.dirty = true;
+    Cache_Alterado();
+    return true;
+}
+
+bool Gerenciador_Config_Set_Deriva(const Config_Deriva_t* deriva)
+{
+    if (deriva == NULL) return false;
+    if (s_storage_fsm.salvando_sensores) return false; // DMA lendo o cache
+
+    s_sensores_cache.deriva = *deriva;
+    s_storage_fsm.dirty_sensores = true;
+    return true;
+}
+
+#if ADS1232_TEMP_INTERLEAVE
+bool Gerenciador_Config_Set_Comp_Celula(const Config_CompCelula_t* comp)
+{
+    if (comp == NULL) return false;
+    if (s_storage_fsm.salvando_sensores) return false;
+
+    s_sensores_cache.comp_celula = *comp;
+    s_storage_fsm.dirty_sensores = true;
     return true;
 }
+#endif
 
 bool Gerenciador_Config_Set_NR_Repetitions(uint16_t nr_repetitions)
 {
     if (s_storage_fsm.is_saving) return false; 
     
     s_config_cache.nr_repetition = nr_repetitions;
-    s_storage_fsm.dirty = true;
+    Cache_Alterado();
     return true;
 }
 
@@ -352,7 +496,7 @@ bool Gerenciador_Config_Set_NR_Decimals(uint16_t nr_decimals)
     if (s_storage_fsm.is_saving) return false; 
     
     s_config_cache.nr_decimals = nr_decimals;
-    s_storage_fsm.dirty = true;
+    Cache_Alterado();
     return true;
 }
 
@@ -363,7 +507,7 @@ bool Gerenciador_Config_Set_Usuario(const char* novo_usuario)
     
     strncpy(s_config_cache.usuarios[0].Nome, novo_usuario, 20);
     s_config_cache.usuarios[0].Nome[19] = '\0';
-    s_storage_fsm.dirty = true;
+    Cache_Alterado();
     return true;
 }
 
@@ -374,7 +518,7 @@ bool Gerenciador_Config_Set_Company(const char* nova_empresa)
     
     strncpy(s_config_cache.usuarios[0].Empresa, nova_empresa, 20);
     s_config_cache.usuarios[0].Empresa[19] = '\0';
-    s_storage_fsm.dirty = true;
+    Cache_Alterado();
     return true;
 }
 
@@ -385,7 +529,7 @@ bool Gerenciador_Config_Set_Serial(const char* novo_serial)
     
     strncpy(s_config_cache.nr_serial, novo_serial, 16);
     s_config_cache.nr_serial[15] = '\0'; // Garante terminao nula
-    s_storage_fsm.dirty = true;
+    Cache_Alterado();
     return true;
 }
 
@@ -393,10 +537,19 @@ bool Gerenciador_Config_Set_Serial(const char* novo_serial)
 // FUNES "GET" - Agora leem do Cache RAM (instantneo)
 //================================================================================
 
-void Gerenciador_Config_Get_Config_Snapshot(Config_Aplicacao_t* config_out)
+const Config_Aplicacao_t* Gerenciador_Config_Get_View(void)
+{
+    return &s_config_cache;
+}
+
+const Config_Grao_t* Gerenciador_Config_Get_Grao_View(uint8_t indice)
 {
-    if (config_out == NULL) return;
-    memcpy(config_out, &s_config_cache, sizeof(Config_Aplicacao_t));
+    return (indice < MAX_GRAOS) ? &s_config_cache.graos[indice] : NULL;
+}
+
+uint32_t Gerenciador_Config_Get_Versao_Graos(void)
+{
+    return s_versao_graos;
 }
 
 bool Gerenciador_Config_Get_Indice_Idioma(uint8_t* indice)
@@ -425,6 +578,11 @@ bool Gerenciador_Config_Get_Senha(char* buffer, uint8_t tamanho_buffer)
 
 uint8_t Gerenciador_Config_Get_Num_Graos(void) { return MAX_GRAOS; }
 
+const char* Gerenciador_Config_Get_Nome_Grao(uint8_t indice)
+{
+    return (indice < MAX_GRAOS) ? s_config_cache.graos[indice].nome : NULL;
+}
+
 
 bool Gerenciador_Config_Get_Grao_Ativo(uint8_t* indice_ativo)
 {
@@ -446,6 +604,22 @@ bool Gerenciador_Config_Get_Cal_A(float* gain, float* zero)
     return true;
 }
 
+bool Gerenciador_Config_Get_Deriva(Config_Deriva_t* deriva)
+{
+    if (deriva == NULL) return false;
+    *deriva = s_sensores_cache.deriva;
+    return true;
+}
+
+#if ADS1232_TEMP_INTERLEAVE
+bool Gerenciador_Config_Get_Comp_Celula(Config_CompCelula_t* comp)
+{
+    if (comp == NULL) return false;
+    *comp = s_sensores_cache.comp_celula;
+    return true;
+}
+#endif
+
 uint16_t Gerenciador_Config_Get_NR_Repetition(void) { return s_config_cache.nr_repetition; }
 
 uint16_t Gerenciador_Config_Get_NR_Decimals(void) { return s_config_cache.nr_decimals; }
@@ -499,7 +673,7 @@ static bool Tentar_Carregar_De_Endereco(uint16_t address, Config_Aplicacao_t* co
 {
     if (!EEPROM_Driver_Read_Blocking(address, (uint8_t*)config_out, sizeof(Config_Aplicacao_t))) 
     { 
-        printf("EEPROM Check: Falha na leitura I2C no endereco 0x%X\r\n", address);
+        LOG1(EEP_FALHA_LEITURA, address);
         return false; 
     }
     
@@ -514,8 +688,7 @@ static bool Tentar_Carregar_De_Endereco(uint16_t address, Config_Aplicacao_t* co
         return true; // Sucesso!
     }
 
-    printf("EEPROM Check: Falha de CRC no endereco 0x%X. Esperado [0x%lX] vs Lido [0x%lX]\r\n", 
-           address, (unsigned long)crc_calculado, (unsigned long)crc_armazenado);
+    LOG3(EEP_FALHA_CRC, address, crc_calculado, crc_armazenado);
     return false;
 }
 
@@ -529,3 +702,62 @@ static bool Carregar_Primeira_Config_Valida(Config_Aplicacao_t* config_out)
     if (Tentar_Carregar_De_Endereco(ADDR_CONFIG_BACKUP2, config_out)) return true;
     return false;
 }
+
+//================================================================================
+// Bloco de Sensores
+//================================================================================
+
+/**
+ * @brief (Funo BLOQUEANTE de Boot) Primria, depois backup; sem cpia
+ *        vlida (ex.: unidade gravada antes do bloco existir) ficam os padres.
+ */
+static void Restaurar_Sensores(void)
+{
+    if (Tentar_Carregar_Sensores(ADDR_SENSORES_PRIMARY))
+    {
+        return;
+    }
+    if (Tentar_Carregar_Sensores(ADDR_SENSORES_BACKUP))
+    {
+        s_storage_fsm.dirty_sensores = true; // reescreve a primria
+        return;
+    }
+    Carregar_Sensores_Padrao();
+}
+
+static bool Tentar_Carregar_Sensores(uint16_t address)
+{
+    Config_Sensores_t lido;
+    if (!EEPROM_Driver_Read_Blocking(address, (uint8_t*)&lido, sizeof(Config_Sensores_t)))
+    {
+        LOG1(EEP_FALHA_LEITURA, address);
+        return false;
+    }
+
+    uint32_t crc_calculado = HAL_CRC_Calculate(s_crc_handle, (uint32_t*)&lido, offsetof(Config_Sensores_t, crc) / 4);
+    if ((crc_calculado != lido.crc) || (lido.versao != CONFIG_SENSORES_VERSAO))
+    {
+        LOG3(EEP_FALHA_CRC, address, crc_calculado, lido.crc);
+        return false;
+    }
+    s_sensores_cache = lido;
+    return true;
+}
+
+/**
+ * @brief Padres do bloco de sensores. S vo para a EEPROM quando algum
+ *        valor for alterado.
+ */
+static void Carregar_Sensores_Padrao(void)
+{
+    memset(&s_sensores_cache, 0, sizeof(Config_Sensores_t));
+    s_sensores_cache.versao = CONFIG_SENSORES_VERSAO;
+    // Modelo de deriva vazio (amostras = 0): deriva_termica.c aplica as
+    // covarincias iniciais na primeira janela aprendida
+    s_sensores_cache.deriva.t_ref_c = 25.0f;
+    s_sensores_cache.deriva.ativa = 1;
+#if ADS1232_TEMP_INTERLEAVE
+    // Compensao da clula desligada at um BTEMP COMP
+    s_sensores_cache.comp_celula.t_ref_c = 25.0f;
+#endif
+}
@@ -0,0 +1,200 @@
+/*******************************************************************************
+ * @file        log_diferido.c
+ * @brief       Implementao do log binrio diferido.
+ * @details     Registro no fio (payload do frame CLI_FRAME_TIPO_LOG, little
+ * endian):
+ *   ID(2) TIMESTAMP_MS(4) NARGS(1) ARG0(4) ... ARGn(4)
+ * O enquadramento (COBS + CRC16)  feito por CLI_Write_Frame().
+ ******************************************************************************/
+
+#include "log_diferido.h"
+#include "cli_driver.h"
+#include "main.h" // Para HAL_GetTick e __get_PRIMASK
+
+//================================================================================
+// Definies e Variveis Internas
+//================================================================================
+
+#define LOG_REGISTROS_POR_CICLO  4u   // limita o tempo gasto por volta do superloop
+#define LOG_CABECALHO_FIO        7u   // ID(2) + TS(4) + NARGS(1)
+
+// Seo crtica que preserva o estado anterior (pode ser chamada de ISR)
+#define LOG_ENTER_CRITICAL()  uint32_t primask_salvo = __get_PRIMASK(); __disable_irq()
+#define LOG_EXIT_CRITICAL()   __set_PRIMASK(primask_salvo)
+
+typedef struct {
+    uint16_t id;
+    uint8_t  nargs;
+    uint32_t timestamp_ms;
+    uint32_t args[LOG_MAX_ARGS];
+} LogRegistro_t;
+
+static LogRegistro_t s_fila[LOG_FILA_TAMANHO];
+static volatile uint8_t s_head = 0;
+static volatile uint8_t s_tail = 0;
+
+static uint8_t s_nivel_min[LOG_NUM_MODULOS];
+static volatile LogStats_t s_stats;
+static uint32_t s_perdidos_reportados = 0;
+
+static const char* const s_nomes_modulo[LOG_NUM_MODULOS] = {
+    "SIS", "CFG", "EEPROM", "BALANCA", "MEDICAO",
+};
+
+static const char* const s_nomes_nivel[] = {
+    "DEBUG", "INFO", "AVISO", "ERRO", "OFF",
+};
+
+//================================================================================
+// Funes Privadas
+//================================================================================
+
+static void Escrever_U32_LE(uint8_t* p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+/**
+ * @brief Serializa e envia um registro. S retorna true se o frame inteiro
+ *        coube no FIFO do console.
+ */
+static bool Enviar_Registro(const LogRegistro_t* r)
+{
+    uint8_t buf[LOG_CABECALHO_FIO + (LOG_MAX_ARGS * 4u)];
+    uint8_t nargs = (r->nargs <= LOG_MAX_ARGS) ? r->nargs : LOG_MAX_ARGS;
+
+    buf[0] = (uint8_t)r->id;
+    buf[1] = (uint8_t)(r->id >> 8);
+    Escrever_U32_LE(&buf[2], r->timestamp_ms);
+    buf[6] = nargs;
+    for (uint8_t i = 0; i < nargs; i++)
+    {
+        Escrever_U32_LE(&buf[LOG_CABECALHO_FIO + (i * 4u)], r->args[i]);
+    }
+
+    return CLI_Write_Frame(CLI_FRAME_TIPO_LOG, buf, (uint16_t)(LOG_CABECALHO_FIO + (nargs * 4u)));
+}
+
+//================================================================================
+// Funes Pblicas
+//================================================================================
+
+void Log_Init(void)
+{
+    s_head = 0;
+    s_tail = 0;
+    s_perdidos_reportados = 0;
+    for (uint8_t i = 0; i < LOG_NUM_MODULOS; i++)
+    {
+        s_nivel_min[i] = LOG_NIVEL_INFO;
+    }
+    Log_Reset_Stats();
+}
+
+void Log_Registrar(LogId_t id, LogModulo_t modulo, LogNivel_t nivel, uint8_t nargs,
+                   uint32_t a, uint32_t b, uint32_t c, uint32_t d)
+{
+    if ((modulo >= LOG_NUM_MODULOS) || (nivel < s_nivel_min[modulo]))
+    {
+        // Contador compartilhado com ISRs: incremento no  atmico no M0+
+        LOG_ENTER_CRITICAL();
+        s_stats.filtrados++;
+        LOG_EXIT_CRITICAL();
+        return;
+    }
+
+    uint32_t agora = HAL_GetTick();
+
+    LOG_ENTER_CRITICAL();
+    uint8_t proximo = (uint8_t)((s_head + 1u) & (LOG_FILA_TAMANHO - 1u));
+    if (proximo == s_tail)
+    {
+        s_stats.perdidos++;
+    }
+    else
+    {
+        LogRegistro_t* r = &s_fila[s_head];
+        r->id = (uint16_t)id;
+        r->nargs = nargs;
+        r->timestamp_ms = agora;
+        r->args[0] = a;
+        r->args[1] = b;
+        r->args[2] = c;
+        r->args[3] = d;
+        s_head = proximo;
+        s_stats.registrados++;
+    }
+    LOG_EXIT_CRITICAL();
+}
+
+void Log_Process(void)
+{
+    // Informa perdas assim que houver espao (o registro no passa pela fila)
+    uint32_t perdidos = s_stats.perdidos;
+    if (perdidos != s_perdidos_reportados)
+    {
+        LogRegistro_t aviso = {
+            .id = LOG_ID_SIS_REGISTROS_PERDIDOS,
+            .nargs = 1,
+            .timestamp_ms = HAL_GetTick(),
+            .args = { perdidos - s_perdidos_reportados },
+        };
+        if (!Enviar_Registro(&aviso))
+        {
+            return;
+        }
+        s_perdidos_reportados = perdidos;
+    }
+
+    for (uint8_t n = 0; (n < LOG_REGISTROS_POR_CICLO) && (s_tail != s_head); n++)
+    {
+        if (!Enviar_Registro(&s_fila[s_tail]))
+        {
+            return; // console cheio: tenta na prxima volta
+        }
+        s_tail = (uint8_t)((s_tail + 1u) & (LOG_FILA_TAMANHO - 1u));
+        s_stats.enviados++;
+    }
+}
+
+void Log_Set_Nivel(LogModulo_t modulo, LogNivel_t nivel)
+{
+    if ((modulo < LOG_NUM_MODULOS) && (nivel <= LOG_NIVEL_OFF))
+    {
+        s_nivel_min[modulo] = (uint8_t)nivel;
+    }
+}
+
+LogNivel_t Log_Get_Nivel(LogModulo_t modulo)
+{
+    return (modulo < LOG_NUM_MODULOS) ? (LogNivel_t)s_nivel_min[modulo] : LOG_NIVEL_OFF;
+}
+
+void Log_Get_Stats(LogStats_t* out)
+{
+    if (out == NULL) return;
+    LOG_ENTER_CRITICAL();
+    *out = s_stats;
+    LOG_EXIT_CRITICAL();
+}
+
+void Log_Reset_Stats(void)
+{
+    LOG_ENTER_CRITICAL();
+    memset((void*)&s_stats, 0, sizeof(s_stats));
+    s_perdidos_reportados = 0;
+    LOG_EXIT_CRITICAL();
+}
+
+const char* Log_Nome_Modulo(LogModulo_t modulo)
+{
+    return (modulo < LOG_NUM_MODULOS) ? s_nomes_modulo[modulo] : "?";
+}
+
+const char* Log_Nome_Nivel(LogNivel_t nivel)
+{
+    return (nivel <= LOG_NIVEL_OFF) ? s_nomes_nivel[nivel] : "?";
+}
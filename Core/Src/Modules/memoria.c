@@ -0,0 +1,76 @@
+/*******************************************************************************
+ * @file        memoria.c
+ * @brief       Pintura da pilha e leitura da ocupao de RAM.
+ * @details     O topo da pilha  a primeira entrada da tabela de vetores
+ * (__initial_sp); a base  o topo menos MEMORIA_STACK_BYTES. Os limites
+ * da regio RW_IRAM1 vm dos smbolos gerados pelo armlink.
+ ******************************************************************************/
+
+#include "memoria.h"
+#include "main.h"
+#include <stddef.h>
+
+//================================================================================
+// Definies e Variveis Internas
+//================================================================================
+
+// Folga abaixo do SP atual que no  pintada (quadro da prpria funo)
+#define MEMORIA_MARGEM_PINTURA  64u
+
+extern const uint32_t __Vectors[];                 // startup_stm32c071xx.s
+extern uint32_t Image$$RW_IRAM1$$Base;             // armlink
+extern uint32_t Image$$RW_IRAM1$$ZI$$Limit;
+
+// Coerncia das constantes (a pintura trabalha com palavras de 32 bits)
+_Static_assert((MEMORIA_STACK_BYTES % 4u) == 0u, "MEMORIA_STACK_BYTES deve ser multiplo de 4");
+_Static_assert(MEMORIA_ORCAMENTO_RAM_BYTES <= MEMORIA_RAM_TOTAL_BYTES, "Orcamento de RAM maior que a SRAM");
+
+//================================================================================
+// Funes Privadas
+//================================================================================
+
+static uint32_t* Topo_Stack(void)
+{
+    return (uint32_t*)(uintptr_t)__Vectors[0];
+}
+
+static uint32_t* Base_Stack(void)
+{
+    return (uint32_t*)(uintptr_t)(__Vectors[0] - MEMORIA_STACK_BYTES);
+}
+
+//================================================================================
+// Funes Pblicas
+//================================================================================
+
+void Memoria_Pintar_Stack(void)
+{
+    volatile uint32_t* p = Base_Stack();
+    uint32_t* limite = (uint32_t*)(uintptr_t)(__get_MSP() - MEMORIA_MARGEM_PINTURA);
+
+    // volatile impede o compilador de trocar o lao por memset (que usaria pilha)
+    while (p < limite) {
+        *p++ = MEMORIA_PADRAO_STACK;
+    }
+}
+
+uint32_t Memoria_Stack_Livre_Min(void)
+{
+    const uint32_t* p = Base_Stack();
+    const uint32_t* topo = Topo_Stack();
+
+    while ((p < topo) && (*p == MEMORIA_PADRAO_STACK)) {
+        p++;
+    }
+    return (uint32_t)((p - Base_Stack()) * sizeof(uint32_t));
+}
+
+void Memoria_Get_Info(MemoriaInfo_t* out)
+{
+    if (out == NULL) return;
+
+    out->ram_total = MEMORIA_RAM_TOTAL_BYTES;
+    out->ram_usada = (uint32_t)((uintptr_t)&Image$$RW_IRAM1$$ZI$$Limit - (uintptr_t)&Image$$RW_IRAM1$$Base);
+    out->stack_total = MEMORIA_STACK_BYTES;
+    out->stack_usada_max = MEMORIA_STACK_BYTES - Memoria_Stack_Livre_Min();
+}
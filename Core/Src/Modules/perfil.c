@@ -0,0 +1,198 @@
+/*******************************************************************************
+ * @file        perfil.c
+ * @brief       Implementao do profiler baseado no TIM3.
+ * @details     O TIM3 (16 bits)  configurado aqui diretamente, sem passar
+ * pelo CubeMX: PSC para 1 MHz e ARR mximo, sem interrupo. Intervalos
+ * acima de ~60 ms usam o tick do HAL (a contagem de 16 bits j deu a volta).
+ ******************************************************************************/
+
+#include "perfil.h"
+
+#if PERFIL_HABILITADO
+
+#include "main.h"
+#include <string.h>
+
+//================================================================================
+// Definies e Variveis Internas
+//================================================================================
+
+#define PERFIL_LIMITE_16BIT_MS   60u   // abaixo disso o contador de 16 bits  exato
+
+// Seo crtica que preserva o estado anterior (pode ser chamada de ISR)
+#define PERFIL_ENTER_CRITICAL()  uint32_t primask_salvo = __get_PRIMASK(); __disable_irq()
+#define PERFIL_EXIT_CRITICAL()   __set_PRIMASK(primask_salvo)
+
+static PerfilPontoStats_t s_pontos[PERFIL_NUM_PONTOS];
+static PerfilIsrStats_t   s_isr[PERFIL_NUM_ISR];
+static PerfilLoopStats_t  s_loop;
+
+static PerfilMarca_t s_isr_entrada[PERFIL_NUM_ISR];
+static uint32_t      s_exti_intervalo_us = 0;
+static PerfilMarca_t s_loop_anterior;
+static bool          s_loop_iniciado = false;
+
+static const char* const s_nomes_ponto[PERFIL_NUM_PONTOS] = {
+    "CLI_RX", "DWIN_RX", "EVENTOS", "CLI_TX", "DWIN_TX", "MEDICAO", "DISPLAY", "CONFIG",
+};
+
+static const char* const s_nomes_isr[PERFIL_NUM_ISR] = {
+    "TIM14", "USART1", "USART2", "EXTI",
+};
+
+//================================================================================
+// Funes Privadas
+//================================================================================
+
+static uint8_t Faixa_Histograma(uint32_t us)
+{
+    uint8_t faixa = 0;
+    while ((faixa < (PERFIL_HIST_FAIXAS - 1u)) && (us >= (16uL << faixa))) {
+        faixa++;
+    }
+    return faixa;
+}
+
+//================================================================================
+// Funes Pblicas
+//================================================================================
+
+void Perfil_Init(void)
+{
+    __HAL_RCC_TIM3_CLK_ENABLE();
+    TIM3->CR1 = 0;
+    TIM3->PSC = (uint16_t)((SystemCoreClock / 1000000u) - 1u);
+    TIM3->ARR = 0xFFFFu;
+    TIM3->EGR = TIM_EGR_UG;   // carrega o PSC
+    TIM3->CR1 = TIM_CR1_CEN;
+
+    Perfil_Reset();
+}
+
+PerfilMarca_t Perfil_Marcar(void)
+{
+    PerfilMarca_t m;
+    m.ms = HAL_GetTick();
+    m.us = (uint16_t)TIM3->CNT;
+    return m;
+}
+
+uint32_t Perfil_Decorrido_us(PerfilMarca_t marca)
+{
+    PerfilMarca_t agora = Perfil_Marcar();
+    uint32_t ms = agora.ms - marca.ms;
+    if (ms >= PERFIL_LIMITE_16BIT_MS) {
+        return ms * 1000u;
+    }
+    return (uint16_t)(agora.us - marca.us);
+}
+
+void Perfil_Registrar(PerfilPonto_t ponto, PerfilMarca_t inicio)
+{
+    if (ponto >= PERFIL_NUM_PONTOS) return;
+
+    uint32_t us = Perfil_Decorrido_us(inicio);
+    PerfilPontoStats_t* p = &s_pontos[ponto];
+    p->chamadas++;
+    p->total_us += us;
+    if (us > p->max_us) {
+        p->max_us = us;
+    }
+}
+
+void Perfil_Loop(void)
+{
+    if (s_loop_iniciado) {
+        uint32_t us = Perfil_Decorrido_us(s_loop_anterior);
+        s_loop.voltas++;
+        s_loop.histograma[Faixa_Histograma(us)]++;
+        if (us > s_loop.periodo_max_us) {
+            s_loop.periodo_max_us = us;
+        }
+    }
+    s_loop_anterior = Perfil_Marcar();
+    s_loop_iniciado = true;
+}
+
+void Perfil_Isr_Entrada(PerfilIsr_t fonte)
+{
+    PerfilMarca_t agora = Perfil_Marcar();
+    uint32_t latencia = 0;
+
+    if (fonte == PERFIL_ISR_TIM14) {
+        // O contador do TIM14 reinicia no update: seu valor  o atraso at aqui
+        latencia = (TIM14->CNT * (TIM14->PSC + 1u)) / (SystemCoreClock / 1000000u);
+    } else if (fonte == PERFIL_ISR_EXTI) {
+        // Fonte peridica: a variao do intervalo entre entradas  a latncia
+        if (s_isr[fonte].amostras > 0) {
+            uint32_t ms = agora.ms - s_isr_entrada[fonte].ms;
+            uint32_t intervalo = (ms >= PERFIL_LIMITE_16BIT_MS) ? (ms * 1000u)
+                                                                : (uint16_t)(agora.us - s_isr_entrada[fonte].us);
+            if (s_exti_intervalo_us != 0) {
+                latencia = (intervalo > s_exti_intervalo_us) ? (intervalo - s_exti_intervalo_us)
+                                                             : (s_exti_intervalo_us - intervalo);
+            }
+            s_exti_intervalo_us = intervalo;
+        }
+    }
+
+    PerfilIsrStats_t* st = &s_isr[fonte];
+    st->amostras++;
+    st->latencia_total_us += latencia;
+    if (latencia > st->latencia_max_us) {
+        st->latencia_max_us = latencia;
+    }
+    s_isr_entrada[fonte] = agora;
+}
+
+void Perfil_Isr_Saida(PerfilIsr_t fonte)
+{
+    uint32_t us = Perfil_Decorrido_us(s_isr_entrada[fonte]);
+    if (us > s_isr[fonte].exec_max_us) {
+        s_isr[fonte].exec_max_us = us;
+    }
+}
+
+void Perfil_Get_Ponto(PerfilPonto_t ponto, PerfilPontoStats_t* out)
+{
+    if ((out == NULL) || (ponto >= PERFIL_NUM_PONTOS)) return;
+    *out = s_pontos[ponto];
+}
+
+void Perfil_Get_Isr(PerfilIsr_t fonte, PerfilIsrStats_t* out)
+{
+    if ((out == NULL) || (fonte >= PERFIL_NUM_ISR)) return;
+    PERFIL_ENTER_CRITICAL();
+    *out = s_isr[fonte];
+    PERFIL_EXIT_CRITICAL();
+}
+
+void Perfil_Get_Loop(PerfilLoopStats_t* out)
+{
+    if (out == NULL) return;
+    *out = s_loop;
+}
+
+void Perfil_Reset(void)
+{
+    memset(s_pontos, 0, sizeof(s_pontos));
+    memset(&s_loop, 0, sizeof(s_loop));
+    s_loop_iniciado = false;
+
+    PERFIL_ENTER_CRITICAL();
+    memset(s_isr, 0, sizeof(s_isr));
+    s_exti_intervalo_us = 0;
+    PERFIL_EXIT_CRITICAL();
+}
+
+const char* Perfil_Nome_Ponto(PerfilPonto_t ponto)
+{
+    return (ponto < PERFIL_NUM_PONTOS) ? s_nomes_ponto[ponto] : "?";
+}
+
+const char* Perfil_Nome_Isr(PerfilIsr_t fonte)
+{
+    return (fonte < PERFIL_NUM_ISR) ? s_nomes_isr[fonte] : "?";
+}
+
+#endif // PERFIL_HABILITADO
@@ -0,0 +1,378 @@
+/*******************************************************************************
+ * @file        pesquisa_graos.c
+ * @brief       Implementao do ndice de pesquisa por nome de gro.
+ * @details     Memria: PESQUISA_BUCKETS bitsets de MAX_GRAOS bits (bigramas)
+ * + bitset do resultado. Os nomes no so copiados: a verificao l o
+ * cache de configurao pelo ponteiro e normaliza na hora.
+ * A busca aproximada acrescenta apenas um byte de distncia por gro.
+ ******************************************************************************/
+
+#include "pesquisa_graos.h"
+#include "gerenciador_configuracoes.h"
+#include "GXXX_Equacoes.h"
+#include <string.h>
+
+//================================================================================
+// Definies e Variveis Internas
+//================================================================================
+
+#define PESQUISA_PALAVRAS   ((MAX_GRAOS + 31u) / 32u)
+#define PESQUISA_NOME_MAX   24u        // limite de leitura dos nomes de Produto[]
+#define PESQUISA_CLASSES    37u        // 'a'..'z', '0'..'9' e espao
+#define DISTANCIA_NENHUMA   0xFFu
+
+typedef struct {
+    uint32_t bits[PESQUISA_PALAVRAS];
+} Bitset_t;
+
+// Latin-1 0xC0..0xFF -> letra base ( e  viram espao)
+static const char s_sem_acento[64] =
+    "aaaaaaaceeeeiiiidnooooo ouuuuyps"
+    "aaaaaaaceeeeiiiidnooooo ouuuuypy";
+
+static Bitset_t s_bigramas[PESQUISA_BUCKETS];
+static Bitset_t s_resultado;
+static uint16_t s_num_resultados = 0;
+static uint8_t  s_num_graos = 0;
+static bool     s_construido = false;
+static uint32_t s_versao_graos = 0;   // verso da tabela de gros usada no ndice
+
+// Consulta anterior (j normalizada), base do refinamento incremental
+static char s_termo_anterior[MAX_NOME_GRAO_LEN + 1];
+
+// Busca aproximada: menor distncia de cada gro (DISTANCIA_NENHUMA = fora)
+static uint8_t  s_distancia[MAX_GRAOS];
+static uint8_t  s_distancia_max = 0;
+static PesquisaModo_t s_modo = PESQUISA_EXATA;
+
+// Cursor da extrao de pginas: posio, distncia e gro correspondentes
+static uint16_t s_cursor_pos = 0;
+static uint8_t  s_cursor_dist = 0;
+static uint8_t  s_cursor_grao = 0;
+
+//================================================================================
+// Funes Privadas
+//================================================================================
+
+static uint8_t Hash_Bigrama(char a, char b)
+{
+    return (uint8_t)(((uint8_t)a * 31u + (uint8_t)b) & (PESQUISA_BUCKETS - 1u));
+}
+
+static void Bitset_Set(Bitset_t* b, uint8_t i)
+{
+    b->bits[i >> 5] |= (1uL << (i & 31u));
+}
+
+static bool Bitset_Get(const Bitset_t* b, uint8_t i)
+{
+    return (b->bits[i >> 5] & (1uL << (i & 31u))) != 0u;
+}
+
+static void Bitset_Preencher(Bitset_t* b, uint8_t n)
+{
+    memset(b, 0, sizeof(*b));
+    for (uint8_t i = 0; i < n; i++)
+    {
+        Bitset_Set(b, i);
+    }
+}
+
+static uint16_t Bitset_Contar(const Bitset_t* b)
+{
+    uint16_t total = 0;
+    for (uint8_t w = 0; w < PESQUISA_PALAVRAS; w++)
+    {
+        uint32_t v = b->bits[w];
+        while (v != 0u)
+        {
+            v &= v - 1u;
+            total++;
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief Substring do termo (j normalizado) no nome, normalizando o nome na hora.
+ */
+static bool Nome_Contem(const char* nome, const char* termo, uint8_t len_termo)
+{
+    char chave[MAX_NOME_GRAO_LEN + 1];
+    uint8_t n = 0;
+
+    while ((n < MAX_NOME_GRAO_LEN) && (nome[n] != '\0'))
+    {
+        chave[n] = PesquisaGraos_Normalizar(nome[n]);
+        n++;
+    }
+    if (len_termo > n)
+    {
+        return false;
+    }
+
+    for (uint8_t i = 0; i + len_termo <= n; i++)
+    {
+        if (memcmp(&chave[i], termo, len_termo) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint8_t Classe(char c)
+{
+    if (c >= 'a' && c <= 'z') return (uint8_t)(c - 'a');
+    if (c >= '0' && c <= '9') return (uint8_t)(26 + (c - '0'));
+    return 36u; // espao
+}
+
+/**
+ * @brief Menor distncia de edio entre o padro e qualquer trecho do texto
+ *        (Myers, 1999: uma palavra de bits por coluna, padro <= 32 caracteres).
+ * @param peq Mscara de ocorrncia de cada classe no padro.
+ */
+static uint8_t Myers_Distancia(const uint32_t* peq, uint8_t m, const char* texto)
+{
+    const uint32_t ultimo = 1uL << (m - 1u);
+    uint32_t pv = 0xFFFFFFFFuL;
+    uint32_t mv = 0;
+    uint8_t score = m;
+    uint8_t melhor = m;
+
+    for (uint8_t j = 0; (j < PESQUISA_NOME_MAX) && (texto[j] != '\0'); j++)
+    {
+        uint32_t eq = peq[Classe(PesquisaGraos_Normalizar(texto[j]))];
+        uint32_t xv = eq | mv;
+        uint32_t xh = (((eq & pv) + pv) ^ pv) | eq;
+        uint32_t ph = mv | ~(xh | pv);
+        uint32_t mh = pv & xh;
+
+        if (ph & ultimo)      score++;
+        else if (mh & ultimo) score--;
+
+        // Busca em trecho: o incio no texto  livre (sem |1 em ph)
+        ph <<= 1;
+        mh <<= 1;
+        pv = mh | ~(xv | ph);
+        mv = ph & xv;
+
+        if (score < melhor)
+        {
+            melhor = score;
+            if (melhor == 0u) break;
+        }
+    }
+    return melhor;
+}
+
+static void Cursor_Reiniciar(void)
+{
+    s_cursor_pos = 0;
+    s_cursor_dist = 0;
+    s_cursor_grao = 0;
+}
+
+// Refaz o ndice s quando a tabela de gros mudou desde a ltima construo
+static void Atualizar_Indice(void)
+{
+    if (!s_construido || (s_versao_graos != Gerenciador_Config_Get_Versao_Graos()))
+    {
+        PesquisaGraos_Construir();
+    }
+}
+
+//================================================================================
+// Funes Pblicas
+//================================================================================
+
+char PesquisaGraos_Normalizar(char c)
+{
+    uint8_t u = (uint8_t)c;
+
+    if (u >= 'A' && u <= 'Z') return (char)(u + ('a' - 'A'));
+    if ((u >= 'a' && u <= 'z') || (u >= '0' && u <= '9')) return (char)u;
+    if (u >= 0xC0u) return s_sem_acento[u - 0xC0u];
+    return ' ';
+}
+
+void PesquisaGraos_Construir(void)
+{
+    s_versao_graos = Gerenciador_Config_Get_Versao_Graos();
+    memset(s_bigramas, 0, sizeof(s_bigramas));
+    s_num_graos = Gerenciador_Config_Get_Num_Graos();
+
+    for (uint8_t g = 0; g < s_num_graos; g++)
+    {
+        const char* nome = Gerenciador_Config_Get_Nome_Grao(g);
+        if (nome == NULL) continue;
+
+        char anterior = PesquisaGraos_Normalizar(nome[0]);
+        for (uint8_t i = 1; (i < MAX_NOME_GRAO_LEN) && (nome[i] != '\0'); i++)
+        {
+            char atual = PesquisaGraos_Normalizar(nome[i]);
+            Bitset_Set(&s_bigramas[Hash_Bigrama(anterior, atual)], g);
+            anterior = atual;
+        }
+    }
+
+    s_construido = true;
+    s_termo_anterior[0] = '\0';
+    Bitset_Preencher(&s_resultado, s_num_graos);
+    s_num_resultados = s_num_graos;
+    s_modo = PESQUISA_EXATA;
+    Cursor_Reiniciar();
+}
+
+uint16_t PesquisaGraos_Buscar(const char* termo)
+{
+    char chave[MAX_NOME_GRAO_LEN + 1];
+    uint8_t len = 0;
+
+    Atualizar_Indice();
+
+    if (termo != NULL)
+    {
+        while ((len < MAX_NOME_GRAO_LEN) && (termo[len] != '\0'))
+        {
+            chave[len] = PesquisaGraos_Normalizar(termo[len]);
+            len++;
+        }
+    }
+    chave[len] = '\0';
+
+    // Refinamento: se o termo novo contm o anterior, o resultado novo 
+    // subconjunto do anterior; caso contrrio parte de todos os gros.
+    Bitset_t candidatos;
+    if ((len > 0) && (s_termo_anterior[0] != '\0') && (strstr(chave, s_termo_anterior) != NULL))
+    {
+        candidatos = s_resultado;
+    }
+    else
+    {
+        Bitset_Preencher(&candidatos, s_num_graos);
+    }
+
+    for (uint8_t i = 1; i < len; i++)
+    {
+        const Bitset_t* b = &s_bigramas[Hash_Bigrama(chave[i - 1], chave[i])];
+        for (uint8_t w = 0; w < PESQUISA_PALAVRAS; w++)
+        {
+            candidatos.bits[w] &= b->bits[w];
+        }
+    }
+
+    // Os baldes admitem coliso: confirma cada candidato pela substring
+    if (len > 0)
+    {
+        for (uint8_t g = 0; g < s_num_graos; g++)
+        {
+            if (Bitset_Get(&candidatos, g) && !Nome_Contem(Gerenciador_Config_Get_Nome_Grao(g), chave, len))
+            {
+                candidatos.bits[g >> 5] &= ~(1uL << (g & 31u));
+            }
+        }
+    }
+
+    s_resultado = candidatos;
+    s_num_resultados = Bitset_Contar(&s_resultado);
+    memcpy(s_termo_anterior, chave, (size_t)len + 1u);
+    s_modo = PESQUISA_EXATA;
+    Cursor_Reiniciar();
+    return s_num_resultados;
+}
+
+uint16_t PesquisaGraos_Buscar_Aproximada(const char* termo)
+{
+    uint32_t peq[PESQUISA_CLASSES];
+    uint8_t m = 0;
+
+    Atualizar_Indice();
+
+    memset(peq, 0, sizeof(peq));
+    if (termo != NULL)
+    {
+        while ((m < MAX_NOME_GRAO_LEN) && (termo[m] != '\0'))
+        {
+            peq[Classe(PesquisaGraos_Normalizar(termo[m]))] |= (1uL << m);
+            m++;
+        }
+    }
+    if (m == 0u)
+    {
+        return PesquisaGraos_Buscar(termo);
+    }
+
+    s_distancia_max = (m <= 3u) ? 0u : ((m <= 6u) ? 1u : PESQUISA_MAX_ERROS);
+    s_num_resultados = 0;
+
+    for (uint8_t g = 0; g < s_num_graos; g++)
+    {
+        uint8_t melhor = DISTANCIA_NENHUMA;
+        for (uint8_t idioma = 0; (idioma < PESQUISA_IDIOMAS) && (melhor != 0u); idioma++)
+        {
+            const char* nome = Produto[g].Nome[idioma];
+            if (nome == NULL) continue;
+            uint8_t d = Myers_Distancia(peq, m, nome);
+            if (d < melhor) melhor = d;
+        }
+        s_distancia[g] = (melhor <= s_distancia_max) ? melhor : DISTANCIA_NENHUMA;
+        if (s_distancia[g] != DISTANCIA_NENHUMA)
+        {
+            s_num_resultados++;
+        }
+    }
+
+    // A prxima busca exata no pode refinar a partir deste resultado
+    s_termo_anterior[0] = '\0';
+    s_modo = PESQUISA_APROXIMADA;
+    Cursor_Reiniciar();
+    return s_num_resultados;
+}
+
+PesquisaModo_t PesquisaGraos_Get_Modo(void)
+{
+    return s_modo;
+}
+
+uint16_t PesquisaGraos_Num_Resultados(void)
+{
+    return s_num_resultados;
+}
+
+bool PesquisaGraos_Obter(uint16_t posicao, uint8_t* indice_grao)
+{
+    if ((indice_grao == NULL) || (posicao >= s_num_resultados))
+    {
+        return false;
+    }
+
+    // Acesso sequencial (pgina a pgina) continua de onde parou
+    if (posicao < s_cursor_pos)
+    {
+        Cursor_Reiniciar();
+    }
+
+    // Ordem: distncia crescente (sempre 0 na busca exata), depois ndice
+    uint8_t dist_max = (s_modo == PESQUISA_APROXIMADA) ? s_distancia_max : 0u;
+    uint8_t g = s_cursor_grao;
+    for (uint8_t d = s_cursor_dist; d <= dist_max; d++, g = 0)
+    {
+        for (; g < s_num_graos; g++)
+        {
+            bool pertence = (s_modo == PESQUISA_APROXIMADA) ? (s_distancia[g] == d)
+                                                            : Bitset_Get(&s_resultado, g);
+            if (!pertence) continue;
+            if (s_cursor_pos == posicao)
+            {
+                s_cursor_dist = d;
+                s_cursor_grao = g;
+                *indice_grao = g;
+                return true;
+            }
+            s_cursor_pos++;
+        }
+    }
+    return false;
+}
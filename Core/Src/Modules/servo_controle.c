@@ -1,7 +1,13 @@
 /*******************************************************************************
  * @file        servo_controle.c
- * @brief       Mdulo de alto nvel para controle da sequncia de servos.
- * @version     2.1 (Corrigido para usar TIM16 e TIM17)
+ * @brief       Comando de posio dos servos do funil e do raspador.
+ * @version     3.0 (Perfis de movimento inteiros gerados no tick de 1 ms)
+ * @details     Cada comando de abrir/fechar vira um perfil trapezoidal
+ * (acelera, velocidade constante, desacelera) calculado uma vez, em inteiros,
+ * no momento do comando. O tick de 1 ms (ISR do TIM14) s soma a velocidade
+ *  posio em ponto fixo Q8 (s << 8) e escreve o CCR quando o valor em s
+ * muda. O fim do perfil, mais um tempo de assentamento mecnico, publica
+ * EV_SERVO_MOVIMENTO_FIM.
  ******************************************************************************/
 
 #include "servo_controle.h"
@@ -10,30 +16,40 @@
 #include <stdbool.h>
 #include <stddef.h>
 
-//================================================================================
-// Definies da Mquina de Estados
-//================================================================================
-
-#define ESTADO_OCIOSO 0xFF
-
-typedef void (*Funcao_Acao_t)(void);
-
-typedef struct
-{
-    ServoStep_t id_passo;
-    Funcao_Acao_t acao;
-    uint32_t duracao_ms;
-    uint8_t indice_proximo_estado;
-} Passo_Processo_t;
-
 //================================================================================
 // Variveis de Estado do Mdulo
 //================================================================================
 
-static volatile uint32_t s_timer_funil = 0;
-static volatile uint32_t s_timer_scrap = 0;
-static volatile uint8_t s_indice_estado_atual = ESTADO_OCIOSO;
-static volatile uint32_t s_timer_estado_ms = 0;
+// Limites do perfil, em graus (servo padro ~0,15 s/60 = 400 /s). A
+// acelerao leva  velocidade mxima em 50 ms. Convertidos para s de pulso
+// por servo no Servos_Init (cada um tem sua calibrao min/max).
+#define SERVO_VEL_MAX_GRAUS_S    400u
+#define SERVO_ACEL_GRAUS_S2      8000u
+// Sem realimentao de posio: o eixo segue o pulso com algum atraso
+#define SERVO_ASSENTAMENTO_MS    30u
+
+// Aberturas padro; a receita do produto pode mudar (Servos_Set_Aberturas)
+#define ANGULO_FECHADO      0u
+#define ANGULO_FUNIL_ABRE   75u
+#define ANGULO_SCRAP_ABRE   90u
+
+typedef struct {
+    Servo_t*          servo;
+    int32_t           pos_q8;       // pulso comandado agora (s << 8)
+    int32_t           alvo_q8;
+    int32_t           vel_q8;       // s/ms << 8 (mdulo)
+    int32_t           vmax_q8;
+    int32_t           acel_q8;      // s/ms << 8
+    uint16_t          t_ms;         // tempo decorrido no perfil
+    uint16_t          fim_acel_ms;
+    uint16_t          ini_desacel_ms;
+    uint16_t          total_ms;     // no ltimo tick a posio vai ao alvo
+    uint16_t          assenta_ms;
+    int8_t            sentido;
+    volatile bool     ativo;
+    bool              aberto;
+    uint8_t           ang_abre;
+} EixoServo_t;
 
 // --- CORRIGIDO: Configurao dos Servos para TIM16 e TIM17 ---
 // O linker procura estas variveis, que so definidas em tim.c
@@ -44,99 +60,186 @@ extern TIM_HandleTypeDef htim17;
 static Servo_t s_servo_funil   = {.htim = &htim17, .channel = TIM_CHANNEL_1, .min_pulse_us = 700, .max_pulse_us = 2300};
 static Servo_t s_servo_scrap   = {.htim = &htim16, .channel = TIM_CHANNEL_1, .min_pulse_us = 650, .max_pulse_us = 2400};
 
-
-#define ANGULO_FECHADO      0.0f
-#define ANGULO_FUNIL_ABRE   75.0f
-#define ANGULO_SCRAP_ABRE   90.0f
-
-static void Acao_Abrir_Funil(void);
-static void Acao_Varrer_Scrap(void);
-static void Acao_Finalizar(void);
-
-static const Passo_Processo_t s_fluxo_processo[] =
-{
-    { SERVO_STEP_FUNNEL,   Acao_Abrir_Funil,  2000, 1 },
-    { SERVO_STEP_FUNNEL,   NULL,              500,  2 },
-    { SERVO_STEP_SCRAPER,  Acao_Varrer_Scrap, 2000, 3 },
-    { SERVO_STEP_SCRAPER,  NULL,              500,  4 },
-    { SERVO_STEP_FINISHED, Acao_Finalizar,    1,    ESTADO_OCIOSO },
+// Indexada por ServoId_t
+static EixoServo_t s_eixos[NUM_SERVOS] = {
+    [SERVO_FUNIL] = { .servo = &s_servo_funil },
+    [SERVO_SCRAP] = { .servo = &s_servo_scrap },
 };
-#define NUM_PASSOS_PROCESSO (sizeof(s_fluxo_processo) / sizeof(s_fluxo_processo[0]))
 
-static void Entrar_No_Estado(uint8_t indice_estado);
+static void Comandar(ServoId_t id, bool aberto);
+static void Planejar(EixoServo_t* e, uint16_t alvo_us);
+static void Calcular_Rampas(const EixoServo_t* e, uint32_t dist_q8, uint32_t* n_acel, uint32_t* n_const);
+static uint32_t Raiz_Inteira(uint32_t x);
 
 //================================================================================
 // Implementao
 //================================================================================
 
+/**
+ * @brief Passo dos perfis ativos. S aritmtica inteira; o CCR  escrito
+ *        pelo driver apenas quando o pulso em s muda.
+ */
 void Servos_Tick_ms(void)
 {
-    if (s_timer_estado_ms > 0) s_timer_estado_ms--;
-    if (s_timer_funil > 0) s_timer_funil--;
-    if (s_timer_scrap > 0) s_timer_scrap--;
+    for (uint8_t i = 0; i < NUM_SERVOS; i++) {
+        EixoServo_t* e = &s_eixos[i];
+        if (!e->ativo) continue;
+
+        if (e->t_ms < e->total_ms) {
+            e->t_ms++;
+            if (e->t_ms <= e->fim_acel_ms) {
+                e->vel_q8 += e->acel_q8;
+            } else if (e->t_ms > e->ini_desacel_ms) {
+                e->vel_q8 -= e->acel_q8;
+            }
+
+            if (e->t_ms >= e->total_ms) {
+                e->pos_q8 = e->alvo_q8; // resto menor que um passo de cruzeiro
+                e->vel_q8 = 0;
+            } else {
+                e->pos_q8 += (e->sentido > 0) ? e->vel_q8 : -e->vel_q8;
+            }
+            PWM_Servo_Set_Pulso_us(e->servo, (uint16_t)(e->pos_q8 >> 8));
+        } else if (e->assenta_ms > 0) {
+            e->assenta_ms--;
+        } else {
+            ServoId_t id = (ServoId_t)i;
+            e->ativo = false;
+            Eventos_Post_Payload(EV_SERVO_MOVIMENTO_FIM, &id, sizeof(id));
+        }
+    }
 }
 
 void Servos_Init(void)
 {
-    PWM_Servo_Init(&s_servo_scrap);
-    PWM_Servo_Init(&s_servo_funil);
-    s_indice_estado_atual = ESTADO_OCIOSO;
+    for (uint8_t i = 0; i < NUM_SERVOS; i++) {
+        EixoServo_t* e = &s_eixos[i];
+        uint32_t faixa_us = (uint32_t)(e->servo->max_pulse_us - e->servo->min_pulse_us);
+
+        // graus/s -> s/ms (Q8) e graus/s -> s/ms (Q8); s na inicializao
+        e->vmax_q8 = (int32_t)(((uint64_t)SERVO_VEL_MAX_GRAUS_S * faixa_us * 256u) / (180u * 1000u));
+        e->acel_q8 = (int32_t)(((uint64_t)SERVO_ACEL_GRAUS_S2 * faixa_us * 256u) / (180u * 1000000u));
+        if (e->acel_q8 < 1) e->acel_q8 = 1;
+
+        e->ativo = false;
+        e->aberto = false;
+        e->pos_q8 = (int32_t)PWM_Servo_Graus_Para_Pulso(e->servo, ANGULO_FECHADO) << 8;
+        e->alvo_q8 = e->pos_q8;
+        PWM_Servo_Set_Pulso_us(e->servo, (uint16_t)(e->pos_q8 >> 8));
+        PWM_Servo_Init(e->servo);
+    }
+    s_eixos[SERVO_FUNIL].ang_abre = ANGULO_FUNIL_ABRE;
+    s_eixos[SERVO_SCRAP].ang_abre = ANGULO_SCRAP_ABRE;
 }
 
-void Servos_Process(void)
+void Servos_Set_Funil(bool aberto)
 {
-    uint32_t timer_snapshot;
+    Comandar(SERVO_FUNIL, aberto);
+}
 
-    __disable_irq();
-    timer_snapshot = s_timer_estado_ms;
-    __enable_irq();
+void Servos_Set_Scrap(bool aberto)
+{
+    Comandar(SERVO_SCRAP, aberto);
+}
 
-    if (s_indice_estado_atual != ESTADO_OCIOSO && timer_snapshot == 0)
-    {
-        uint8_t proximo_indice = s_fluxo_processo[s_indice_estado_atual].indice_proximo_estado;
-        Entrar_No_Estado(proximo_indice);
-    }
+void Servos_Set_Aberturas(uint8_t graus_funil, uint8_t graus_scrap)
+{
+    // S vale para o prximo comando: com o servo aberto, o fechamento
+    // parte da abertura em que ele est.
+    if (!s_eixos[SERVO_FUNIL].aberto) s_eixos[SERVO_FUNIL].ang_abre = graus_funil;
+    if (!s_eixos[SERVO_SCRAP].aberto) s_eixos[SERVO_SCRAP].ang_abre = graus_scrap;
+}
 
-    PWM_Servo_SetAngle(&s_servo_funil, (s_timer_funil > 0) ? ANGULO_FUNIL_ABRE : ANGULO_FECHADO);
-    PWM_Servo_SetAngle(&s_servo_scrap, (s_timer_scrap > 0) ? ANGULO_SCRAP_ABRE : ANGULO_FECHADO);
+bool Servos_Em_Movimento(void)
+{
+    return s_eixos[SERVO_FUNIL].ativo || s_eixos[SERVO_SCRAP].ativo;
 }
 
-void Servos_Start_Sequence(void)
+uint32_t Servos_Tempo_Curso_ms(ServoId_t id)
 {
-    if (s_indice_estado_atual == ESTADO_OCIOSO)
-    {
-        Entrar_No_Estado(0);
-    }
+    if (id >= NUM_SERVOS) return 0;
+
+    const EixoServo_t* e = &s_eixos[id];
+    uint32_t aberto_us  = PWM_Servo_Graus_Para_Pulso(e->servo, e->ang_abre);
+    uint32_t fechado_us = PWM_Servo_Graus_Para_Pulso(e->servo, ANGULO_FECHADO);
+    uint32_t n_acel, n_const;
+
+    Calcular_Rampas(e, (aberto_us - fechado_us) << 8, &n_acel, &n_const);
+    return (2u * n_acel) + n_const + 1u + SERVO_ASSENTAMENTO_MS;
 }
 
-static void Entrar_No_Estado(uint8_t indice_estado)
+//================================================================================
+// Funes Privadas
+//================================================================================
+
+static void Comandar(ServoId_t id, bool aberto)
 {
-    if (indice_estado >= NUM_PASSOS_PROCESSO)
-    {
-        s_indice_estado_atual = ESTADO_OCIOSO;
-        return;
-    }
+    EixoServo_t* e = &s_eixos[id];
+    if (aberto == e->aberto) return;
 
-    s_indice_estado_atual = indice_estado;
-    const Passo_Processo_t* passo = &s_fluxo_processo[indice_estado];
+    e->aberto = aberto;
+    Planejar(e, PWM_Servo_Graus_Para_Pulso(e->servo, aberto ? e->ang_abre : ANGULO_FECHADO));
+}
 
-    // Aqui, futuramente, chamaremos uma funo do app_manager para notificar a UI
-    // Ex: App_Manager_On_Servo_Step_Changed(passo->id_passo);
+/**
+ * @brief Degraus de velocidade de um perfil trapezoidal discreto (1 ms).
+ * @details Acelerando, v = k*a (k = 1..n); em cruzeiro, v = n*a por m ticks;
+ * desacelerando, v volta a zero em n ticks. Percorre a*n + m*n*a; o resto
+ * (menor que n*a)  coberto no ltimo tick. Se a distncia no comporta a
+ * velocidade mxima, o perfil vira tringulo (n = raiz(d/a)).
+ */
+static void Calcular_Rampas(const EixoServo_t* e, uint32_t dist_q8, uint32_t* n_acel, uint32_t* n_const)
+{
+    uint32_t a = (uint32_t)e->acel_q8;
+    uint32_t n = (uint32_t)e->vmax_q8 / a;
+    uint32_t n_tri = Raiz_Inteira(dist_q8 / a);
 
-    if (passo->acao != NULL)
-    {
-        passo->acao();
-    }
+    if (n_tri < n) n = n_tri;
+    *n_acel = n;
+    *n_const = (n > 0u) ? (dist_q8 - (a * n * n)) / (a * n) : 0u;
+}
 
-    s_timer_estado_ms = passo->duracao_ms;
+/**
+ * @brief Calcula o perfil a partir da posio comandada atual. Um comando
+ *        no meio de outro movimento recomea do repouso nessa posio.
+ */
+static void Planejar(EixoServo_t* e, uint16_t alvo_us)
+{
+    uint32_t n_acel, n_const;
+
+    __disable_irq(); // o tick pode estar avanando este eixo
+    int32_t alvo_q8 = (int32_t)alvo_us << 8;
+    int32_t delta = alvo_q8 - e->pos_q8;
+    uint32_t dist_q8 = (uint32_t)((delta < 0) ? -delta : delta);
+
+    Calcular_Rampas(e, dist_q8, &n_acel, &n_const);
+    e->alvo_q8 = alvo_q8;
+    e->sentido = (delta < 0) ? -1 : 1;
+    e->vel_q8 = 0;
+    e->t_ms = 0;
+    e->fim_acel_ms = (uint16_t)n_acel;
+    e->ini_desacel_ms = (uint16_t)(n_acel + n_const);
+    e->total_ms = (uint16_t)((2u * n_acel) + n_const);
+    if (e->total_ms == 0u) e->total_ms = 1u;
+    e->assenta_ms = SERVO_ASSENTAMENTO_MS;
+    e->ativo = true;
+    __enable_irq();
+}
 
-    if (passo->id_passo == SERVO_STEP_FINISHED)
-    {
-       // Aqui, futuramente, chamaremos uma funo do app_manager para notificar o fim
-       // Ex: App_Manager_On_Servo_Sequence_Finished();
+static uint32_t Raiz_Inteira(uint32_t x)
+{
+    uint32_t r = 0;
+    uint32_t bit = 1uL << 30;
+
+    while (bit > x) bit >>= 2;
+    while (bit != 0u) {
+        if (x >= r + bit) {
+            x -= r + bit;
+            r = (r >> 1) + bit;
+        } else {
+            r >>= 1;
+        }
+        bit >>= 2;
     }
+    return r;
 }
-
-static void Acao_Abrir_Funil(void) { s_timer_funil = 2000; }
-static void Acao_Varrer_Scrap(void) { s_timer_scrap = 2000; }
-static void Acao_Finalizar(void) {}
\ No newline at end of file
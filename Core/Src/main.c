@@ -29,6 +29,7 @@
 #include "gpio.h"
 #include "app_manager.h"
 #include "retarget.h"
+#include "memoria.h"
 #include <stdio.h>
 
 /* Private includes ----------------------------------------------------------*/
@@ -76,7 +77,7 @@ int main(void)
 {
 
   /* USER CODE BEGIN 1 */
-
+  Memoria_Pintar_Stack(); // antes de qualquer init, para a marca d'agua cobrir o boot
   /* USER CODE END 1 */
 
   /* MCU Configuration--------------------------------------------------------*/
@@ -24,6 +24,8 @@
 #include "cli_driver.h"
 #include "servo_controle.h"
 #include "ads1232_driver.h"
+#include "app_eventos.h"
+#include "app_manager.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 /* USER CODE END Includes */
@@ -59,6 +61,7 @@
 /* USER CODE END 0 */
 
 /* External variables --------------------------------------------------------*/
+extern DMA_HandleTypeDef hdma_adc1;
 extern TIM_HandleTypeDef htim14;
 extern DMA_HandleTypeDef hdma_usart1_tx;
 extern DMA_HandleTypeDef hdma_usart1_rx;
@@ -156,12 +159,12 @@ void SysTick_Handler(void)
 void EXTI4_15_IRQHandler(void)
 {
   /* USER CODE BEGIN EXTI4_15_IRQn 0 */
-
+  PERFIL_ISR_ENTRADA(PERFIL_ISR_EXTI);
   /* USER CODE END EXTI4_15_IRQn 0 */
   HAL_GPIO_EXTI_IRQHandler(AD_DOUT_BAL_Pin);
   HAL_GPIO_EXTI_IRQHandler(SINAL_DISPLAY_Pin);
   /* USER CODE BEGIN EXTI4_15_IRQn 1 */
-
+  PERFIL_ISR_SAIDA(PERFIL_ISR_EXTI);
   /* USER CODE END EXTI4_15_IRQn 1 */
 }
 
@@ -203,6 +206,7 @@ void DMAMUX1_DMA1_CH4_5_IRQHandler(void)
 
   /* USER CODE END DMAMUX1_DMA1_CH4_5_IRQn 0 */
   HAL_DMA_IRQHandler(&hdma_usart2_tx);
+  HAL_DMA_IRQHandler(&hdma_adc1);
   /* USER CODE BEGIN DMAMUX1_DMA1_CH4_5_IRQn 1 */
 
   /* USER CODE END DMAMUX1_DMA1_CH4_5_IRQn 1 */
@@ -214,11 +218,11 @@ void DMAMUX1_DMA1_CH4_5_IRQHandler(void)
 void TIM14_IRQHandler(void)
 {
   /* USER CODE BEGIN TIM14_IRQn 0 */
-
+  PERFIL_ISR_ENTRADA(PERFIL_ISR_TIM14);
   /* USER CODE END TIM14_IRQn 0 */
   HAL_TIM_IRQHandler(&htim14);
   /* USER CODE BEGIN TIM14_IRQn 1 */
-
+  PERFIL_ISR_SAIDA(PERFIL_ISR_TIM14);
   /* USER CODE END TIM14_IRQn 1 */
 }
 
@@ -228,11 +232,11 @@ void TIM14_IRQHandler(void)
 void USART1_IRQHandler(void)
 {
   /* USER CODE BEGIN USART1_IRQn 0 */
-
+  PERFIL_ISR_ENTRADA(PERFIL_ISR_USART1);
   /* USER CODE END USART1_IRQn 0 */
   HAL_UART_IRQHandler(&huart1);
   /* USER CODE BEGIN USART1_IRQn 1 */
-
+  PERFIL_ISR_SAIDA(PERFIL_ISR_USART1);
   /* USER CODE END USART1_IRQn 1 */
 }
 
@@ -242,11 +246,11 @@ void USART1_IRQHandler(void)
 void USART2_IRQHandler(void)
 {
   /* USER CODE BEGIN USART2_IRQn 0 */
-
+  PERFIL_ISR_ENTRADA(PERFIL_ISR_USART2);
   /* USER CODE END USART2_IRQn 0 */
   HAL_UART_IRQHandler(&huart2);
   /* USER CODE BEGIN USART2_IRQn 1 */
-
+  PERFIL_ISR_SAIDA(PERFIL_ISR_USART2);
   /* USER CODE END USART2_IRQn 1 */
 }
 
@@ -259,7 +263,9 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
 
     // Esta  a nossa substituio de 1ms para a tarefa do superloop.
     // Agora ela roda em alta prioridade de hardware, de forma determinstica.
+    Frequency_Tick_ms(); // primeiro: a captura da janela no deve variar
     Servos_Tick_ms(); 
+    Agendador_Tick_ms();
 
   }
 }
@@ -269,34 +275,31 @@ void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
     if (huart->Instance == USART1) // CLI (UART1)
     {
         CLI_HandleTxCplt(huart); // (Avisa ao driver CLI que o DMA TX est livre)
+        Agendador_Sinalizar(TAREFA_CLI_TX);
     }
     else if (huart->Instance == USART2) // DWIN (UART2)
     {
         DWIN_Driver_HandleTxCplt(huart); // (Avisa ao driver DWIN que o DMA TX est livre)
+        Agendador_Sinalizar(TAREFA_DWIN_TX);
     }
 }
 
 /**
-  * @brief  Callback de Recepo UART (RX Complete) - Apenas para CLI (1 byte IT)
-  */
-void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
-{
-    if (huart->Instance == USART1) // CLI (UART1)
-    {
-        CLI_HandleRxCplt(huart); // (Processa 1 byte de RX do CLI e rearma o IT)
-    }
-}
-
-
-/**
-  * @brief  Callback de Evento de Recepo UART (RX Event) - Apenas para DWIN (Idle Line + DMA)
-  * Chamado quando o DMA termina de receber OU a linha fica ociosa.
+  * @brief  Callback de Evento de Recepo UART (RX Event) - DWIN e CLI (Idle Line + DMA)
+  * Chamado quando o DMA termina de receber OU a linha fica ociosa
+  * (no CLI, com DMA circular, tambm na meia-transferncia).
   */
 void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
 {
     if (huart->Instance == USART2) // DWIN (UART2)
     {
         DWIN_Driver_HandleRxEvent(huart, Size); // (Handler V6.0 / V8.0)
+        Agendador_Sinalizar(TAREFA_DWIN_RX);
+    }
+    else if (huart->Instance == USART1) // CLI (UART1)
+    {
+        CLI_HandleRxEvent(huart, Size); // (S publica a posio do DMA circular)
+        Agendador_Sinalizar(TAREFA_CLI_RX);
     }
 }
 
@@ -308,10 +311,12 @@ void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
     if (huart->Instance == USART1) // CLI
     {
         CLI_HandleError(huart); // Delega o tratamento de erro ao driver
+        Agendador_Sinalizar(TAREFA_CLI_RX); // a recepo  reiniciada na tarefa
     }
     else if (huart->Instance == USART2) // DWIN
     {
         DWIN_Driver_HandleError(huart); // Delega o tratamento de erro ao driver
+        Agendador_Sinalizar(TAREFA_DWIN_RX);
     }
 }
 
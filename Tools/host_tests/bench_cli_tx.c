@@ -0,0 +1,288 @@
+/*******************************************************************************
+ * @file        bench_cli_tx.c
+ * @brief       Vazao do TX do console: caminho atual x caminho anterior.
+ * @details     O caminho atual e o cli_driver.c real (acumulador de linha +
+ * anel SPSC, sem mascarar IRQs). O anterior e reproduzido aqui como era:
+ * FIFO de byte em byte com HAL_NVIC_DisableIRQ/EnableIRQ de USART1 e DMA a
+ * cada caractere e no pump. No PC o NVIC e um registrador volatil com a
+ * barreira do HAL (DSB/ISB), entao os numeros comparam custo de software,
+ * nao ciclos do Cortex-M0+. O DMA conclui na hora (o gargalo do fio fica de
+ * fora) e os dois caminhos tem que entregar exatamente os mesmos bytes.
+ ******************************************************************************/
+
+#include "host_teste.h"
+#include "cli_driver.h"
+#include <string.h>
+
+#define SAIDA_MAX      (1u << 20)
+#define REPETICOES     200
+
+//==============================================================================
+// Destino do DMA: guarda a saida e conclui a transferencia
+//==============================================================================
+
+static uint8_t  s_saida[SAIDA_MAX];
+static uint32_t s_saida_len = 0;
+static bool     s_dma_antigo = false;
+
+static void Antigo_TxCplt(void);
+
+static void Uart_Destino(UART_HandleTypeDef* huart, const uint8_t* data, uint16_t len)
+{
+    if (s_saida_len + len <= SAIDA_MAX) {
+        memcpy(&s_saida[s_saida_len], data, len);
+    }
+    s_saida_len += len;
+    if (s_dma_antigo) {
+        Antigo_TxCplt();
+    } else {
+        CLI_HandleTxCplt(huart);
+    }
+}
+
+//==============================================================================
+// Caminho anterior (cli_driver.c antes do anel SPSC), so a parte de TX
+//==============================================================================
+
+#define ANT_TX_FIFO_SIZE        1024
+#define ANT_TX_DMA_BUFFER_SIZE  64
+
+static volatile uint32_t s_nvic_icer;
+static volatile uint32_t s_nvic_iser;
+
+static __attribute__((noinline)) void Nvic_Desabilitar(IRQn_Type irq)
+{
+    s_nvic_icer = 1u << ((uint32_t)irq & 31u);
+    __DSB();
+    __ISB();
+}
+
+static __attribute__((noinline)) void Nvic_Habilitar(IRQn_Type irq)
+{
+    __asm__ volatile ("" ::: "memory");
+    s_nvic_iser = 1u << ((uint32_t)irq & 31u);
+    __asm__ volatile ("" ::: "memory");
+}
+
+static uint8_t s_ant_fifo[ANT_TX_FIFO_SIZE];
+static volatile uint16_t s_ant_head = 0;
+static volatile uint16_t s_ant_tail = 0;
+static uint8_t s_ant_dma[ANT_TX_DMA_BUFFER_SIZE];
+static volatile bool s_ant_busy = false;
+
+static void Antigo_TxCplt(void)
+{
+    s_ant_busy = false;
+}
+
+static void Antigo_Printf_Transmit(uint8_t ch)
+{
+    Nvic_Desabilitar(USART1_IRQn);
+    Nvic_Desabilitar(DMA1_Channel1_IRQn);
+
+    if (ch == '\n') {
+        uint16_t next_head = (s_ant_head + 1) % ANT_TX_FIFO_SIZE;
+        if (next_head != s_ant_tail) {
+            s_ant_fifo[s_ant_head] = '\r';
+            s_ant_head = next_head;
+        }
+    }
+
+    uint16_t next_head = (s_ant_head + 1) % ANT_TX_FIFO_SIZE;
+    if (next_head != s_ant_tail) {
+        s_ant_fifo[s_ant_head] = ch;
+        s_ant_head = next_head;
+    }
+
+    Nvic_Habilitar(USART1_IRQn);
+    Nvic_Habilitar(DMA1_Channel1_IRQn);
+}
+
+static void Antigo_TX_Pump(void)
+{
+    if (s_ant_busy || (s_ant_head == s_ant_tail)) {
+        return;
+    }
+
+    Nvic_Desabilitar(USART1_IRQn);
+    Nvic_Desabilitar(DMA1_Channel1_IRQn);
+
+    if (s_ant_busy) {
+        Nvic_Habilitar(USART1_IRQn);
+        Nvic_Habilitar(DMA1_Channel1_IRQn);
+        return;
+    }
+    s_ant_busy = true;
+
+    uint16_t bytes_to_send = 0;
+    while ((s_ant_tail != s_ant_head) && (bytes_to_send < ANT_TX_DMA_BUFFER_SIZE)) {
+        s_ant_dma[bytes_to_send++] = s_ant_fifo[s_ant_tail];
+        s_ant_tail = (s_ant_tail + 1) % ANT_TX_FIFO_SIZE;
+    }
+
+    Nvic_Habilitar(USART1_IRQn);
+    Nvic_Habilitar(DMA1_Channel1_IRQn);
+
+    if (bytes_to_send > 0 && HAL_UART_Transmit_DMA(NULL, s_ant_dma, bytes_to_send) != HAL_OK) {
+        s_ant_busy = false;
+    }
+}
+
+static bool Antigo_TX_Ocioso(void)
+{
+    return !s_ant_busy && (s_ant_head == s_ant_tail);
+}
+
+//==============================================================================
+// Carga: linhas tipicas do console (texto de printf, '\n' no fim)
+//==============================================================================
+
+static char s_texto[16384];
+static uint32_t s_texto_len = 0;
+static uint32_t s_texto_linhas = 0;
+
+static void Montar_Texto(void)
+{
+    s_texto_len = 0;
+    for (uint32_t i = 0; s_texto_len < sizeof(s_texto) - 128u; i++) {
+        int n;
+        switch (i % 4u) {
+            case 0: n = snprintf(&s_texto[s_texto_len], 128, "Peso: %.2f g | Freq: %lu Hz\n",
+                                 (double)i * 0.37, (unsigned long)(5000u + i)); break;
+            case 1: n = snprintf(&s_texto[s_texto_len], 128, "Escala A: %.3f | Temp: %.1f C\n",
+                                 (double)i / 7.0, 20.0 + (double)(i % 50u) / 10.0); break;
+            case 2: n = snprintf(&s_texto[s_texto_len], 128, "OK\n"); break;
+            default: n = snprintf(&s_texto[s_texto_len], 128,
+                                  "Tarefa %lu: exec=%lu lat_max=%lu us prazos=%lu\n",
+                                  (unsigned long)(i % 12u), (unsigned long)(i * 3u),
+                                  (unsigned long)(i % 997u), 0ul); break;
+        }
+        s_texto_len += (uint32_t)n;
+        s_texto_linhas++;
+    }
+}
+
+//==============================================================================
+// Medicao
+//==============================================================================
+
+typedef struct {
+    uint64_t ns;
+    uint64_t ciclos;
+    uint32_t bytes;    // bytes entregues ao DMA
+} Medida_t;
+
+/**
+ * @brief Superloop simplificado: cada byte pelo caminho do printf (fputc) e um
+ *        pump por linha, como a tarefa de TX faria entre duas linhas.
+ */
+static Medida_t Rodar_Printf(bool antigo)
+{
+    s_dma_antigo = antigo;
+    s_saida_len = 0;
+
+    uint64_t t0 = Host_Tempo_ns();
+    uint64_t c0 = Host_Ciclos();
+    for (int r = 0; r < REPETICOES; r++) {
+        for (uint32_t i = 0; i < s_texto_len; i++) {
+            uint8_t ch = (uint8_t)s_texto[i];
+            if (antigo) {
+                Antigo_Printf_Transmit(ch);
+                if (ch == '\n') {
+                    while (!Antigo_TX_Ocioso()) Antigo_TX_Pump();
+                }
+            } else {
+                CLI_Printf_Transmit(ch);
+                if (ch == '\n') {
+                    while (CLI_Driver_IsTxBusy()) CLI_TX_Pump();
+                }
+            }
+        }
+    }
+    uint64_t c1 = Host_Ciclos();
+    uint64_t t1 = Host_Tempo_ns();
+
+    return (Medida_t){ t1 - t0, c1 - c0, (uint32_t)(s_texto_len * (uint32_t)REPETICOES) };
+}
+
+/**
+ * @brief Bloco pronto (ex.: HELP): CLI_Write atual x byte a byte no anterior.
+ */
+static Medida_t Rodar_Bloco(bool antigo)
+{
+    static const char bloco[] =
+        "| HELP ou ?                | Mostra esta ajuda.                            |\r\n"
+        "| WHO_AM_I                 | Exibe especificacoes do sistema.              |\r\n"
+        "| TIME HH:MM:SS            | Define a hora do sistema.                     |\r\n"
+        "| DATE DD/MM/AA            | Define a data do sistema.                     |\r\n";
+    const uint32_t len = sizeof(bloco) - 1u;
+    const uint32_t vezes = REPETICOES * 40u;
+
+    s_dma_antigo = antigo;
+    s_saida_len = 0;
+
+    uint64_t t0 = Host_Tempo_ns();
+    uint64_t c0 = Host_Ciclos();
+    for (uint32_t r = 0; r < vezes; r++) {
+        if (antigo) {
+            for (uint32_t i = 0; i < len; i++) Antigo_Printf_Transmit((uint8_t)bloco[i]);
+            while (!Antigo_TX_Ocioso()) Antigo_TX_Pump();
+        } else {
+            CLI_Write((const uint8_t*)bloco, (uint16_t)len);
+            while (CLI_Driver_IsTxBusy()) CLI_TX_Pump();
+        }
+    }
+    uint64_t c1 = Host_Ciclos();
+    uint64_t t1 = Host_Tempo_ns();
+
+    if (!antigo) {
+        // O caminho anterior expandia tambem o '\n' de "\r\n" ("\r\r\n")
+        VERIFICAR_IGUAL(s_saida_len, (uint64_t)len * vezes);
+    }
+    return (Medida_t){ t1 - t0, c1 - c0, len * vezes };
+}
+
+static void Imprimir(const char* nome, Medida_t m)
+{
+    double seg = (double)m.ns / 1e9;
+    printf("  %-28s %8.1f MB/s  %6.2f ciclos/byte\n", nome,
+           ((double)m.bytes / seg) / 1e6, (double)m.ciclos / (double)m.bytes);
+}
+
+int main(void)
+{
+    static uint8_t referencia[sizeof(s_texto) * 2];
+    Host_Uart_Set_Tx(Uart_Destino);
+    Montar_Texto();
+
+    // Mesma saida nos dois caminhos ('\n' -> "\r\n"); aquece caches
+    Medida_t novo = Rodar_Printf(false);
+    uint32_t ref_len = s_saida_len / REPETICOES;
+    memcpy(referencia, s_saida, ref_len);
+    Medida_t antigo = Rodar_Printf(true);
+    VERIFICAR_IGUAL(s_saida_len, novo.bytes + (s_texto_linhas * REPETICOES));
+    VERIFICAR(memcmp(referencia, s_saida, ref_len) == 0);
+    VERIFICAR_IGUAL(ref_len, s_texto_len + s_texto_linhas);
+    VERIFICAR_IGUAL(s_saida_len, (uint64_t)ref_len * REPETICOES);
+
+    novo = Rodar_Printf(false);
+    antigo = Rodar_Printf(true);
+    Medida_t bloco_novo = Rodar_Bloco(false);
+    Medida_t bloco_antigo = Rodar_Bloco(true);
+
+    CliTxStats_t stats;
+    CLI_Get_Tx_Stats(&stats);
+    VERIFICAR_IGUAL(stats.bytes_descartados, 0);
+
+    printf("bench_cli_tx: %lu linhas, %lu bytes por repeticao\n",
+           (unsigned long)s_texto_linhas, (unsigned long)s_texto_len);
+    Imprimir("printf atual (linha)", novo);
+    Imprimir("printf anterior (byte+NVIC)", antigo);
+    Imprimir("bloco CLI_Write", bloco_novo);
+    Imprimir("bloco anterior (byte+NVIC)", bloco_antigo);
+    printf("  ganho printf: %.1fx  bloco: %.1fx\n",
+           (double)antigo.ciclos / (double)novo.ciclos,
+           (double)bloco_antigo.ciclos / (double)bloco_novo.ciclos);
+
+    return Host_Teste_Resultado("cli_tx: mesma saida do caminho anterior");
+}
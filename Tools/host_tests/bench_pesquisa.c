@@ -0,0 +1,419 @@
+/*******************************************************************************
+ * @file        bench_pesquisa.c
+ * @brief       Pesquisa de graos: indice de bigramas x varredura anterior.
+ * @details     O catalogo e a tabela Produto[] real (GXXX_Equacoes.c), com os
+ * nomes copiados para o cache como na configuracao de fabrica. O caminho
+ * atual e o pesquisa_graos.c real; o anterior e reproduzido aqui como era
+ * em graos_handler.c: copia de cada Config_Grao_t, stristr e no maximo 30
+ * resultados. Cada termo e digitado caractere a caractere, como no teclado
+ * do display, e cada tecla extrai a primeira pagina (10 resultados).
+ * A busca aproximada (Myers) e conferida contra a distancia de edicao por
+ * programacao dinamica e medida contra a exata, sozinha e no fluxo do
+ * graos_handler.c (exata primeiro, aproximada so sem resultado).
+ ******************************************************************************/
+
+#include "host_teste.h"
+#include "pesquisa_graos.h"
+#include "gerenciador_configuracoes.h"
+#include "GXXX_Equacoes.h"
+#include <ctype.h>
+#include <string.h>
+
+#define REPETICOES               2000
+#define MAX_RESULTADOS_PESQUISA  30
+#define MAX_RESULTADOS_POR_PAGINA 10
+
+//==============================================================================
+// Cache de configuracao falso (nomes de fabrica)
+//==============================================================================
+
+static Config_Grao_t s_graos[MAX_GRAOS];
+static uint32_t s_versao = 1;
+
+uint32_t Gerenciador_Config_Get_Versao_Graos(void) { return s_versao; }
+uint8_t Gerenciador_Config_Get_Num_Graos(void) { return MAX_GRAOS; }
+
+const char* Gerenciador_Config_Get_Nome_Grao(uint8_t indice)
+{
+    return (indice < MAX_GRAOS) ? s_graos[indice].nome : NULL;
+}
+
+static void Carregar_Catalogo(void)
+{
+    memset(s_graos, 0, sizeof(s_graos));
+    for (uint8_t i = 0; i < MAX_GRAOS; i++) {
+        strncpy(s_graos[i].nome, Produto[i].Nome[0], MAX_NOME_GRAO_LEN);
+        s_graos[i].nome[MAX_NOME_GRAO_LEN] = '\0';
+        s_graos[i].id_curva = Produto[i].Nr_Equa;
+    }
+}
+
+//==============================================================================
+// Caminho anterior (graos_handler.c antes do indice)
+//==============================================================================
+
+static int16_t s_ant_resultados[MAX_RESULTADOS_PESQUISA];
+static uint8_t s_ant_num = 0;
+
+static bool Antigo_Get_Dados_Grao(uint8_t indice, Config_Grao_t* dados_grao)
+{
+    if (indice >= MAX_GRAOS || dados_grao == NULL) return false;
+    memcpy(dados_grao, &s_graos[indice], sizeof(Config_Grao_t));
+    return true;
+}
+
+static char* stristr(const char* str1, const char* str2) {
+    const char *p1 = str1, *p2 = str2, *r = *p2 == 0 ? str1 : 0;
+    while (*p1 != 0 && *p2 != 0) {
+        if (tolower((unsigned char)*p1) == tolower((unsigned char)*p2)) {
+            if (r == 0) r = p1;
+            p2++;
+        } else {
+            p2 = str2;
+            if (r != 0) p1 = r + 1;
+            if (tolower((unsigned char)*p1) == tolower((unsigned char)*p2)) {
+                r = p1; p2++;
+            } else {
+                r = 0;
+            }
+        }
+        p1++;
+    }
+    return *p2 == 0 ? (char*)r : 0;
+}
+
+static __attribute__((noinline)) void Antigo_Executar_Pesquisa(const char* termo_pesquisa)
+{
+    s_ant_num = 0;
+    uint8_t total_de_graos = Gerenciador_Config_Get_Num_Graos();
+
+    if (termo_pesquisa == NULL || strlen(termo_pesquisa) == 0) {
+        for (int i = 0; i < total_de_graos && s_ant_num < MAX_RESULTADOS_PESQUISA; i++) {
+            s_ant_resultados[s_ant_num++] = i;
+        }
+    } else {
+        for (int i = 0; i < total_de_graos; i++) {
+            Config_Grao_t dados_grao;
+            if (Antigo_Get_Dados_Grao(i, &dados_grao)) {
+                if (stristr(dados_grao.nome, termo_pesquisa) != NULL) {
+                    if (s_ant_num < MAX_RESULTADOS_PESQUISA) {
+                        s_ant_resultados[s_ant_num++] = i;
+                    }
+                }
+            }
+        }
+    }
+}
+
+//==============================================================================
+// Carga: termos digitados no teclado do display
+//==============================================================================
+
+static const char* const s_termos[] = {
+    "soja", "milho", "Arroz", "trigo", "feijao", "amendoim", "cafe",
+    "sorgo", "cevada", "aveia", "girassol", "canola", "Milho Pipoca",
+    "arroz parb", "feijao carioca", "quinoa vermelha",
+};
+#define NUM_TERMOS (sizeof(s_termos) / sizeof(s_termos[0]))
+
+// Erros de digitacao e nomes em outro idioma: a exata nao encontra nada
+typedef struct {
+    const char* termo;
+    const char* grao;    // nome (Produto[].Nome[0]) que tem que estar na 1a pagina
+} TermoErrado_t;
+
+static const TermoErrado_t s_errados[] = {
+    { "sojs",         "Soja            " },
+    { "mlho",         "Milho           " },
+    { "feijap",       "Feijao Anao     " },
+    { "amendoin",     "Amendoim        " },
+    { "trigi",        "Trigo           " },
+    { "girasol",      "Girassol        " },
+    { "cevda",        "Cevada          " },
+    { "Wheat",        "Trigo           " },
+    { "Sunflower",    "Girassol        " },
+    { "feijao carica","Feijao Carioca  " },
+};
+#define NUM_ERRADOS (sizeof(s_errados) / sizeof(s_errados[0]))
+
+typedef enum {
+    BUSCA_ANTERIOR = 0,   // stristr + copia
+    BUSCA_EXATA,          // indice de bigramas
+    BUSCA_APROXIMADA,     // Myers em todos os nomes, a cada tecla
+    BUSCA_HANDLER         // exata; aproximada so sem resultado (graos_handler.c)
+} Busca_t;
+
+typedef struct {
+    uint64_t ns;
+    uint64_t ciclos;
+    uint32_t teclas;
+} Medida_t;
+
+static uint8_t s_pagina[MAX_RESULTADOS_POR_PAGINA];
+static volatile uint8_t s_dreno;
+
+/**
+ * @brief Primeira pagina do resultado atual do indice.
+ */
+static uint8_t Extrair_Pagina(uint16_t n)
+{
+    uint8_t na_pagina = 0;
+    while ((na_pagina < MAX_RESULTADOS_POR_PAGINA) && (na_pagina < n)) {
+        PesquisaGraos_Obter(na_pagina, &s_pagina[na_pagina]);
+        na_pagina++;
+    }
+    return na_pagina;
+}
+
+/**
+ * @brief Uma tecla: consulta e primeira pagina.
+ */
+static uint8_t Tecla(Busca_t busca, const char* termo)
+{
+    uint16_t n;
+    switch (busca) {
+        case BUSCA_ANTERIOR:
+            Antigo_Executar_Pesquisa(termo);
+            return s_ant_num;
+        case BUSCA_EXATA:
+            n = PesquisaGraos_Buscar(termo);
+            break;
+        case BUSCA_APROXIMADA:
+            n = PesquisaGraos_Buscar_Aproximada(termo);
+            break;
+        default:
+            n = PesquisaGraos_Buscar(termo);
+            if ((termo[0] != '\0') && (n == 0u)) {
+                n = PesquisaGraos_Buscar_Aproximada(termo);
+            }
+            break;
+    }
+    return Extrair_Pagina(n);
+}
+
+static Medida_t Rodar(Busca_t busca, const char* const* termos, uint32_t num_termos)
+{
+    char termo[MAX_NOME_GRAO_LEN + 1];
+    uint32_t teclas = 0;
+
+    uint64_t t0 = Host_Tempo_ns();
+    uint64_t c0 = Host_Ciclos();
+    for (int r = 0; r < REPETICOES; r++) {
+        for (uint32_t t = 0; t < num_termos; t++) {
+            size_t len = strlen(termos[t]);
+            for (size_t k = 1; k <= len; k++) {
+                memcpy(termo, termos[t], k);
+                termo[k] = '\0';
+                s_dreno = Tecla(busca, termo);
+                teclas++;
+            }
+            // Apagar o campo volta para a lista completa
+            Tecla(busca, "");
+        }
+    }
+    uint64_t c1 = Host_Ciclos();
+    uint64_t t1 = Host_Tempo_ns();
+
+    return (Medida_t){ t1 - t0, c1 - c0, teclas };
+}
+
+//==============================================================================
+// Verificacao: mesmos graos, na mesma ordem, que o caminho anterior
+//==============================================================================
+
+static void Verificar_Equivalencia(void)
+{
+    char termo[MAX_NOME_GRAO_LEN + 1];
+
+    for (uint32_t t = 0; t < NUM_TERMOS; t++) {
+        size_t len = strlen(s_termos[t]);
+        for (size_t k = 0; k <= len; k++) {
+            memcpy(termo, s_termos[t], k);
+            termo[k] = '\0';
+
+            Antigo_Executar_Pesquisa(termo);
+            uint16_t n = PesquisaGraos_Buscar(termo);
+            // O anterior cortava em 30; o indice nao tem limite
+            VERIFICAR_IGUAL(s_ant_num, (n < MAX_RESULTADOS_PESQUISA) ? n : MAX_RESULTADOS_PESQUISA);
+            for (uint8_t i = 0; i < s_ant_num; i++) {
+                uint8_t g = 0xFFu;
+                VERIFICAR(PesquisaGraos_Obter(i, &g));
+                if (g != (uint8_t)s_ant_resultados[i]) {
+                    fprintf(stderr, "  termo '%s', posicao %u\n", termo, i);
+                    VERIFICAR_IGUAL(g, s_ant_resultados[i]);
+                    break;
+                }
+            }
+        }
+    }
+
+    // Diferencas intencionais: acento e pontuacao sao normalizados
+    // ("FEIJ\xC3O" = "feijao"; "Sem. Cebola" contem "sem "), o stristr nao
+    uint16_t sem_acento = PesquisaGraos_Buscar("feijao");
+    VERIFICAR(sem_acento > 0u);
+    VERIFICAR_IGUAL(PesquisaGraos_Buscar("FEIJ\xC3O"), sem_acento);
+    Antigo_Executar_Pesquisa("FEIJ\xC3O");
+    VERIFICAR_IGUAL(s_ant_num, 0);
+    VERIFICAR(PesquisaGraos_Buscar("sem ") > 0u);
+    Antigo_Executar_Pesquisa("sem ");
+    VERIFICAR_IGUAL(s_ant_num, 0);
+}
+
+//==============================================================================
+// Verificacao da busca aproximada
+//==============================================================================
+
+/**
+ * @brief Referencia: menor distancia de edicao entre o termo e qualquer
+ *        trecho do nome, por programacao dinamica (mesma normalizacao e o
+ *        mesmo limite de 24 caracteres de nome do modulo).
+ */
+static uint8_t Distancia_Referencia(const char* termo, const char* nome)
+{
+    uint8_t anterior[MAX_NOME_GRAO_LEN + 1];
+    uint8_t atual[MAX_NOME_GRAO_LEN + 1];
+    uint8_t m = (uint8_t)strlen(termo);
+    if (m > MAX_NOME_GRAO_LEN) m = MAX_NOME_GRAO_LEN;
+
+    for (uint8_t i = 0; i <= m; i++) anterior[i] = i;
+    uint8_t melhor = anterior[m];
+
+    for (uint8_t j = 0; (j < 24u) && (nome[j] != '\0'); j++) {
+        char c = PesquisaGraos_Normalizar(nome[j]);
+        atual[0] = 0; // o trecho pode comecar em qualquer posicao do nome
+        for (uint8_t i = 1; i <= m; i++) {
+            uint8_t custo = (PesquisaGraos_Normalizar(termo[i - 1]) == c) ? 0u : 1u;
+            uint8_t d = anterior[i - 1] + custo;
+            if (anterior[i] + 1u < d) d = anterior[i] + 1u;
+            if (atual[i - 1] + 1u < d) d = atual[i - 1] + 1u;
+            atual[i] = d;
+        }
+        if (atual[m] < melhor) melhor = atual[m];
+        memcpy(anterior, atual, sizeof(anterior));
+    }
+    return melhor;
+}
+
+/**
+ * @brief Resultado da aproximada = graos com distancia (menor entre os seis
+ *        idiomas) dentro do limite, em ordem de (distancia, indice).
+ */
+static void Verificar_Aproximada(const char* termo)
+{
+    uint8_t dist[MAX_GRAOS];
+    uint8_t m = (uint8_t)strlen(termo);
+    uint8_t limite = (m <= 3u) ? 0u : ((m <= 6u) ? 1u : PESQUISA_MAX_ERROS);
+    uint16_t esperados = 0;
+
+    for (uint8_t g = 0; g < MAX_GRAOS; g++) {
+        dist[g] = 0xFFu;
+        for (uint8_t idioma = 0; idioma < PESQUISA_IDIOMAS; idioma++) {
+            uint8_t d = Distancia_Referencia(termo, Produto[g].Nome[idioma]);
+            if (d < dist[g]) dist[g] = d;
+        }
+        if (dist[g] <= limite) esperados++;
+    }
+
+    uint16_t n = PesquisaGraos_Buscar_Aproximada(termo);
+    VERIFICAR(PesquisaGraos_Get_Modo() == PESQUISA_APROXIMADA);
+    VERIFICAR_IGUAL(n, esperados);
+
+    uint16_t pos = 0;
+    for (uint8_t d = 0; d <= limite; d++) {
+        for (uint8_t g = 0; g < MAX_GRAOS; g++) {
+            if (dist[g] != d) continue;
+            uint8_t obtido = 0xFFu;
+            VERIFICAR(PesquisaGraos_Obter(pos, &obtido));
+            if (obtido != g) {
+                fprintf(stderr, "  termo '%s', posicao %u\n", termo, pos);
+                VERIFICAR_IGUAL(obtido, g);
+                return;
+            }
+            pos++;
+        }
+    }
+}
+
+/**
+ * @brief Todos os prefixos dos termos confere com a referencia; no fluxo do
+ *        handler o grao procurado aparece na primeira pagina.
+ */
+static uint8_t Verificar_Termos_Errados(void)
+{
+    char termo[MAX_NOME_GRAO_LEN + 1];
+    uint8_t na_primeira_pagina = 0;
+
+    for (uint32_t t = 0; t < NUM_TERMOS; t++) {
+        Verificar_Aproximada(s_termos[t]);
+    }
+    for (uint32_t t = 0; t < NUM_ERRADOS; t++) {
+        size_t len = strlen(s_errados[t].termo);
+        for (size_t k = 1; k <= len; k++) {
+            memcpy(termo, s_errados[t].termo, k);
+            termo[k] = '\0';
+            Verificar_Aproximada(termo);
+        }
+
+        VERIFICAR_IGUAL(PesquisaGraos_Buscar(s_errados[t].termo), 0);
+        uint8_t n = Tecla(BUSCA_HANDLER, s_errados[t].termo);
+        bool achou = false;
+        for (uint8_t i = 0; i < n; i++) {
+            if (strcmp(s_graos[s_pagina[i]].nome, s_errados[t].grao) == 0) achou = true;
+        }
+        if (!achou) fprintf(stderr, "  '%s' sem '%s' na primeira pagina\n", s_errados[t].termo, s_errados[t].grao);
+        VERIFICAR(achou);
+        na_primeira_pagina += achou ? 1u : 0u;
+    }
+    return na_primeira_pagina;
+}
+
+static void Imprimir(const char* nome, Medida_t m)
+{
+    printf("  %-30s %8.0f ns/tecla  %8.0f ciclos/tecla\n", nome,
+           (double)m.ns / (double)m.teclas, (double)m.ciclos / (double)m.teclas);
+}
+
+int main(void)
+{
+    static const char* errados[NUM_ERRADOS];
+    for (uint32_t t = 0; t < NUM_ERRADOS; t++) errados[t] = s_errados[t].termo;
+
+    Carregar_Catalogo();
+    PesquisaGraos_Construir();
+    Verificar_Equivalencia();
+    uint8_t achados = Verificar_Termos_Errados();
+
+    // Custo de (re)construir o indice, pago so quando a tabela de graos muda
+    uint64_t c0 = Host_Ciclos();
+    for (int r = 0; r < REPETICOES; r++) {
+        s_versao++;
+        PesquisaGraos_Buscar("");
+    }
+    uint64_t ciclos_construir = (Host_Ciclos() - c0) / REPETICOES;
+
+    Rodar(BUSCA_EXATA, s_termos, NUM_TERMOS); // aquece caches
+    Rodar(BUSCA_ANTERIOR, s_termos, NUM_TERMOS);
+    Medida_t atual = Rodar(BUSCA_EXATA, s_termos, NUM_TERMOS);
+    Medida_t antigo = Rodar(BUSCA_ANTERIOR, s_termos, NUM_TERMOS);
+    Medida_t aproximada = Rodar(BUSCA_APROXIMADA, s_termos, NUM_TERMOS);
+    Medida_t handler = Rodar(BUSCA_HANDLER, s_termos, NUM_TERMOS);
+    Medida_t err_exata = Rodar(BUSCA_EXATA, errados, NUM_ERRADOS);
+    Medida_t err_handler = Rodar(BUSCA_HANDLER, errados, NUM_ERRADOS);
+
+    printf("bench_pesquisa: %u graos de Produto[], %u termos, %lu teclas por repeticao\n",
+           (unsigned)MAX_GRAOS, (unsigned)NUM_TERMOS, (unsigned long)(atual.teclas / REPETICOES));
+    Imprimir("indice de bigramas (atual)", atual);
+    Imprimir("stristr + copia (anterior)", antigo);
+    printf("  construir o indice: %lu ciclos  ganho por tecla: %.1fx\n",
+           (unsigned long)ciclos_construir, (double)antigo.ciclos / (double)atual.ciclos);
+    Imprimir("aproximada em toda tecla", aproximada);
+    Imprimir("exata + aproximada se vazia", handler);
+    printf("  %u termos com erro, %lu teclas por repeticao:\n",
+           (unsigned)NUM_ERRADOS, (unsigned long)(err_exata.teclas / REPETICOES));
+    Imprimir("so exata", err_exata);
+    Imprimir("exata + aproximada se vazia", err_handler);
+    printf("  grao procurado na 1a pagina: exata 0/%u, com aproximada %u/%u\n",
+           (unsigned)NUM_ERRADOS, (unsigned)achados, (unsigned)NUM_ERRADOS);
+
+    return Host_Teste_Resultado("pesquisa: mesmos graos do caminho anterior e da referencia");
+}
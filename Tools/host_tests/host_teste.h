@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * @file        host_teste.h
+ * @brief       Apoio comum dos testes e benchmarks de host.
+ * @details     Verificacoes sem framework externo, relogio manual do HAL,
+ * UART simulada e medicao de tempo. Implementado em stubs/hal_host.c.
+ ******************************************************************************/
+
+#ifndef HOST_TESTE_H
+#define HOST_TESTE_H
+
+#include "stm32c0xx_hal.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+extern int g_host_falhas;
+
+#define VERIFICAR(cond) \
+    do { if (!(cond)) { g_host_falhas++; \
+        fprintf(stderr, "FALHA %s:%d: %s\n", __FILE__, __LINE__, #cond); } } while (0)
+
+#define VERIFICAR_IGUAL(obtido, esperado) \
+    do { long long o_ = (long long)(obtido), e_ = (long long)(esperado); \
+        if (o_ != e_) { g_host_falhas++; \
+            fprintf(stderr, "FALHA %s:%d: %s = %lld, esperado %lld\n", \
+                   __FILE__, __LINE__, #obtido, o_, e_); } } while (0)
+
+/**
+ * @brief Imprime o resultado e devolve o codigo de saida do programa.
+ */
+int Host_Teste_Resultado(const char* nome);
+
+// Relogio do HAL: HAL_GetTick so anda quando o teste manda
+void Host_Set_Tick(uint32_t ms);
+void Host_Avancar_ms(uint32_t ms);
+
+/**
+ * @brief Destino dos bytes de HAL_UART_Transmit_DMA. O DMA "conclui" quando o
+ *        teste chama o callback de TX do driver; sem destino os bytes somem.
+ */
+typedef void (*host_uart_tx_t)(UART_HandleTypeDef* huart, const uint8_t* data, uint16_t len);
+void Host_Uart_Set_Tx(host_uart_tx_t destino);
+
+/**
+ * @brief Anel entregue pelo ultimo HAL_UARTEx_ReceiveToIdle_DMA (o teste
+ *        escreve nele e chama o callback de RX do driver).
+ */
+uint8_t* Host_Uart_Rx_Buffer(uint16_t* tamanho);
+
+/**
+ * @brief Posicao de escrita do DMA de RX no anel (CNDTR = tamanho - posicao).
+ *        Sem chamada, o DMA fica parado no inicio do anel.
+ */
+void Host_Uart_Rx_Posicao(uint16_t posicao);
+
+/**
+ * @brief Faz o printf do firmware ir para 'destino' caractere a caractere,
+ *        como o fputc de retarget.c. NULL devolve o stdout original. As
+ *        falhas de VERIFICAR saem em stderr e nao passam pelo destino.
+ */
+typedef void (*host_console_t)(uint8_t ch);
+void Host_Printf_Destino(host_console_t destino);
+
+// Medicao: relogio monotonico e contador de ciclos da CPU (TSC no x86)
+uint64_t Host_Tempo_ns(void);
+uint64_t Host_Ciclos(void);
+
+#endif // HOST_TESTE_H
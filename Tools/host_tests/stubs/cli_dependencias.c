@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * @file        cli_dependencias.c
+ * @brief       Dependencias falsas de cli_driver.c para os testes de host.
+ * @details     Os comandos do console consultam quase todos os modulos; aqui
+ * cada consulta devolve zeros e cada acao e aceita sem efeito. Eventos e log
+ * diferido sao os modulos reais (app_eventos.c e log_diferido.c). Os
+ * simbolos sao fracos: um teste que precise observar uma chamada define a
+ * sua propria versao.
+ ******************************************************************************/
+
+#include "cli_driver.h"
+#include "ads1232_driver.h"
+#include "agendador.h"
+#include "app_manager.h"
+#include "controller.h"
+#include "deriva_termica.h"
+#include "display_handler.h"
+#include "dwin_driver.h"
+#include "medicao_handler.h"
+#include "memoria.h"
+#include "perfil.h"
+#include "relato.h"
+#include "rtc_driver.h"
+#include "sequencia_handler.h"
+#include "temp_sensor.h"
+#include "trend_handler.h"
+#include <string.h>
+
+#define FALSO __attribute__((weak))
+
+// --- ADS1232 -----------------------------------------------------------------
+#if ADS1232_TEMP_INTERLEAVE
+FALSO void ADS1232_Get_Comp_Temp(ADS1232_CompTemp_t* out) { memset(out, 0, sizeof(*out)); }
+FALSO bool ADS1232_Set_Comp_Temp(const ADS1232_CompTemp_t* comp) { return true; }
+FALSO void ADS1232_Get_Intercalacao(ADS1232_Intercalacao_t* out) { memset(out, 0, sizeof(*out)); }
+FALSO void ADS1232_Set_Intercalacao(uint16_t razao, uint8_t descarte) { }
+FALSO bool ADS1232_Get_Temperatura(float* temp_c) { return false; }
+#endif
+
+// --- Agendador ---------------------------------------------------------------
+FALSO void Agendador_Get_Stats(AgendadorStats_t* out) { memset(out, 0, sizeof(*out)); }
+FALSO void Agendador_Get_Stats_Tarefa(uint8_t id, TarefaStats_t* out) { memset(out, 0, sizeof(*out)); }
+FALSO const char* Agendador_Nome(uint8_t id) { return "?"; }
+FALSO uint8_t Agendador_Num_Tarefas(void) { return 0; }
+FALSO void Agendador_Reset_Stats(void) { }
+
+// --- App manager / controller / display --------------------------------------
+FALSO SystemState_t App_Manager_Get_State(void) { return (SystemState_t)0; }
+FALSO void App_Manager_Imprimir_Diagnostico(void) { }
+FALSO void App_Manager_Imprimir_Wake(void) { }
+FALSO bool App_Manager_Run_Self_Diagnostics(uint8_t return_tela) { return true; }
+FALSO uint16_t Controller_GetCurrentScreen(void) { return 0; }
+FALSO void Display_StartMeasurementSequence(void) { }
+FALSO void Who_am_i(void) { }
+
+// --- DWIN --------------------------------------------------------------------
+FALSO uint16_t DWIN_Driver_GetCurrentPage(void) { return 0; }
+FALSO uint16_t DWIN_Driver_GetTxFree(DWIN_TxLane_t lane) { return DWIN_TX_FIFO_SIZE - 1; }
+FALSO void DWIN_Driver_GetTxStats(DWIN_TxLane_t lane, DWIN_TxLaneStats_t* out) { memset(out, 0, sizeof(*out)); }
+FALSO void DWIN_Driver_ResetTxStats(void) { }
+FALSO bool DWIN_Driver_SetScreen(uint16_t screen_id) { return true; }
+FALSO bool DWIN_Driver_WriteInt(uint16_t vp_address, int16_t value) { return true; }
+FALSO bool DWIN_Driver_WriteInt32(uint16_t vp_address, int32_t value) { return true; }
+FALSO bool DWIN_Driver_WriteRawBytes(const uint8_t* data, uint16_t size) { return true; }
+
+// --- Deriva termica ----------------------------------------------------------
+FALSO float Deriva_Corrigir(float frequencia_hz, float temp_c) { return frequencia_hz; }
+FALSO void Deriva_Get_Info(DerivaInfo_t* info) { memset(info, 0, sizeof(*info)); }
+FALSO void Deriva_Reset(void) { }
+FALSO void Deriva_Set_Ativa(bool ativa) { }
+FALSO void Deriva_Set_Referencia(float t_ref_c) { }
+
+// --- Medicao / sequencia -----------------------------------------------------
+FALSO void Medicao_Get_Brutos(DadosBrutos_t* brutos) { memset(brutos, 0, sizeof(*brutos)); }
+FALSO void Medicao_Get_Repeticao(ResultadoRepeticao_t* resultado) { memset(resultado, 0, sizeof(*resultado)); }
+FALSO void Medicao_Get_UltimaMedicao(DadosMedicao_t* dados) { memset(dados, 0, sizeof(*dados)); }
+FALSO bool Medicao_Repeticao_Em_Andamento(void) { return false; }
+FALSO void Sequencia_Abortar(void) { }
+FALSO SequenciaPasso_t Sequencia_Get_Passo(void) { return (SequenciaPasso_t)0; }
+FALSO uint8_t Sequencia_Get_Receita(void) { return 0; }
+FALSO void Sequencia_Get_Tempos(SequenciaTempos_t* out) { memset(out, 0, sizeof(*out)); }
+FALSO const char* Sequencia_Nome_Passo(SequenciaPasso_t passo) { return "?"; }
+
+// --- Memoria / perfil --------------------------------------------------------
+FALSO void Memoria_Get_Info(MemoriaInfo_t* out) { memset(out, 0, sizeof(*out)); }
+FALSO void Perfil_Get_Isr(PerfilIsr_t fonte, PerfilIsrStats_t* out) { memset(out, 0, sizeof(*out)); }
+FALSO void Perfil_Get_Loop(PerfilLoopStats_t* out) { memset(out, 0, sizeof(*out)); }
+FALSO void Perfil_Get_Ponto(PerfilPonto_t ponto, PerfilPontoStats_t* out) { memset(out, 0, sizeof(*out)); }
+FALSO const char* Perfil_Nome_Isr(PerfilIsr_t fonte) { return "?"; }
+FALSO const char* Perfil_Nome_Ponto(PerfilPonto_t ponto) { return "?"; }
+FALSO void Perfil_Reset(void) { }
+
+// --- RTC / sensor / tendencia ------------------------------------------------
+FALSO bool RTC_Driver_SetDate(uint8_t day, uint8_t month, uint8_t year) { return true; }
+FALSO bool RTC_Driver_SetTime(uint8_t hours, uint8_t minutes, uint8_t seconds) { return true; }
+FALSO float TempSensor_GetTemperature(void) { return 25.0f; }
+FALSO uint16_t TempSensor_Get_VDDA_mV(void) { return 3300; }
+FALSO void Trend_Get_Config(TrendConfig_t* config) { memset(config, 0, sizeof(*config)); }
+FALSO uint32_t Trend_Get_Pontos_Descartados(void) { return 0; }
+FALSO bool Trend_Set_Config(const TrendConfig_t* config) { return true; }
+FALSO void Trend_Set_Enabled(bool habilitado) { }
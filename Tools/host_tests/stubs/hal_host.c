@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * @file        hal_host.c
+ * @brief       Implementacao do HAL de host (ver stubs/stm32c0xx_hal.h).
+ ******************************************************************************/
+
+#define _GNU_SOURCE // fopencookie
+#include "host_teste.h"
+#include <stdlib.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+GPIO_TypeDef g_host_gpio[4];
+uint32_t g_host_primask = 0u;
+SysTick_Type g_host_systick = { 47999u, 47999u }; // 48 MHz, 1 ms: VAL no inicio do ms
+
+int g_host_falhas = 0;
+
+static uint32_t s_tick = 0u;
+static host_uart_tx_t s_uart_tx = NULL;
+static uint8_t* s_uart_rx = NULL;
+static uint16_t s_uart_rx_tam = 0u;
+static uint16_t s_uart_rx_pos = 0u;
+static host_console_t s_console = NULL;
+static FILE* s_stdout_original = NULL;
+
+int Host_Teste_Resultado(const char* nome)
+{
+    if (g_host_falhas == 0) {
+        printf("[OK] %s\n", nome);
+        return 0;
+    }
+    printf("[FALHOU] %s: %d verificacao(oes)\n", nome, g_host_falhas);
+    return 1;
+}
+
+void Host_Set_Tick(uint32_t ms) { s_tick = ms; }
+void Host_Avancar_ms(uint32_t ms) { s_tick += ms; }
+void Host_Uart_Set_Tx(host_uart_tx_t destino) { s_uart_tx = destino; }
+
+uint8_t* Host_Uart_Rx_Buffer(uint16_t* tamanho)
+{
+    if (tamanho != NULL) {
+        *tamanho = s_uart_rx_tam;
+    }
+    return s_uart_rx;
+}
+
+static ssize_t Console_Escrever(void* cookie, const char* buf, size_t n)
+{
+    (void)cookie;
+    for (size_t i = 0; i < n; i++) {
+        s_console((uint8_t)buf[i]);
+    }
+    return (ssize_t)n;
+}
+
+void Host_Printf_Destino(host_console_t destino)
+{
+    fflush(stdout);
+    if ((destino != NULL) && (s_stdout_original == NULL)) {
+        FILE* f = fopencookie(NULL, "w", (cookie_io_functions_t){ .write = Console_Escrever });
+        if (f == NULL) {
+            return;
+        }
+        setvbuf(f, NULL, _IONBF, 0);
+        s_stdout_original = stdout;
+        stdout = f;
+    } else if ((destino == NULL) && (s_stdout_original != NULL)) {
+        fclose(stdout);
+        stdout = s_stdout_original;
+        s_stdout_original = NULL;
+    }
+    s_console = destino;
+}
+
+void Host_Uart_Rx_Posicao(uint16_t posicao) { s_uart_rx_pos = posicao; }
+
+uint32_t Host_Dma_Contador(DMA_HandleTypeDef* hdma)
+{
+    (void)hdma;
+    return (uint32_t)(s_uart_rx_tam - s_uart_rx_pos);
+}
+
+uint64_t Host_Tempo_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000u) + (uint64_t)ts.tv_nsec;
+}
+
+uint64_t Host_Ciclos(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return Host_Tempo_ns(); // sem contador de ciclos: 1 "ciclo" = 1 ns
+#endif
+}
+
+//==============================================================================
+// HAL
+//==============================================================================
+
+uint32_t HAL_GetTick(void) { return s_tick; }
+void HAL_Delay(uint32_t ms) { s_tick += ms; }
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* port, uint16_t pin, GPIO_PinState estado)
+{
+    (void)port; (void)pin; (void)estado;
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* port, uint16_t pin)
+{
+    (void)port; (void)pin;
+    return GPIO_PIN_RESET;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef* huart, const uint8_t* data, uint16_t len)
+{
+    if (s_uart_tx != NULL) {
+        s_uart_tx(huart, data, len);
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef* huart, uint8_t* data, uint16_t len)
+{
+    (void)huart;
+    s_uart_rx = data;
+    s_uart_rx_tam = len;
+    s_uart_rx_pos = 0u;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef* huart)
+{
+    (void)huart;
+    return HAL_OK;
+}
+
+void Error_Handler(void)
+{
+    printf("Error_Handler chamado\n");
+    abort();
+}
@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * @file        stm32c0xx_hal.h (host)
+ * @brief       Substituto minimo do HAL para compilar modulos do firmware no PC.
+ * @details     Vem antes de Core/Inc no caminho de includes: o main.h e os
+ * headers do CubeMX continuam os originais, so o HAL e o CMSIS sao trocados.
+ * Apenas os tipos e funcoes usados pelos modulos testados existem aqui; as
+ * implementacoes ficam em hal_host.c (relogio manual e UART simulada).
+ ******************************************************************************/
+
+#ifndef STM32C0XX_HAL_HOST_H
+#define STM32C0XX_HAL_HOST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef enum { HAL_OK = 0, HAL_ERROR, HAL_BUSY, HAL_TIMEOUT } HAL_StatusTypeDef;
+typedef enum { GPIO_PIN_RESET = 0, GPIO_PIN_SET } GPIO_PinState;
+typedef enum { RESET = 0, SET = !RESET } FlagStatus;
+
+typedef struct { uint32_t id; } GPIO_TypeDef;
+typedef struct { uint32_t id; } DMA_HandleTypeDef;
+typedef struct { uint32_t id; DMA_HandleTypeDef* hdmarx; } UART_HandleTypeDef;
+typedef struct { uint32_t id; } I2C_HandleTypeDef;
+typedef struct { uint32_t id; } RTC_HandleTypeDef;
+typedef struct { uint32_t id; } TIM_HandleTypeDef;
+typedef struct { uint32_t id; } CRC_HandleTypeDef;
+typedef struct { uint32_t id; } ADC_HandleTypeDef;
+
+typedef enum { EXTI4_15_IRQn = 7, USART1_IRQn = 27, DMA1_Channel1_IRQn = 9 } IRQn_Type;
+
+typedef struct { volatile uint32_t LOAD; volatile uint32_t VAL; } SysTick_Type;
+extern SysTick_Type g_host_systick;
+#define SysTick (&g_host_systick)
+
+extern GPIO_TypeDef g_host_gpio[4];
+#define GPIOA (&g_host_gpio[0])
+#define GPIOB (&g_host_gpio[1])
+#define GPIOC (&g_host_gpio[2])
+#define GPIOD (&g_host_gpio[3])
+
+#define GPIO_PIN_0   ((uint16_t)0x0001)
+#define GPIO_PIN_1   ((uint16_t)0x0002)
+#define GPIO_PIN_2   ((uint16_t)0x0004)
+#define GPIO_PIN_3   ((uint16_t)0x0008)
+#define GPIO_PIN_4   ((uint16_t)0x0010)
+#define GPIO_PIN_5   ((uint16_t)0x0020)
+#define GPIO_PIN_6   ((uint16_t)0x0040)
+#define GPIO_PIN_7   ((uint16_t)0x0080)
+#define GPIO_PIN_8   ((uint16_t)0x0100)
+#define GPIO_PIN_9   ((uint16_t)0x0200)
+#define GPIO_PIN_10  ((uint16_t)0x0400)
+
+#define UART_CLEAR_PEF   (1u << 0)
+#define UART_CLEAR_FEF   (1u << 1)
+#define UART_CLEAR_NEF   (1u << 2)
+#define UART_CLEAR_OREF  (1u << 3)
+#define __HAL_UART_CLEAR_FLAG(h, f)  ((void)(h), (void)(f))
+
+// CNDTR do canal de RX: o teste informa a posicao de escrita do DMA
+#define __HAL_DMA_GET_COUNTER(h)     Host_Dma_Contador(h)
+uint32_t Host_Dma_Contador(DMA_HandleTypeDef* hdma);
+
+//==============================================================================
+// CMSIS: no PC nao ha interrupcoes; PRIMASK e so uma variavel
+//==============================================================================
+
+extern uint32_t g_host_primask;
+static inline uint32_t __get_PRIMASK(void) { return g_host_primask; }
+static inline void __set_PRIMASK(uint32_t v) { g_host_primask = v; }
+static inline void __disable_irq(void) { g_host_primask = 1u; }
+static inline void __enable_irq(void) { g_host_primask = 0u; }
+#define __DMB()  __sync_synchronize()
+#define __DSB()  __sync_synchronize()
+#define __ISB()  __sync_synchronize()
+#define __NOP()  ((void)0)
+
+//==============================================================================
+// HAL usado pelos modulos testados (hal_host.c)
+//==============================================================================
+
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t ms);
+void HAL_GPIO_WritePin(GPIO_TypeDef* port, uint16_t pin, GPIO_PinState estado);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* port, uint16_t pin);
+
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef* huart, const uint8_t* data, uint16_t len);
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef* huart, uint8_t* data, uint16_t len);
+HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef* huart);
+
+#endif // STM32C0XX_HAL_HOST_H
@@ -0,0 +1,273 @@
+/*******************************************************************************
+ * @file        teste_cli_rajada.c
+ * @brief       Rajadas de centenas de comandos no console sem perda.
+ * @details     O cli_driver.c real recebe pelo anel de DMA circular simulado
+ * a 115200 8N1: os bytes entram no anel no ritmo do fio e o driver so fica
+ * sabendo deles nos eventos do HAL (meia transferencia, fim do anel e linha
+ * ociosa), como no alvo. O superloop roda CLI_Process, um evento e o TX a
+ * cada passo. Cada comando "DWIN INT32 2190 <n>" e registrado pelo DWIN
+ * falso: todos tem que chegar, uma vez e em ordem.
+ ******************************************************************************/
+
+#include "host_teste.h"
+#include "cli_driver.h"
+#include "app_eventos.h"
+#include "dwin_driver.h"
+#include <stdarg.h>
+#include <string.h>
+
+#define BAUD             115200u
+#define BYTE_US          ((10u * 1000000u) / BAUD)   // 8N1
+#define MAX_COMANDOS     1000
+
+//==============================================================================
+// DWIN falso: registra os comandos executados
+//==============================================================================
+
+static int32_t  s_executados[MAX_COMANDOS];
+static uint32_t s_num_executados = 0;
+
+bool DWIN_Driver_WriteInt32(uint16_t vp_address, int32_t value)
+{
+    if ((vp_address == 0x2190u) && (s_num_executados < MAX_COMANDOS)) {
+        s_executados[s_num_executados++] = value;
+    }
+    return true;
+}
+
+//==============================================================================
+// USART simulada (RX por DMA circular, TX com tempo de fio)
+//==============================================================================
+
+static DMA_HandleTypeDef s_hdma_rx;
+static UART_HandleTypeDef s_huart = { .hdmarx = &s_hdma_rx };
+static uint64_t s_agora_us = 0;
+static uint64_t s_tx_fim_us = 0;
+static bool     s_tx_ocupado = false;
+static uint32_t s_ok_recebidos = 0;   // fins de resposta vistos pelo PC
+static char     s_tx_janela[3];
+
+static uint8_t* s_anel = NULL;
+static uint16_t s_anel_tam = 0;
+static uint16_t s_anel_pos = 0;       // proxima escrita do DMA
+static bool     s_idle_pendente = false;
+
+static void Uart_Destino(UART_HandleTypeDef* huart, const uint8_t* data, uint16_t len)
+{
+    for (uint16_t i = 0; i < len; i++) {
+        memmove(s_tx_janela, &s_tx_janela[1], sizeof(s_tx_janela) - 1u);
+        s_tx_janela[sizeof(s_tx_janela) - 1u] = (char)data[i];
+        if (memcmp(s_tx_janela, "OK\r", 3) == 0) { // printf("OK\r\n") sai "OK\r\r\n"
+            s_ok_recebidos++;
+        }
+    }
+    s_tx_ocupado = true;
+    s_tx_fim_us = s_agora_us + ((uint64_t)len * BYTE_US);
+}
+
+/** Um byte chega pelo fio: o DMA grava e o HAL avisa em HT e TC. */
+static void Rx_Byte(uint8_t b)
+{
+    s_anel[s_anel_pos++] = b;
+    Host_Uart_Rx_Posicao(s_anel_pos % s_anel_tam);
+    s_idle_pendente = true;
+    if (s_anel_pos == (s_anel_tam / 2u)) {
+        CLI_HandleRxEvent(&s_huart, s_anel_pos);
+        s_idle_pendente = false;
+    } else if (s_anel_pos == s_anel_tam) {
+        s_anel_pos = 0;
+        CLI_HandleRxEvent(&s_huart, s_anel_tam);
+        s_idle_pendente = false;
+    }
+}
+
+/** Linha ociosa (um caractere sem dados): o HAL reporta a posicao atual. */
+static void Rx_Idle(void)
+{
+    if (s_idle_pendente) {
+        CLI_HandleRxEvent(&s_huart, s_anel_pos);
+        s_idle_pendente = false;
+    }
+}
+
+//==============================================================================
+// Superloop
+//==============================================================================
+
+/**
+ * @brief Uma passagem das tarefas do console. Com eventos pendentes o
+ *        agendador roda de novo em seguida (Agendador_Sinalizar).
+ */
+static void Superloop(void)
+{
+    bool despachou;
+    do {
+        if (s_tx_ocupado && (s_agora_us >= s_tx_fim_us)) {
+            s_tx_ocupado = false;
+            CLI_HandleTxCplt(&s_huart);
+        }
+        CLI_Process();
+        despachou = Eventos_Dispatch();
+        CLI_TX_Pump();
+    } while (despachou);
+}
+
+/**
+ * @brief Envia o texto no ritmo do fio; o superloop roda a cada 'loop_us'
+ *        (um intervalo longo simula uma tarefa lenta segurando o loop).
+ */
+static void Enviar(const char* texto, uint32_t len, uint32_t loop_us)
+{
+    uint64_t proximo_loop = s_agora_us + loop_us;
+    for (uint32_t i = 0; i < len; i++) {
+        Rx_Byte((uint8_t)texto[i]);
+        s_agora_us += BYTE_US;
+        Host_Set_Tick((uint32_t)(s_agora_us / 1000u));
+        while (s_agora_us >= proximo_loop) {
+            Superloop();
+            proximo_loop += loop_us;
+        }
+    }
+    // Fim da rajada: linha ociosa e o superloop esvazia a fila
+    s_agora_us += BYTE_US;
+    Rx_Idle();
+    for (int i = 0; i < 2000; i++) {
+        s_agora_us += 1000u;
+        Host_Set_Tick((uint32_t)(s_agora_us / 1000u));
+        Superloop();
+    }
+}
+
+/** Resumo no terminal do teste (o printf normal vai para o console simulado). */
+static void Relatar(const char* fmt, ...)
+{
+    va_list ap;
+    Host_Printf_Destino(NULL);
+    va_start(ap, fmt);
+    vprintf(fmt, ap);
+    va_end(ap);
+    Host_Printf_Destino(CLI_Printf_Transmit);
+}
+
+//==============================================================================
+// Casos
+//==============================================================================
+
+static char s_rajada[MAX_COMANDOS * 32];
+
+static uint32_t Montar_Rajada(uint32_t primeiro, uint32_t n, const char* fim)
+{
+    uint32_t len = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        len += (uint32_t)sprintf(&s_rajada[len], "DWIN INT32 2190 %lu%s",
+                                 (unsigned long)(primeiro + i), fim);
+    }
+    return len;
+}
+
+static void Verificar_Execucao(uint32_t primeiro, uint32_t n)
+{
+    VERIFICAR_IGUAL(s_num_executados, n);
+    for (uint32_t i = 0; (i < n) && (i < s_num_executados); i++) {
+        if (s_executados[i] != (int32_t)(primeiro + i)) {
+            VERIFICAR_IGUAL(s_executados[i], primeiro + i);
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Modo maquina: 500 comandos colados, CRLF, superloop a cada 1 ms.
+ *        As respostas (~33 bytes por comando de 21) excedem o fio de TX e
+ *        parte delas e descartada pela politica do FIFO; so informativo.
+ */
+static void Teste_Maquina(void)
+{
+    CliRxStats_t antes, depois;
+    CLI_Set_Modo(CLI_MODO_MAQUINA);
+    CLI_Get_Rx_Stats(&antes);
+    s_num_executados = 0;
+    s_ok_recebidos = 0;
+
+    uint32_t len = Montar_Rajada(0, 500, "\r\n");
+    Enviar(s_rajada, len, 1000u);
+
+    CLI_Get_Rx_Stats(&depois);
+    Verificar_Execucao(0, 500);
+    VERIFICAR_IGUAL(depois.comandos - antes.comandos, 500);
+    VERIFICAR_IGUAL(depois.bytes_recebidos - antes.bytes_recebidos, len);
+    VERIFICAR_IGUAL(depois.bytes_perdidos, 0);
+    VERIFICAR_IGUAL(depois.linhas_descartadas, 0);
+
+    CliTxStats_t tx;
+    CLI_Get_Tx_Stats(&tx);
+    Relatar("  maquina: 500 comandos (%lu bytes), %lu executados, %lu 'OK' (respostas descartadas: %lu bytes)\n",
+           (unsigned long)len, (unsigned long)s_num_executados, (unsigned long)s_ok_recebidos,
+           (unsigned long)tx.bytes_descartados);
+}
+
+/**
+ * @brief Modo humano (eco, historico) com LF simples e loop preso 15 ms por
+ *        vez (~170 bytes no fio, abaixo do anel de 256).
+ */
+static void Teste_Humano_Loop_Lento(void)
+{
+    CliRxStats_t antes, depois;
+    CLI_Set_Modo(CLI_MODO_HUMANO);
+    CLI_Get_Rx_Stats(&antes);
+    s_num_executados = 0;
+
+    uint32_t len = Montar_Rajada(1000, 300, "\n");
+    Enviar(s_rajada, len, 15000u);
+
+    CLI_Get_Rx_Stats(&depois);
+    Verificar_Execucao(1000, 300);
+    VERIFICAR_IGUAL(depois.comandos - antes.comandos, 300);
+    VERIFICAR_IGUAL(depois.bytes_perdidos, 0);
+    VERIFICAR_IGUAL(depois.linhas_descartadas, 0);
+    Relatar("  humano, loop de 15 ms: 300 comandos, %lu executados\n",
+           (unsigned long)s_num_executados);
+}
+
+/**
+ * @brief Superloop parado mais que o anel (30 ms = ~350 bytes): a perda e
+ *        detectada, contada e a linha corrompida nao e executada.
+ */
+static void Teste_Estouro_Detectado(void)
+{
+    CliRxStats_t antes, depois;
+    CLI_Set_Modo(CLI_MODO_MAQUINA);
+    CLI_Get_Rx_Stats(&antes);
+    s_num_executados = 0;
+
+    uint32_t len = Montar_Rajada(5000, 100, "\r\n");
+    Enviar(s_rajada, len, 30000u);
+
+    CLI_Get_Rx_Stats(&depois);
+    VERIFICAR(depois.bytes_perdidos > antes.bytes_perdidos);
+    VERIFICAR(s_num_executados < 100);
+    for (uint32_t i = 1; i < s_num_executados; i++) {
+        VERIFICAR(s_executados[i] > s_executados[i - 1]); // nada repetido ou fora de ordem
+    }
+    Relatar("  loop parado 30 ms: %lu bytes perdidos (contados), %lu de 100 executados\n",
+           (unsigned long)(depois.bytes_perdidos - antes.bytes_perdidos),
+           (unsigned long)s_num_executados);
+}
+
+int main(void)
+{
+    Host_Uart_Set_Tx(Uart_Destino);
+    Host_Printf_Destino(CLI_Printf_Transmit); // retarget.c: printf -> console
+    Eventos_Init();
+    CLI_Init(&s_huart);
+    s_anel = Host_Uart_Rx_Buffer(&s_anel_tam);
+    VERIFICAR(s_anel != NULL);
+
+    Relatar("cli_rajada (%u baud):\n", BAUD);
+    Teste_Maquina();
+    Teste_Humano_Loop_Lento();
+    Teste_Estouro_Detectado();
+    Host_Printf_Destino(NULL);
+
+    return Host_Teste_Resultado("cli: rajadas de comandos pelo DMA circular");
+}
@@ -0,0 +1,263 @@
+/*******************************************************************************
+ * @file        teste_display_binding.c
+ * @brief       Agenda de VPs emitida por display_binding.c contra um DWIN falso.
+ * @details     O DWIN falso registra cada escrita (tick, VP, valor) e simula
+ * o espaco livre da lane de dados; medicao, sensor e RTC sao variaveis do
+ * teste. Verifica: periodo por VP, filtro de valor repetido, troca de tela,
+ * fila cheia, fonte indisponivel e invalidacao.
+ ******************************************************************************/
+
+#include "host_teste.h"
+#include "display_binding.h"
+#include "dwin_driver.h"
+#include "medicao_handler.h"
+#include "rtc_driver.h"
+#include "temp_sensor.h"
+#include <string.h>
+
+//==============================================================================
+// DWIN falso e fontes de dados
+//==============================================================================
+
+#define MAX_EMISSOES 256
+
+typedef struct {
+    uint32_t tick;
+    uint16_t vp;
+    int32_t  valor;
+    char     texto[BINDING_TEXTO_MAX + 1];
+} Emissao_t;
+
+static Emissao_t s_emissoes[MAX_EMISSOES];
+static uint16_t  s_num_emissoes = 0;
+static uint16_t  s_tx_livre = DWIN_TX_FIFO_SIZE - 1;
+
+static DadosMedicao_t s_medicao;
+static float   s_temp_mcu = 25.0f;
+static bool    s_rtc_ok = true;
+static uint8_t s_hora[3] = { 12, 0, 0 };
+static uint8_t s_data[3] = { 19, 10, 26 };
+
+static bool Registrar(uint16_t vp, int32_t valor, const char* texto)
+{
+    if (s_num_emissoes >= MAX_EMISSOES) {
+        return false;
+    }
+    Emissao_t* e = &s_emissoes[s_num_emissoes++];
+    e->tick = HAL_GetTick();
+    e->vp = vp;
+    e->valor = valor;
+    e->texto[0] = '\0';
+    if (texto != NULL) {
+        strncpy(e->texto, texto, BINDING_TEXTO_MAX);
+        e->texto[BINDING_TEXTO_MAX] = '\0';
+    }
+    return true;
+}
+
+bool DWIN_Driver_WriteInt(uint16_t vp_address, int16_t value) { return Registrar(vp_address, value, NULL); }
+bool DWIN_Driver_WriteInt32(uint16_t vp_address, int32_t value) { return Registrar(vp_address, value, NULL); }
+
+bool DWIN_Driver_WriteString(uint16_t vp_address, const char* text, uint16_t max_len)
+{
+    (void)max_len;
+    return Registrar(vp_address, 0, text);
+}
+
+uint16_t DWIN_Driver_GetTxFree(DWIN_TxLane_t lane)
+{
+    return (lane == DWIN_TX_LANE_DADOS) ? s_tx_livre : 0u;
+}
+
+void Medicao_Get_UltimaMedicao(DadosMedicao_t* dados) { *dados = s_medicao; }
+void Medicao_Set_Temp_Instru(float temp_instru) { s_medicao.Temp_Instru = temp_instru; }
+float TempSensor_GetTemperature(void) { return s_temp_mcu; }
+
+bool RTC_Driver_GetTime(uint8_t* hours, uint8_t* minutes, uint8_t* seconds)
+{
+    *hours = s_hora[0]; *minutes = s_hora[1]; *seconds = s_hora[2];
+    return s_rtc_ok;
+}
+
+bool RTC_Driver_GetDate(uint8_t* day, uint8_t* month, uint8_t* year)
+{
+    *day = s_data[0]; *month = s_data[1]; *year = s_data[2];
+    return s_rtc_ok;
+}
+
+//==============================================================================
+// Auxiliares
+//==============================================================================
+
+static void Reiniciar(void)
+{
+    memset(&s_medicao, 0, sizeof(s_medicao));
+    s_num_emissoes = 0;
+    s_tx_livre = DWIN_TX_FIFO_SIZE - 1;
+    s_temp_mcu = 25.0f;
+    s_rtc_ok = true;
+    Host_Set_Tick(0);
+    DisplayBinding_Init();
+}
+
+static uint16_t Contar_Vp(uint16_t vp)
+{
+    uint16_t n = 0;
+    for (uint16_t i = 0; i < s_num_emissoes; i++) {
+        if (s_emissoes[i].vp == vp) n++;
+    }
+    return n;
+}
+
+/**
+ * @brief Roda o superloop de 10 em 10 ms; a medicao muda a cada passo.
+ */
+static void Rodar(uint16_t tela, uint32_t ate_ms, bool variar)
+{
+    while (HAL_GetTick() <= ate_ms) {
+        if (variar) {
+            uint32_t t = HAL_GetTick();
+            s_medicao.Frequencia = 5000.0f + (float)t;
+            s_medicao.Escala_A = (float)t / 10.0f;
+            s_temp_mcu = 20.0f + ((float)t / 1000.0f);
+            s_hora[2] = (uint8_t)((t / 1000u) % 60u);
+        }
+        DisplayBinding_Process(tela);
+        Host_Avancar_ms(10);
+    }
+}
+
+//==============================================================================
+// Casos
+//==============================================================================
+
+/**
+ * @brief Monitor com valores sempre mudando: FREQUENCIA e ESCALA_A a cada
+ *        1 s, TEMP_INSTRU a cada 5 s, na ordem da tabela.
+ */
+static void Teste_Agenda_Monitor(void)
+{
+    Reiniciar();
+    Rodar(TELA_MONITOR_SYSTEM, 10990, true);
+
+    Emissao_t esperado[MAX_EMISSOES];
+    uint16_t n = 0;
+    for (uint32_t t = 0; t <= 10000; t += 1000) {
+        esperado[n++] = (Emissao_t){ .tick = t, .vp = FREQUENCIA };
+        esperado[n++] = (Emissao_t){ .tick = t, .vp = ESCALA_A };
+        if ((t % 5000u) == 0u) {
+            esperado[n++] = (Emissao_t){ .tick = t, .vp = TEMP_INSTRU };
+        }
+    }
+
+    VERIFICAR_IGUAL(s_num_emissoes, n);
+    for (uint16_t i = 0; (i < n) && (i < s_num_emissoes); i++) {
+        VERIFICAR_IGUAL(s_emissoes[i].tick, esperado[i].tick);
+        VERIFICAR_IGUAL(s_emissoes[i].vp, esperado[i].vp);
+    }
+
+    // Valores escalados: 5000 Hz * 0.01 e 20.0 C * 10 na primeira emissao
+    VERIFICAR_IGUAL(s_emissoes[0].valor, 50);
+    VERIFICAR_IGUAL(s_emissoes[2].valor, 200);
+}
+
+/**
+ * @brief Valor repetido nao e retransmitido, mesmo com o periodo vencido.
+ */
+static void Teste_Sem_Mudanca(void)
+{
+    Reiniciar();
+    s_medicao.Frequencia = 8000.0f;
+    Rodar(TELA_MONITOR_SYSTEM, 10000, false);
+    VERIFICAR_IGUAL(s_num_emissoes, 3); // so a emissao inicial forcada
+
+    s_medicao.Escala_A = 12.3f;
+    Rodar(TELA_MONITOR_SYSTEM, 12000, false);
+    VERIFICAR_IGUAL(Contar_Vp(ESCALA_A), 2);
+    VERIFICAR_IGUAL(Contar_Vp(FREQUENCIA), 1);
+}
+
+/**
+ * @brief So a tela visivel e atualizada; a nova tela recebe tudo de imediato.
+ */
+static void Teste_Troca_De_Tela(void)
+{
+    Reiniciar();
+    Rodar(TELA_MONITOR_SYSTEM, 990, true);
+    uint16_t no_monitor = s_num_emissoes;
+
+    Rodar(PRINCIPAL, 4990, true);
+    VERIFICAR(s_num_emissoes > no_monitor);
+    VERIFICAR_IGUAL(s_emissoes[no_monitor].tick, 1000);
+    VERIFICAR_IGUAL(s_emissoes[no_monitor].vp, HORA_SISTEMA);
+    VERIFICAR_IGUAL(s_emissoes[no_monitor + 1].vp, DATA_SISTEMA);
+    VERIFICAR(strcmp(s_emissoes[no_monitor + 1].texto, "19/10/26") == 0);
+    for (uint16_t i = no_monitor; i < s_num_emissoes; i++) {
+        VERIFICAR(s_emissoes[i].vp == HORA_SISTEMA || s_emissoes[i].vp == DATA_SISTEMA);
+    }
+    // Hora muda a cada segundo (1000..4000 ms); a data fica na emissao inicial
+    VERIFICAR_IGUAL(Contar_Vp(HORA_SISTEMA), 4);
+    VERIFICAR_IGUAL(Contar_Vp(DATA_SISTEMA), 1);
+
+    // Tela sem vinculos: nada e emitido
+    uint16_t antes = s_num_emissoes;
+    Rodar(TELA_SERVICO, 9990, true);
+    VERIFICAR_IGUAL(s_num_emissoes, antes);
+}
+
+/**
+ * @brief Lane de dados sem espaco: nada sai e o VP vencido sai assim que houver espaco.
+ */
+static void Teste_Fila_Cheia(void)
+{
+    Reiniciar();
+    s_tx_livre = 9; // menor que um frame INT32 (10 bytes)
+    Rodar(TELA_MONITOR_SYSTEM, 500, true);
+    VERIFICAR_IGUAL(s_num_emissoes, 0);
+
+    s_tx_livre = DWIN_TX_FIFO_SIZE - 1;
+    Rodar(TELA_MONITOR_SYSTEM, 510, true);
+    VERIFICAR_IGUAL(s_num_emissoes, 3);
+    VERIFICAR_IGUAL(s_emissoes[0].tick, 510);
+}
+
+/**
+ * @brief RTC indisponivel: texto nao e emitido e continua pendente.
+ */
+static void Teste_Fonte_Indisponivel(void)
+{
+    Reiniciar();
+    s_rtc_ok = false;
+    Rodar(PRINCIPAL, 300, false);
+    VERIFICAR_IGUAL(s_num_emissoes, 0);
+
+    s_rtc_ok = true;
+    Rodar(PRINCIPAL, 310, false);
+    VERIFICAR_IGUAL(s_num_emissoes, 2);
+    VERIFICAR(strcmp(s_emissoes[0].texto, "12:00:00") == 0);
+}
+
+/**
+ * @brief Invalidate reemite todos os VPs da tela atual, mesmo sem mudanca.
+ */
+static void Teste_Invalidar(void)
+{
+    Reiniciar();
+    Rodar(TELA_ADJUST_CAPA, 100, false);
+    VERIFICAR_IGUAL(s_num_emissoes, 3);
+
+    DisplayBinding_Invalidate();
+    Rodar(TELA_ADJUST_CAPA, 200, false);
+    VERIFICAR_IGUAL(s_num_emissoes, 6);
+}
+
+int main(void)
+{
+    Teste_Agenda_Monitor();
+    Teste_Sem_Mudanca();
+    Teste_Troca_De_Tela();
+    Teste_Fila_Cheia();
+    Teste_Fonte_Indisponivel();
+    Teste_Invalidar();
+    return Host_Teste_Resultado("display_binding: agenda de VPs");
+}
@@ -0,0 +1,300 @@
+/*******************************************************************************
+ * @file        teste_relato.c
+ * @brief       Ticket de medicao: relato.c atual x implementacao por printf.
+ * @details     Referencia dourada: o Relatorio_Printer anterior (printf com
+ * %8.1f, %14.*f e os "\n\r" do modelo) reproduzido aqui e impresso pelo
+ * CLI_Printf_Transmit real, que expande cada '\n' em "\r\n". O atual e o
+ * relato.c real (modelo + ponto fixo + CLI_Stream_*). Os dois tickets sao
+ * capturados na saida da UART e tem que ser identicos byte a byte, com
+ * valores sorteados, casas decimais de 0 a 4 e falha do RTC.
+ ******************************************************************************/
+
+#include "host_teste.h"
+#include "cli_driver.h"
+#include "relato.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TICKETS     20000
+#define TICKET_MAX  2048
+#define NUM_GRAOS_TESTE 4
+
+//==============================================================================
+// Configuracao, medicao e RTC falsos
+//==============================================================================
+
+static Config_Aplicacao_t s_config;
+static DadosMedicao_t     s_medicao;
+static bool    s_rtc_ok = true;
+static uint8_t s_hora[3];
+static uint8_t s_data[3];
+
+const Config_Aplicacao_t* Gerenciador_Config_Get_View(void) { return &s_config; }
+uint16_t Gerenciador_Config_Get_NR_Decimals(void) { return s_config.nr_decimals; }
+
+const Config_Grao_t* Gerenciador_Config_Get_Grao_View(uint8_t indice)
+{
+    return (indice < MAX_GRAOS) ? &s_config.graos[indice] : NULL;
+}
+
+bool Gerenciador_Config_Get_Grao_Ativo(uint8_t* indice_ativo)
+{
+    *indice_ativo = s_config.indice_grao_ativo;
+    return true;
+}
+
+void Medicao_Get_UltimaMedicao(DadosMedicao_t* dados) { *dados = s_medicao; }
+
+bool RTC_Driver_GetTime(uint8_t* hours, uint8_t* minutes, uint8_t* seconds)
+{
+    *hours = s_hora[0]; *minutes = s_hora[1]; *seconds = s_hora[2];
+    return s_rtc_ok;
+}
+
+bool RTC_Driver_GetDate(uint8_t* day, uint8_t* month, uint8_t* year)
+{
+    *day = s_data[0]; *month = s_data[1]; *year = s_data[2];
+    return s_rtc_ok;
+}
+
+//==============================================================================
+// UART: captura o que sai pelo DMA e conclui na hora
+//==============================================================================
+
+static uint8_t  s_saida[TICKET_MAX];
+static uint32_t s_saida_len = 0;
+
+static void Uart_Destino(UART_HandleTypeDef* huart, const uint8_t* data, uint16_t len)
+{
+    if (s_saida_len + len <= TICKET_MAX) {
+        memcpy(&s_saida[s_saida_len], data, len);
+    }
+    s_saida_len += len;
+    CLI_HandleTxCplt(huart);
+}
+
+//==============================================================================
+// Referencia: Relatorio_Printer anterior (printf)
+//==============================================================================
+
+static const char Linha_Ant[] = "--------------------------------\n\r";
+static const char Dupla_Ant[] = "\n\r================================\n\r";
+
+static void Antigo_Assinatura(void)
+{
+    uint8_t hours, minutes, seconds;
+    uint8_t day, month, year;
+
+    printf("\n\r");
+    printf("\n\r");
+    printf(Linha_Ant);
+    if (RTC_Driver_GetTime(&hours, &minutes, &seconds))
+    {
+        printf("Assinatura              %02d:%02d:%02d\n\r", hours, minutes, seconds);
+    }
+    if (RTC_Driver_GetDate(&day, &month, &year))
+    {
+        printf("Responsavel             %02d/%02d/%02d\n\r", day, month, year);
+    }
+    printf ("\n\r");
+    printf ("\n\r");
+    printf ("\n\r");
+    printf ("\n\r");
+}
+
+static void Antigo_Cabecalho(void)
+{
+    printf(Dupla_Ant);
+    printf("GEHAKA            G620_Teste_Gab\n\r");
+    printf(Linha_Ant);
+    printf("Versao Firmware= %15s\n\r", FIRMWARE);
+    printf("Numero de Serie= %15s\n\r", s_config.nr_serial);
+    printf(Linha_Ant);
+}
+
+static void Antigo_Relatorio_Printer(void)
+{
+    DadosMedicao_t medicao_snapshot;
+    Medicao_Get_UltimaMedicao(&medicao_snapshot);
+    const Config_Grao_t* dados_grao_ativo = &s_config.graos[s_config.indice_grao_ativo];
+
+    Antigo_Cabecalho();
+
+    printf("Produto       = %16s\n\r",  dados_grao_ativo->nome);
+    printf("Versao Equacao= %10lu\n\r",   (unsigned long)dados_grao_ativo->id_curva);
+    printf("Validade Curva= %13s\n\r", dados_grao_ativo->validade);
+    printf("Amostra Numero= %8i\n\r",      4);
+    printf("Temp.Amostra .= %8.1f 'C\n\r", 22.0);
+    printf("Temp.Instru ..= %8.1f 'C\n\r", medicao_snapshot.Temp_Instru);
+    printf("Peso Amostra .= %8.1f g\n\r", medicao_snapshot.Peso_Amostra); // era .Peso
+    printf("Densidade ....= %8.1f Kg/hL\n\r",  medicao_snapshot.Densidade);
+    printf(Linha_Ant);
+    printf("Umidade ......= %14.*f %%\n\r", (int)s_config.nr_decimals, medicao_snapshot.Umidade);
+    printf(Linha_Ant);
+
+    Antigo_Assinatura();
+}
+
+//==============================================================================
+// Execucao dos dois caminhos
+//==============================================================================
+
+static uint32_t Imprimir_Antigo(uint8_t* destino)
+{
+    s_saida_len = 0;
+    Host_Printf_Destino(CLI_Printf_Transmit); // retarget.c: printf -> console
+    Antigo_Relatorio_Printer();
+    Host_Printf_Destino(NULL);
+    for (int i = 0; (i < 1000) && CLI_Driver_IsTxBusy(); i++) {
+        CLI_TX_Pump();
+    }
+    memcpy(destino, s_saida, s_saida_len);
+    return s_saida_len;
+}
+
+static uint32_t Imprimir_Atual(uint8_t* destino)
+{
+    s_saida_len = 0;
+    VERIFICAR(Relatorio_Printer());
+    for (int i = 0; (i < 1000) && (Relatorio_Ocupado() || CLI_Driver_IsTxBusy()); i++) {
+        Relatorio_Process(); // tarefa de TX do console
+        CLI_TX_Pump();
+    }
+    VERIFICAR(!Relatorio_Ocupado());
+    memcpy(destino, s_saida, s_saida_len);
+    return s_saida_len;
+}
+
+//==============================================================================
+// Dados sorteados
+//==============================================================================
+
+static float Sortear(float min, float max)
+{
+    return min + ((max - min) * (float)rand() / (float)RAND_MAX);
+}
+
+/**
+ * @brief Metade dos valores em milesimos exatos: cai nos empates de
+ *        arredondamento (x.x5, x.125) que o sorteio continuo quase nunca gera.
+ */
+static float Sortear_Valor(float min, float max)
+{
+    if (rand() & 1) {
+        return Sortear(min, max);
+    }
+    int32_t milesimos = (int32_t)(min * 1000.0f) + (rand() % (int32_t)((max - min) * 1000.0f));
+    return (float)milesimos / 1000.0f;
+}
+
+static void Preparar_Config(void)
+{
+    static const char* const nomes[NUM_GRAOS_TESTE] = {
+        "Soja            ", "Milho", "Feijao Carioca  ", "Cafe ISO6673    ",
+    };
+    static const char* const validades[NUM_GRAOS_TESTE] = {
+        "22/06/2028", "01/01/2030", "", "31/12/2027",
+    };
+    static const uint32_t curvas[NUM_GRAOS_TESTE] = { 13853u, 1217u, 4294967295u, 0u };
+
+    memset(&s_config, 0, sizeof(s_config));
+    strcpy(s_config.nr_serial, "22010101001001");
+    for (uint8_t i = 0; i < NUM_GRAOS_TESTE; i++) {
+        strcpy(s_config.graos[i].nome, nomes[i]);
+        strcpy(s_config.graos[i].validade, validades[i]);
+        s_config.graos[i].id_curva = curvas[i];
+    }
+}
+
+static void Sortear_Ticket(void)
+{
+    s_config.indice_grao_ativo = (uint8_t)(rand() % NUM_GRAOS_TESTE);
+    s_config.nr_decimals = (uint16_t)(rand() % 5);
+    s_medicao.Temp_Instru = Sortear_Valor(-20.0f, 60.0f);
+    s_medicao.Peso_Amostra = Sortear_Valor(-5.0f, 400.0f);
+    s_medicao.Densidade = Sortear_Valor(0.0f, 90.0f);
+    s_medicao.Umidade = Sortear_Valor(-2.0f, 60.0f);
+    s_rtc_ok = (rand() % 8) != 0;
+    s_hora[0] = (uint8_t)(rand() % 24); s_hora[1] = (uint8_t)(rand() % 60); s_hora[2] = (uint8_t)(rand() % 60);
+    s_data[0] = (uint8_t)(1 + rand() % 31); s_data[1] = (uint8_t)(1 + rand() % 12); s_data[2] = (uint8_t)(rand() % 100);
+}
+
+static void Mostrar(const char* nome, const uint8_t* t, uint32_t len)
+{
+    fprintf(stderr, "  %s (%lu bytes):\n    ", nome, (unsigned long)len);
+    for (uint32_t i = 0; i < len; i++) {
+        if (t[i] == '\r')      fputs("\\r", stderr);
+        else if (t[i] == '\n') fputs("\\n\n    ", stderr);
+        else                   fputc(t[i], stderr);
+    }
+    fputc('\n', stderr);
+}
+
+/**
+ * @brief Imprime pelos dois caminhos e compara; na primeira diferenca mostra
+ *        os dois tickets.
+ */
+static bool Comparar(uint32_t t)
+{
+    static uint8_t antigo[TICKET_MAX], atual[TICKET_MAX];
+    uint32_t len_antigo = Imprimir_Antigo(antigo);
+    uint32_t len_atual = Imprimir_Atual(atual);
+
+    // Fim de linha como no console: "\n\r" do modelo sai "\r\n\r"
+    VERIFICAR(memcmp(atual, "\r\n\r=====", 8) == 0);
+    if ((len_antigo == len_atual) && (memcmp(antigo, atual, len_atual) == 0)) {
+        return true;
+    }
+    VERIFICAR_IGUAL(len_atual, len_antigo);
+    VERIFICAR(memcmp(antigo, atual, (len_atual < len_antigo) ? len_atual : len_antigo) == 0);
+    fprintf(stderr, "  ticket %lu: dec=%u T=%.9g P=%.9g D=%.9g U=%.9g rtc=%d\n", (unsigned long)t,
+            s_config.nr_decimals, (double)s_medicao.Temp_Instru, (double)s_medicao.Peso_Amostra,
+            (double)s_medicao.Densidade, (double)s_medicao.Umidade, s_rtc_ok);
+    Mostrar("printf", antigo, len_antigo);
+    Mostrar("relato.c", atual, len_atual);
+    return false;
+}
+
+int main(void)
+{
+    static DMA_HandleTypeDef hdma_rx;
+    static UART_HandleTypeDef huart = { .hdmarx = &hdma_rx };
+    // Bordas do ponto fixo: zero negativo, empates exatos, subnormal, faixa alta
+    static const float bordas[] = {
+        0.0f, -0.0f, -0.04f, 0.125f, 0.375f, 2.5f, 18.185f, 12.45f, 1e-40f,
+        -1e-30f, 99999.95f, 123456.789f, 4194303.5f, 8388607.0f, 0.00005f,
+    };
+    uint32_t iguais = 0;
+    uint32_t total = 0;
+
+    Host_Uart_Set_Tx(Uart_Destino);
+    Host_Printf_Destino(CLI_Printf_Transmit);
+    CLI_Init(&huart);
+    CLI_Set_Modo(CLI_MODO_MAQUINA); // sem prompt entre os tickets
+    Host_Printf_Destino(NULL);
+    while (CLI_Driver_IsTxBusy()) CLI_TX_Pump();
+    Preparar_Config();
+    srand(43);
+
+    for (uint32_t b = 0; b < (sizeof(bordas) / sizeof(bordas[0])); b++) {
+        for (uint16_t dec = 0; dec <= 4u; dec++) {
+            Sortear_Ticket();
+            s_config.nr_decimals = dec;
+            s_medicao.Temp_Instru = bordas[b];
+            s_medicao.Peso_Amostra = -bordas[b];
+            s_medicao.Umidade = bordas[b];
+            total++;
+            if (!Comparar(total)) break;
+            iguais++;
+        }
+    }
+
+    for (uint32_t t = 0; (t < TICKETS) && (iguais == total); t++) {
+        Sortear_Ticket();
+        total++;
+        if (Comparar(total)) iguais++;
+    }
+
+    printf("relato: %lu de %lu tickets identicos ao printf\n", (unsigned long)iguais, (unsigned long)total);
+    return Host_Teste_Resultado("relato: ticket igual ao da implementacao por printf");
+}
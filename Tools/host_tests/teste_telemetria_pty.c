@@ -0,0 +1,358 @@
+/*******************************************************************************
+ * @file        teste_telemetria_pty.c
+ * @brief       Telemetria do console atraves de um pseudo-terminal (PTY).
+ * @details     O cli_driver.c real transmite por uma USART simulada a
+ * 115200 8N1: cada DMA fica ocupado pelo tempo de fio dos seus bytes e os
+ * bytes saem no lado mestre de um PTY. O teste le o lado escravo como o PC
+ * leria a porta serial, separa texto e frames (COBS + CRC16, como
+ * log_decoder.py) e confere:
+ *   - carga nominal (amostra a cada 10 ms com todos os canais + texto):
+ *     nenhuma amostra descartada, SEQ continuo, texto integro;
+ *   - sobrecarga (texto acima da capacidade do fio): frames nunca truncados e
+ *     cada amostra descartada aparece como lacuna de SEQ.
+ * Se houver python3, a captura tambem passa por Tools/telemetry_decoder.py.
+ ******************************************************************************/
+
+#include "host_teste.h"
+#include "cli_driver.h"
+#include "app_eventos.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pty.h>
+#include <stdarg.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#define BAUD            115200u
+#define CAPTURA         "build/tlm_captura.bin"
+#define CAPTURA_MAX     (1u << 20)
+
+//==============================================================================
+// USART simulada: DMA ocupado pelo tempo de fio, bytes no mestre do PTY
+//==============================================================================
+
+static DMA_HandleTypeDef s_hdma_rx;
+static UART_HandleTypeDef s_huart = { .hdmarx = &s_hdma_rx };
+static int s_mestre = -1;
+static int s_escravo = -1;
+static uint64_t s_agora_us = 0;
+static uint64_t s_dma_fim_us = 0;
+static bool s_dma_ocupado = false;
+static uint64_t s_bytes_fio = 0;
+
+static uint8_t  s_captura[CAPTURA_MAX];
+static uint32_t s_captura_len = 0;
+
+static void Ler_Escravo(void)
+{
+    uint8_t buf[4096];
+    ssize_t n;
+    while ((n = read(s_escravo, buf, sizeof(buf))) > 0) {
+        if (s_captura_len + (uint32_t)n <= CAPTURA_MAX) {
+            memcpy(&s_captura[s_captura_len], buf, (size_t)n);
+            s_captura_len += (uint32_t)n;
+        }
+    }
+}
+
+static void Uart_Destino(UART_HandleTypeDef* huart, const uint8_t* data, uint16_t len)
+{
+    uint16_t escritos = 0;
+    while (escritos < len) {
+        ssize_t n = write(s_mestre, &data[escritos], len - escritos);
+        if (n > 0) {
+            escritos = (uint16_t)(escritos + n);
+        } else if (errno == EAGAIN) {
+            Ler_Escravo(); // buffer do PTY cheio: o "PC" le e o fio anda
+        } else {
+            VERIFICAR(false);
+            return;
+        }
+    }
+    s_dma_ocupado = true;
+    s_dma_fim_us = s_agora_us + (((uint64_t)len * 10u * 1000000u) / BAUD);
+    s_bytes_fio += len;
+}
+
+static bool Abrir_Pty(void)
+{
+    struct termios t;
+    if (openpty(&s_mestre, &s_escravo, NULL, NULL, NULL) != 0) {
+        return false;
+    }
+    tcgetattr(s_escravo, &t);
+    cfmakeraw(&t); // sem traducao de '\r'/'\n' nem eco
+    tcsetattr(s_escravo, TCSANOW, &t);
+    fcntl(s_mestre, F_SETFL, fcntl(s_mestre, F_GETFL) | O_NONBLOCK);
+    fcntl(s_escravo, F_SETFL, fcntl(s_escravo, F_GETFL) | O_NONBLOCK);
+    return true;
+}
+
+//==============================================================================
+// Superloop simulado (passo de 1 ms)
+//==============================================================================
+
+static uint32_t s_linhas_enviadas = 0;
+
+/** printf do firmware: retarget.c entrega cada caractere ao CLI. */
+static void Console_Printf(const char* fmt, ...)
+{
+    char linha[128];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(linha, sizeof(linha), fmt, ap);
+    va_end(ap);
+    for (int i = 0; i < n; i++) {
+        CLI_Printf_Transmit((uint8_t)linha[i]);
+    }
+}
+
+static void Passo_1ms(void)
+{
+    s_agora_us += 1000u;
+    Host_Avancar_ms(1);
+    if (s_dma_ocupado && (s_agora_us >= s_dma_fim_us)) {
+        s_dma_ocupado = false;
+        CLI_HandleTxCplt(&s_huart);
+    }
+    CLI_Process();
+    CLI_TX_Pump();
+    Ler_Escravo();
+}
+
+/**
+ * @brief Roda 'ms' milissegundos com 'linhas' linhas de texto a cada 'texto_ms'.
+ */
+static void Rodar(uint32_t ms, uint32_t texto_ms, uint32_t linhas)
+{
+    for (uint32_t t = 0; t < ms; t++) {
+        if ((t % texto_ms) == 0u) {
+            for (uint32_t i = 0; i < linhas; i++) {
+                Console_Printf("linha %05lu: peso=%8.2f g freq=%7lu Hz escala=%6.3f\n",
+                               (unsigned long)s_linhas_enviadas, (double)t * 0.01,
+                               (unsigned long)(5000u + t), (double)t / 1000.0);
+                s_linhas_enviadas++;
+            }
+        }
+        Passo_1ms();
+    }
+    while (CLI_Driver_IsTxBusy() || s_dma_ocupado) {
+        Passo_1ms();
+    }
+    Ler_Escravo();
+}
+
+//==============================================================================
+// Lado do PC: texto e frames (mesma logica do Demux de log_decoder.py)
+//==============================================================================
+
+typedef struct {
+    uint32_t amostras;
+    uint32_t lacunas;      // amostras faltando pelo SEQ
+    uint32_t transicoes;
+    uint32_t frames_invalidos;
+    uint32_t linhas_ok;    // linhas de texto completas e na ordem
+    bool     seq_valido;
+    uint16_t seq_esperado;
+} Decodificado_t;
+
+static uint16_t Crc16(const uint8_t* d, uint32_t n)
+{
+    uint16_t crc = 0xFFFF;
+    for (uint32_t i = 0; i < n; i++) {
+        crc ^= (uint16_t)d[i] << 8;
+        for (int b = 0; b < 8; b++) {
+            crc = (crc & 0x8000u) ? (uint16_t)((crc << 1) ^ 0x1021u) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static int32_t Cobs_Decode(const uint8_t* in, uint32_t len, uint8_t* out)
+{
+    uint32_t i = 0, n = 0;
+    while (i < len) {
+        uint8_t codigo = in[i];
+        if ((codigo == 0u) || ((i + codigo) > len)) {
+            return -1;
+        }
+        memcpy(&out[n], &in[i + 1u], codigo - 1u);
+        n += codigo - 1u;
+        i += codigo;
+        if ((codigo < 0xFFu) && (i < len)) {
+            out[n++] = 0u;
+        }
+    }
+    return (int32_t)n;
+}
+
+static bool Fechar_Frame(Decodificado_t* d, const uint8_t* bloco, uint32_t len)
+{
+    uint8_t bruto[256];
+    int32_t n = (len < 200u) ? Cobs_Decode(bloco, len, bruto) : -1;
+    if ((n < 3) || (Crc16(bruto, (uint32_t)n - 2u) !=
+                    (uint16_t)(bruto[n - 2] | (bruto[n - 1] << 8)))) {
+        d->frames_invalidos++;
+        return false;
+    }
+    if (bruto[0] == CLI_FRAME_TIPO_TELEMETRIA) {
+        uint16_t seq = (uint16_t)(bruto[1] | (bruto[2] << 8));
+        if (d->seq_valido) {
+            d->lacunas += (uint16_t)(seq - d->seq_esperado);
+        }
+        d->seq_valido = true;
+        d->seq_esperado = (uint16_t)(seq + 1u);
+        d->amostras++;
+    } else if (bruto[0] == CLI_FRAME_TIPO_TRANSICAO) {
+        d->transicoes++;
+    }
+    return true;
+}
+
+static void Emitir_Texto(Decodificado_t* d, const char* texto, uint32_t len, uint32_t* proxima_linha)
+{
+    // Texto pode chegar partido por um frame no meio de uma linha
+    static char linha[160];
+    static uint32_t linha_len = 0;
+    for (uint32_t i = 0; i < len; i++) {
+        if (linha_len < sizeof(linha) - 1u) {
+            linha[linha_len++] = texto[i];
+        }
+        if (texto[i] != '\n') {
+            continue;
+        }
+        linha[linha_len] = '\0';
+        unsigned long num;
+        const char* inicio = strstr(linha, "linha "); // a primeira vem depois do prompt
+        if ((inicio != NULL) && (sscanf(inicio, "linha %lu:", &num) == 1)) {
+            if ((num == *proxima_linha) && (linha_len >= 2u) && (linha[linha_len - 2u] == '\r')) {
+                d->linhas_ok++;
+            }
+            *proxima_linha = (uint32_t)num + 1u;
+        }
+        linha_len = 0;
+    }
+}
+
+static Decodificado_t Decodificar(const uint8_t* dados, uint32_t len, uint32_t primeira_linha)
+{
+    Decodificado_t d = { 0 };
+    bool dentro = false;
+    uint32_t inicio = 0;
+    uint32_t proxima_linha = primeira_linha;
+
+    for (uint32_t i = 0; i < len; i++) {
+        if (dados[i] != 0u) {
+            continue;
+        }
+        if (dentro) {
+            // Frame invalido: delimitador perdido, este 0x00 abre um novo frame
+            dentro = !Fechar_Frame(&d, &dados[inicio], i - inicio);
+        } else {
+            Emitir_Texto(&d, (const char*)&dados[inicio], i - inicio, &proxima_linha);
+            dentro = true;
+        }
+        inicio = i + 1u;
+    }
+    if (!dentro) {
+        Emitir_Texto(&d, (const char*)&dados[inicio], len - inicio, &proxima_linha);
+    }
+    return d;
+}
+
+//==============================================================================
+// Casos
+//==============================================================================
+
+static void Configurar(uint16_t periodo_ms)
+{
+    CliTelemetriaConfig_t cfg = { true, periodo_ms, TLM_MASCARA_TODOS };
+    VERIFICAR(CLI_Telemetria_Set_Config(&cfg));
+}
+
+int main(void)
+{
+    if (!Abrir_Pty()) {
+        printf("[IGNORADO] telemetria PTY: openpty indisponivel\n");
+        return 0;
+    }
+    Host_Uart_Set_Tx(Uart_Destino);
+    Host_Printf_Destino(CLI_Printf_Transmit); // mensagem inicial vai para o PTY
+    Eventos_Init();
+    CLI_Init(&s_huart);
+    Host_Printf_Destino(NULL);
+    uint64_t t0 = Host_Tempo_ns();
+
+    // --- Carga nominal: 100 amostras/s com todos os canais + texto a cada 20 ms
+    Configurar(10);
+    Rodar(10000, 20, 1);
+    CliTelemetriaStats_t nominal;
+    CLI_Telemetria_Get_Stats(&nominal);
+    uint32_t fim_nominal = s_captura_len;
+    uint64_t fio_nominal = s_bytes_fio;
+
+    Decodificado_t d = Decodificar(s_captura, fim_nominal, 0);
+    VERIFICAR_IGUAL(nominal.amostras_descartadas, 0);
+    VERIFICAR_IGUAL(nominal.amostras_enviadas, 1000);
+    VERIFICAR_IGUAL(d.amostras, nominal.amostras_enviadas);
+    VERIFICAR_IGUAL(d.lacunas, 0);
+    VERIFICAR_IGUAL(d.transicoes, 2); // APP e TELA saem do estado "nao reportado"
+    VERIFICAR_IGUAL(d.frames_invalidos, 0);
+    VERIFICAR_IGUAL(d.linhas_ok, s_linhas_enviadas);
+    VERIFICAR_IGUAL(fio_nominal, fim_nominal);
+
+    printf("telemetria PTY, carga nominal (10 s simulados a %u baud):\n", BAUD);
+    printf("  %lu amostras/s, %lu linhas de texto, fio %.1f%% ocupado (%lu B/s)\n",
+           (unsigned long)(nominal.amostras_enviadas / 10u), (unsigned long)s_linhas_enviadas,
+           (100.0 * (double)(fio_nominal * 10u)) / ((double)BAUD * 10.0),
+           (unsigned long)(fio_nominal / 10u));
+
+    // --- Sobrecarga: uma linha a cada 4 ms (~15 kB/s) excede o fio (11,5 kB/s)
+    uint32_t linha_sobrecarga = s_linhas_enviadas;
+    Rodar(5000, 4, 1);
+    CliTelemetriaStats_t total;
+    CLI_Telemetria_Get_Stats(&total);
+    uint32_t descartadas = total.amostras_descartadas - nominal.amostras_descartadas;
+    uint32_t enviadas = total.amostras_enviadas - nominal.amostras_enviadas;
+
+    Decodificado_t s = Decodificar(&s_captura[fim_nominal], s_captura_len - fim_nominal,
+                                   linha_sobrecarga);
+    VERIFICAR(enviadas + descartadas >= 500); // + as do esvaziamento do FIFO no fim
+    VERIFICAR(descartadas > 0);
+    VERIFICAR_IGUAL(s.amostras, enviadas);
+    VERIFICAR_IGUAL(s.lacunas, descartadas);
+    VERIFICAR_IGUAL(s.frames_invalidos, 0);
+
+    uint64_t ns = Host_Tempo_ns() - t0;
+    printf("  sobrecarga: %lu amostras enviadas, %lu descartadas (lacunas de SEQ: %lu)\n",
+           (unsigned long)enviadas, (unsigned long)descartadas, (unsigned long)s.lacunas);
+    printf("  PTY: %lu bytes em %.1f ms de relogio (%.1f MB/s)\n", (unsigned long)s_captura_len,
+           (double)ns / 1e6, ((double)s_captura_len / ((double)ns / 1e9)) / 1e6);
+
+    // --- Mesmo fluxo pelo decodificador do PC
+    FILE* f = fopen(CAPTURA, "wb");
+    if (f != NULL) {
+        fwrite(s_captura, 1, s_captura_len, f);
+        fclose(f);
+        FILE* p = popen("python3 ../telemetry_decoder.py " CAPTURA
+                        " --csv build/tlm_amostras.csv 2>&1 >/dev/null", "r");
+        char resumo[160] = { 0 };
+        unsigned long am = 0, perdidas = 0;
+        if ((p != NULL) && (fgets(resumo, sizeof(resumo), p) != NULL) &&
+            (sscanf(resumo, "amostras: %lu, perdidas (lacunas de SEQ): %lu", &am, &perdidas) == 2)) {
+            VERIFICAR_IGUAL(am, d.amostras + s.amostras);
+            VERIFICAR_IGUAL(perdidas, descartadas);
+            printf("  telemetry_decoder.py: %s", resumo);
+        } else {
+            printf("  telemetry_decoder.py nao executado (python3 ausente?)\n");
+        }
+        if (p != NULL) {
+            pclose(p);
+        }
+    }
+
+    close(s_mestre);
+    close(s_escravo);
+    return Host_Teste_Resultado("telemetria: PTY a 115200, SEQ e CRC");
+}
@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+"""
+Decodificador do console (USART1) do STM32C071RB_VER_01.
+
+O firmware mistura texto comum (printf/CLI) com frames binarios:
+    0x00 + COBS(tipo + payload + CRC16-CCITT LE) + 0x00
+Tipo 0x01 = registro de log diferido:
+    ID(2) TIMESTAMP_MS(4) NARGS(1) ARG0(4) ... (little endian)
+
+O texto das mensagens vem do dicionario Core/Inc/Modules/log_mensagens.def
+(o ID e a posicao da entrada no arquivo, igual ao enum do firmware).
+
+Uso:
+    log_decoder.py --porta COM5 [--baud 115200]
+    log_decoder.py captura.bin
+    log_decoder.py --gerar-dicionario log_dict.json
+"""
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+DEF_PADRAO = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                          "..", "Core", "Inc", "Modules", "log_mensagens.def")
+
+FRAME_TIPO_LOG = 0x01
+
+RE_ENTRADA = re.compile(
+    r'^\s*LOG_MSG\(\s*(\w+)\s*,\s*(\w+)\s*,\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)', re.M)
+RE_CONVERSAO = re.compile(r'%([-+ #0]*)(\d*)(?:\.(\d+))?(hh|h|ll|l|z)?([diouxXfFeEgGc%])')
+
+
+def carregar_dicionario(caminho):
+    """Le o .def e retorna a lista [ {nome, modulo, nivel, formato} ] indexada pelo ID."""
+    with open(caminho, encoding="latin-1") as f:
+        texto = f.read()
+    # Ignora comentarios de bloco para nao capturar o exemplo do cabecalho
+    texto = re.sub(r"/\*.*?\*/", "", texto, flags=re.S)
+    dicionario = []
+    for nome, modulo, nivel, formato in RE_ENTRADA.findall(texto):
+        dicionario.append({
+            "nome": nome,
+            "modulo": modulo.replace("LOG_MOD_", ""),
+            "nivel": nivel.replace("LOG_NIVEL_", ""),
+            "formato": bytes(formato, "latin-1").decode("unicode_escape"),
+        })
+    return dicionario
+
+
+def formatar(formato, args):
+    """Aplica o formato printf do firmware sobre palavras de 32 bits."""
+    fila = list(args)
+
+    def substituir(m):
+        flags, largura, precisao, _, conv = m.groups()
+        if conv == "%":
+            return "%"
+        palavra = fila.pop(0) if fila else 0
+        spec = "%" + flags + largura + ("." + precisao if precisao is not None else "")
+        if conv in "di":
+            valor = struct.unpack("<i", struct.pack("<I", palavra))[0]
+            return (spec + "d") % valor
+        if conv in "fFeEgG":
+            valor = struct.unpack("<f", struct.pack("<I", palavra))[0]
+            return (spec + conv) % valor
+        if conv == "c":
+            return chr(palavra & 0xFF)
+        return (spec + conv) % palavra
+
+    return RE_CONVERSAO.sub(substituir, formato)
+
+
+def crc16_ccitt(dados):
+    crc = 0xFFFF
+    for b in dados:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+    return crc
+
+
+def cobs_decode(dados):
+    saida = bytearray()
+    i = 0
+    while i < len(dados):
+        codigo = dados[i]
+        if codigo == 0 or i + codigo > len(dados):
+            return None
+        saida += dados[i + 1:i + codigo]
+        i += codigo
+        if codigo < 0xFF and i < len(dados):
+            saida.append(0)
+    return bytes(saida)
+
+
+def decodificar_frame(bloco):
+    """Retorna (tipo, payload) ou None se o bloco nao e um frame valido."""
+    bruto = cobs_decode(bloco)
+    if bruto is None or len(bruto) < 3:
+        return None
+    corpo, crc = bruto[:-2], struct.unpack("<H", bruto[-2:])[0]
+    if crc16_ccitt(corpo) != crc:
+        return None
+    return corpo[0], corpo[1:]
+
+
+def renderizar_log(payload, dicionario):
+    if len(payload) < 7:
+        return "[log] registro curto: %s" % payload.hex()
+    msg_id, ts, nargs = struct.unpack("<HIB", payload[:7])
+    args = list(struct.unpack("<%dI" % nargs, payload[7:7 + 4 * nargs]))
+    if msg_id >= len(dicionario):
+        return "[%10.3f] ? ID %u args=%s (dicionario desatualizado?)" % (ts / 1000.0, msg_id, args)
+    d = dicionario[msg_id]
+    return "[%10.3f] %-5s %-8s %s" % (ts / 1000.0, d["nivel"], d["modulo"], formatar(d["formato"], args))
+
+
+class Demux:
+    """Separa o fluxo em texto e frames (delimitados por 0x00)."""
+
+    def __init__(self, dicionario, tratadores=None, saida=sys.stdout):
+        self.dicionario = dicionario
+        self.tratadores = {FRAME_TIPO_LOG: lambda p: renderizar_log(p, self.dicionario)}
+        self.tratadores.update(tratadores or {})
+        self.saida = saida
+        self.dentro_frame = False
+        self.buffer = bytearray()
+
+    def alimentar(self, dados):
+        for b in dados:
+            if b != 0:
+                self.buffer.append(b)
+                continue
+            if self.dentro_frame:
+                self._fechar_frame()
+            else:
+                self._emitir_texto()
+            self.dentro_frame = not self.dentro_frame
+        if not self.dentro_frame:
+            self._emitir_texto()
+
+    def _emitir_texto(self):
+        if self.buffer:
+            self.saida.write(self.buffer.decode("latin-1").replace("\r\n", "\n"))
+            self.saida.flush()
+            self.buffer.clear()
+
+    def _fechar_frame(self):
+        frame = decodificar_frame(bytes(self.buffer))
+        self.buffer.clear()
+        if frame is None:
+            # Delimitador perdido: assume que este 0x00 abre um novo frame
+            self.dentro_frame = False
+            return
+        tipo, payload = frame
+        tratador = self.tratadores.get(tipo)
+        if tratador is not None:
+            linha = tratador(payload)
+            if linha is not None:
+                self.saida.write(linha + "\n")
+                self.saida.flush()
+
+
+def abrir_entrada(args):
+    if args.porta:
+        import serial  # pyserial
+        porta = serial.Serial(args.porta, args.baud, timeout=0.1)
+        return lambda: porta.read(256)
+    arquivo = open(args.arquivo, "rb") if args.arquivo else sys.stdin.buffer
+    return lambda: arquivo.read(256)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("arquivo", nargs="?", help="captura binaria (padrao: stdin)")
+    ap.add_argument("--porta", help="porta serial (requer pyserial)")
+    ap.add_argument("--baud", type=int, default=115200)
+    ap.add_argument("--def", dest="def_path", default=DEF_PADRAO, help="caminho do log_mensagens.def")
+    ap.add_argument("--gerar-dicionario", metavar="JSON",
+                    help="apenas gera o dicionario ID -> mensagem (passo pos-build)")
+    args = ap.parse_args()
+
+    dicionario = carregar_dicionario(args.def_path)
+    if args.gerar_dicionario:
+        with open(args.gerar_dicionario, "w", encoding="utf-8") as f:
+            json.dump(dicionario, f, indent=2, ensure_ascii=False)
+        return
+
+    ler = abrir_entrada(args)
+    demux = Demux(dicionario)
+    try:
+        while True:
+            dados = ler()
+            if not dados:
+                if args.porta:
+                    continue
+                break
+            demux.alimentar(dados)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
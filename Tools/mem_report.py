@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""
+Relatorio de RAM estatica a partir do .map do armlink (Keil MDK).
+
+Le a secao "Memory Map of the image", soma as secoes da regiao de RAM
+(RW_IRAM1) por objeto e lista os maiores simbolos. Se o total (RW + ZI +
+pilha) passar do orcamento MEMORIA_ORCAMENTO_RAM_BYTES definido em
+Core/Inc/Modules/memoria.h, sai com codigo 1 -- o passo "After Build" do
+projeto para o build com erro.
+
+Uso:
+    mem_report.py STM32C071RB_VER_01.axf        (usa o .map ao lado)
+    mem_report.py arquivo.map [--top 15] [--orcamento 23552]
+"""
+
+import argparse
+import os
+import re
+import sys
+
+HEADER_PADRAO = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                             "..", "Core", "Inc", "Modules", "memoria.h")
+REGIAO_RAM = "RW_IRAM1"
+
+RE_REGIAO = re.compile(r"^\s*Execution Region (\S+) \(.*Size: (0x[0-9a-fA-F]+), Max: (0x[0-9a-fA-F]+)")
+# Exec Addr  Load Addr  Size  Type  Attr  Idx  [E]  Section Name  Object
+RE_SECAO = re.compile(r"^\s*0x[0-9a-fA-F]+\s+(?:0x[0-9a-fA-F]+|-)\s+(0x[0-9a-fA-F]+)\s+(Data|Zero|Code)\s+\w+\s+\d+\s+\*?\s*(\S+)\s+(.+?)\s*$")
+RE_PAD = re.compile(r"^\s*0x[0-9a-fA-F]+\s+(?:0x[0-9a-fA-F]+|-)\s+(0x[0-9a-fA-F]+)\s+PAD")
+RE_DEFINE = re.compile(r"#define\s+(\w+)\s+(.+?)(?:\s*/[/*].*)?$", re.M)
+
+
+def ler_orcamento(caminho):
+    """Avalia MEMORIA_ORCAMENTO_RAM_BYTES (expressao simples com outros defines)."""
+    with open(caminho, encoding="latin-1") as f:
+        defines = dict(RE_DEFINE.findall(f.read()))
+
+    def avaliar(nome, profundidade=0):
+        expr = defines[nome]
+        expr = re.sub(r"\b(0x[0-9a-fA-F]+|\d+)[uUlL]+\b", r"\1", expr)
+        expr = re.sub(r"\b([A-Z_][A-Z0-9_]*)\b",
+                      lambda m: str(avaliar(m.group(1), profundidade + 1)) if profundidade < 8 else m.group(1),
+                      expr)
+        return int(eval(expr, {"__builtins__": {}}))
+
+    return avaliar("MEMORIA_ORCAMENTO_RAM_BYTES")
+
+
+def ler_mapa(caminho):
+    """Retorna (tamanho_regiao, max_regiao, [(objeto, secao, bytes)], bytes_pad)."""
+    regiao = None
+    tamanho = maximo = 0
+    secoes = []
+    pad = 0
+    with open(caminho, encoding="latin-1") as f:
+        for linha in f:
+            m = RE_REGIAO.match(linha)
+            if m:
+                regiao = m.group(1)
+                if regiao == REGIAO_RAM:
+                    tamanho, maximo = int(m.group(2), 16), int(m.group(3), 16)
+                continue
+            if regiao != REGIAO_RAM:
+                continue
+            if linha.startswith("====="):
+                break
+            m = RE_PAD.match(linha)
+            if m:
+                pad += int(m.group(1), 16)
+                continue
+            m = RE_SECAO.match(linha)
+            if m:
+                secoes.append((m.group(4), m.group(3), int(m.group(1), 16)))
+    if regiao is None or tamanho == 0:
+        raise ValueError("regiao %s nao encontrada em %s" % (REGIAO_RAM, caminho))
+    return tamanho, maximo, secoes, pad
+
+
+def nome_simbolo(secao):
+    """.bss.s_config_cache -> s_config_cache; .bss..L_MergedGlobals -> (agrupados)."""
+    nome = re.sub(r"^\.(bss|data)\.?", "", secao)
+    if nome.startswith(".L_MergedGlobals"):
+        return "(estaticas agrupadas)"
+    return nome or secao
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("arquivo", help=".map do armlink ou o .axf (procura o .map ao lado)")
+    ap.add_argument("--top", type=int, default=15, help="quantidade de simbolos listados")
+    ap.add_argument("--orcamento", type=int, help="orcamento em bytes (padrao: lido de memoria.h)")
+    ap.add_argument("--header", default=HEADER_PADRAO, help="header com MEMORIA_ORCAMENTO_RAM_BYTES")
+    args = ap.parse_args()
+
+    mapa = args.arquivo
+    if not mapa.lower().endswith(".map"):
+        mapa = os.path.splitext(mapa)[0] + ".map"
+
+    try:
+        tamanho, maximo, secoes, pad = ler_mapa(mapa)
+    except (OSError, ValueError) as e:
+        print("mem_report: erro: %s" % e)
+        return 2
+
+    orcamento = args.orcamento if args.orcamento is not None else ler_orcamento(args.header)
+
+    por_objeto = {}
+    for objeto, _, n in secoes:
+        por_objeto[objeto] = por_objeto.get(objeto, 0) + n
+
+    print("RAM (%s): %d de %d bytes (%.1f%%), orcamento %d, padding %d"
+          % (REGIAO_RAM, tamanho, maximo, 100.0 * tamanho / maximo, orcamento, pad))
+    print()
+    print("%-34s %8s" % ("Modulo", "Bytes"))
+    for objeto, n in sorted(por_objeto.items(), key=lambda kv: -kv[1]):
+        print("%-34s %8d" % (objeto, n))
+    print()
+    print("%-34s %-28s %8s" % ("Maiores objetos", "Modulo", "Bytes"))
+    for objeto, secao, n in sorted(secoes, key=lambda s: -s[2])[:args.top]:
+        print("%-34s %-28s %8d" % (nome_simbolo(secao), objeto, n))
+
+    if tamanho > orcamento:
+        print()
+        print("mem_report: erro: RAM %d bytes excede o orcamento de %d bytes (+%d)"
+              % (tamanho, orcamento, tamanho - orcamento))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""
+Decodificador de telemetria do console (USART1) -> CSV.
+
+Frames (mesmo enquadramento COBS + CRC16 do log diferido, ver log_decoder.py):
+    0x02 amostra:   SEQ(2) TS_MS(4) MASCARA(2) + 4 bytes por canal habilitado
+    0x03 transicao: TS_MS(4) MAQUINA(1) ANTERIOR(2) NOVO(2)
+Texto do CLI e registros de log continuam sendo exibidos no terminal.
+
+Uso:
+    telemetry_decoder.py --porta COM5 --csv amostras.csv
+    telemetry_decoder.py captura.bin --csv amostras.csv --transicoes trans.csv
+
+No firmware: TLM 20 7F  (20 ms, todos os canais) e TLM ON.
+"""
+
+import argparse
+import csv
+import struct
+import sys
+
+import log_decoder
+
+FRAME_TIPO_TELEMETRIA = 0x02
+FRAME_TIPO_TRANSICAO = 0x03
+
+# (nome da coluna, formato struct) na ordem dos bits de TlmCanal_t
+CANAIS = [
+    ("adc_bruto", "<i"),
+    ("peso_g", "<f"),
+    ("pulsos", "<I"),
+    ("janela", "<I"),
+    ("escala_a", "<f"),
+    ("temp_instru_c", "<f"),
+    ("estados", "<I"),
+    ("temp_celula_c", "<f"),   # so com ADS1232_TEMP_INTERLEAVE
+]
+
+MAQUINAS = {0: "app", 1: "tela"}
+ESTADOS_APP = {0: "ACTIVE", 1: "STOPPED", 2: "CONFIRM_WAKEUP", 3: "PREPARING_STOP", 4: "WAKING",
+               0xFFFF: "-"}
+
+
+class Telemetria:
+    def __init__(self, arq_amostras, arq_transicoes):
+        cols = ["seq", "ts_ms"] + [c[0] for c in CANAIS] + ["estado_app", "tela"]
+        self.amostras = csv.writer(arq_amostras)
+        self.amostras.writerow(cols)
+        self.arq_amostras = arq_amostras
+        self.transicoes = csv.writer(arq_transicoes) if arq_transicoes else None
+        if self.transicoes:
+            self.transicoes.writerow(["ts_ms", "maquina", "anterior", "novo"])
+        self.arq_transicoes = arq_transicoes
+        self.seq_esperado = None
+        self.total = 0
+        self.perdidas = 0
+
+    def amostra(self, payload):
+        seq, ts, mascara = struct.unpack("<HIH", payload[:8])
+        if self.seq_esperado is not None and seq != self.seq_esperado:
+            self.perdidas += (seq - self.seq_esperado) & 0xFFFF
+        self.seq_esperado = (seq + 1) & 0xFFFF
+        self.total += 1
+
+        linha = {"seq": seq, "ts_ms": ts}
+        pos = 8
+        for bit, (nome, fmt) in enumerate(CANAIS):
+            if mascara & (1 << bit):
+                valor = struct.unpack(fmt, payload[pos:pos + 4])[0]
+                linha[nome] = round(valor, 4) if fmt == "<f" else valor
+                pos += 4
+        if "estados" in linha:
+            linha["estado_app"] = ESTADOS_APP.get(linha["estados"] & 0xFF, linha["estados"] & 0xFF)
+            linha["tela"] = linha["estados"] >> 16
+
+        cols = ["seq", "ts_ms"] + [c[0] for c in CANAIS] + ["estado_app", "tela"]
+        self.amostras.writerow([linha.get(c, "") for c in cols])
+        self.arq_amostras.flush()
+        return None
+
+    def transicao(self, payload):
+        ts, maquina, anterior, novo = struct.unpack("<IBHH", payload[:9])
+        nome = MAQUINAS.get(maquina, str(maquina))
+        if maquina == 0:
+            anterior, novo = ESTADOS_APP.get(anterior, anterior), ESTADOS_APP.get(novo, novo)
+        if self.transicoes:
+            self.transicoes.writerow([ts, nome, anterior, novo])
+            self.arq_transicoes.flush()
+        return "[%10.3f] transicao %s: %s -> %s" % (ts / 1000.0, nome, anterior, novo)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("arquivo", nargs="?", help="captura binaria (padrao: stdin)")
+    ap.add_argument("--porta", help="porta serial (requer pyserial)")
+    ap.add_argument("--baud", type=int, default=115200)
+    ap.add_argument("--def", dest="def_path", default=log_decoder.DEF_PADRAO)
+    ap.add_argument("--csv", required=True, help="arquivo CSV das amostras")
+    ap.add_argument("--transicoes", help="arquivo CSV das transicoes de estado")
+    args = ap.parse_args()
+
+    with open(args.csv, "w", newline="") as f_am:
+        f_tr = open(args.transicoes, "w", newline="") if args.transicoes else None
+        tlm = Telemetria(f_am, f_tr)
+        demux = log_decoder.Demux(log_decoder.carregar_dicionario(args.def_path), {
+            FRAME_TIPO_TELEMETRIA: tlm.amostra,
+            FRAME_TIPO_TRANSICAO: tlm.transicao,
+        })
+        ler = log_decoder.abrir_entrada(args)
+        try:
+            while True:
+                dados = ler()
+                if not dados:
+                    if args.porta:
+                        continue
+                    break
+                demux.alimentar(dados)
+        except KeyboardInterrupt:
+            pass
+        finally:
+            if f_tr:
+                f_tr.close()
+        sys.stderr.write("amostras: %d, perdidas (lacunas de SEQ): %d\n" % (tlm.total, tlm.perdidas))
+
+
+if __name__ == "__main__":
+    main()